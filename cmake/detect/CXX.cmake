@@ -131,5 +131,22 @@ set(PRETTY_FUNCTION_CODE
      }")
 check_cxx_source_compiles("${PRETTY_FUNCTION_CODE}" EL_HAVE_PRETTY_FUNCTION)
 
+# POSIX memory mapping (for zero-copy views of BINARY_FLAT files)
+# ================================================================
+set(MMAP_CODE
+    "#include <sys/mman.h>
+     #include <fcntl.h>
+     #include <unistd.h>
+     int main()
+     {
+         const int fd = open(\"file\",O_RDONLY);
+         void* map = mmap(0,1,PROT_READ,MAP_SHARED,fd,0);
+         msync(map,1,MS_SYNC);
+         munmap(map,1);
+         close(fd);
+         return 0;
+     }")
+check_cxx_source_compiles("${MMAP_CODE}" EL_HAVE_MMAP)
+
 unset(CMAKE_REQUIRED_FLAGS)
 unset(CMAKE_REQUIRED_DEFINITIONS)
@@ -21,6 +21,8 @@ main( int argc, char* argv[] )
             El::Input("--filename","filename",std::string(""));
         const bool display = El::Input("--display","display matrix?",true);
         const bool print = El::Input("--print","print matrix?",false);
+        const bool progress =
+          El::Input("--progress","report read throughput?",false);
         El::ProcessInput();
         El::PrintInputReport();
 
@@ -31,7 +33,7 @@ main( int argc, char* argv[] )
         else
         {
             El::DistMatrix<double> A(m,n);
-            El::Read( A, filename );
+            El::Read( A, filename, El::AUTO, false, progress );
             if( display )
                 El::Display( A, "A (distributed read)" );
             if( print )
@@ -44,6 +44,14 @@ main( int argc, char* argv[] )
                 El::Display( B, "B" );
             if( print )
                 El::Print( B, "B" );
+
+            // Checkpoint A with parallel I/O and restore it
+            El::Write( A, basename, El::BINARY_DIST );
+            El::DistMatrix<El::Complex<double>> C;
+            El::Read( C, basename+".dbin" );
+            El::Axpy( El::Complex<double>(-1), A, C );
+            El::OutputFromRoot
+            (A.Grid().Comm(),"|| A - C ||_F = ",El::FrobeniusNorm(C));
         }
     }
     catch( std::exception& e ) { El::ReportException(e); }
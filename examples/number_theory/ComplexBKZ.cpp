@@ -35,6 +35,10 @@ int main( int argc, char* argv[] )
           ("--subBKZ","use BKZ w/ lower blocksize for subproblems?",true);
         const bool subEarlyAbort =
           El::Input("--subEarlyAbort","early abort subproblem?",false);
+        const bool parallelTours =
+          El::Input("--parallelTours","enumerate blocks concurrently?",false);
+        const El::Int tourStagger =
+          El::Input("--tourStagger","shift of blocks between tours",0);
         const bool timeLLL = El::Input("--timeLLL","time LLL?",false);
         const bool timeBKZ = El::Input("--timeBKZ","time BKZ?",true);
         const bool progressLLL =
@@ -72,6 +76,8 @@ int main( int argc, char* argv[] )
         ctrl.numEnumsBeforeAbort = numEnumsBeforeAbort;
         ctrl.subBKZ = subBKZ;
         ctrl.subEarlyAbort = subEarlyAbort;
+        ctrl.parallelTours = parallelTours;
+        ctrl.tourStagger = tourStagger;
         ctrl.logNorms = logNorms;
         ctrl.logProjNorms = logProjNorms;
         ctrl.checkpoint = checkpoint;
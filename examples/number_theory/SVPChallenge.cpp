@@ -63,6 +63,10 @@ int main( int argc, char* argv[] )
         const bool recursiveBKZ =
           El::Input("--recursiveBKZ","recursive BKZ?",false);
         const El::Int cutoff = El::Input("--cutoff","recursive cutoff",10);
+        const bool segmentedLLL =
+          El::Input("--segmentedLLL","segmented LLL?",false);
+        const El::Int segmentSize =
+          El::Input("--segmentSize","segmented LLL segment size",64);
         const bool earlyAbort =
           El::Input("--earlyAbort","early abort BKZ?",false);
         const El::Int numEnumsBeforeAbort =
@@ -204,6 +208,8 @@ int main( int argc, char* argv[] )
         ctrl.lllCtrl.variant = static_cast<El::LLLVariant>(varInt);
         ctrl.lllCtrl.recursive = recursiveLLL;
         ctrl.lllCtrl.cutoff = cutoff;
+        ctrl.lllCtrl.segmented = segmentedLLL;
+        ctrl.lllCtrl.segmentSize = segmentSize;
         ctrl.lllCtrl.presort = presort;
         ctrl.lllCtrl.smallestFirst = smallestFirst;
         ctrl.lllCtrl.progress = progressLLL;
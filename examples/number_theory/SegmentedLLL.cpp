@@ -0,0 +1,105 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Throw if the upper-triangular factor R of a basis is not (delta,eta)
+// LLL-reduced, up to the relative tolerance 'tol'
+template<typename Real>
+void CheckLLLReduced
+( const El::Matrix<Real>& R, Real delta, Real eta, Real tol )
+{
+    const El::Int n = El::Min(R.Height(),R.Width());
+    for( El::Int j=1; j<n; ++j )
+    {
+        for( El::Int i=0; i<j; ++i )
+            if( El::Abs(R(i,j)) > (eta+tol)*El::Abs(R(i,i)) )
+                El::LogicError
+                ("Column ",j," was not size reduced against column ",i);
+        const Real lhs = delta*R(j-1,j-1)*R(j-1,j-1);
+        const Real rhs = R(j-1,j)*R(j-1,j) + R(j,j)*R(j,j);
+        if( lhs > (1+tol)*rhs )
+            El::LogicError("The Lovasz condition failed for column ",j);
+    }
+}
+
+int main( int argc, char* argv[] )
+{
+    El::Environment env( argc, argv );
+
+    try
+    {
+        typedef double Real;
+
+        const El::Int n = El::Input("--n","problem size",100);
+        const Real radius = El::Input("--radius","sampling radius",Real(1.e6));
+        const El::Int segmentSize =
+          El::Input("--segmentSize","columns per segment",16);
+        const bool time = El::Input("--time","time LLL?",true);
+        El::ProcessInput();
+        El::PrintInputReport();
+
+        El::Matrix<Real> BOrig;
+        El::KnapsackTypeBasis( BOrig, n, radius );
+
+        // Reduce with the standard, unblocked algorithm for comparison
+        El::LLLCtrl<Real> ctrl;
+        ctrl.time = time;
+        auto BUnblocked( BOrig );
+        El::Matrix<Real> R;
+        El::Timer timer;
+        timer.Start();
+        El::LLL( BUnblocked, R, ctrl );
+        El::Output
+        ("Unblocked LLL: ",timer.Stop()," seconds, root Hermite factor ",
+         El::lll::RootHermiteFactor(R));
+
+        // Reduce with segments of 'segmentSize' columns
+        ctrl.segmented = true;
+        ctrl.segmentSize = segmentSize;
+        auto B( BOrig );
+        El::Matrix<Real> U;
+        timer.Start();
+        const auto info = El::LLL( B, U, R, ctrl );
+        El::Output
+        ("Segmented LLL: ",timer.Stop()," seconds over ",info.numSweeps,
+         " sweeps, root Hermite factor ",El::lll::RootHermiteFactor(R));
+        if( segmentSize < n && info.numSweeps == 0 )
+            El::LogicError("The segmented algorithm was not used");
+
+        const Real eps = El::limits::Epsilon<Real>();
+        const Real tol = El::Sqrt(eps);
+        CheckLLLReduced( R, ctrl.delta, ctrl.eta, tol );
+
+        // B should equal BOrig U for the returned unimodular U
+        El::Matrix<Real> E( B );
+        El::Gemm( El::NORMAL, El::NORMAL, Real(-1), BOrig, U, Real(1), E );
+        const Real relError =
+          El::FrobeniusNorm(E) /
+          (El::FrobeniusNorm(BOrig)*El::FrobeniusNorm(U));
+        El::Output
+        ("|| B - BOrig U ||_F / (|| BOrig ||_F || U ||_F) = ",relError);
+        if( relError > n*eps )
+            El::LogicError("The transformation did not match the basis");
+
+        // A jumpstarted pass over an already-reduced basis should not take
+        // the segmented path
+        El::Matrix<Real> QR( B ), t, d;
+        El::QR( QR, t, d );
+        auto jumpCtrl( ctrl );
+        jumpCtrl.jumpstart = true;
+        jumpCtrl.startCol = n-1;
+        const auto jumpInfo = El::LLLWithQ( B, QR, t, d, jumpCtrl );
+        if( jumpInfo.numSweeps != 0 )
+            El::LogicError("A jumpstarted LLL used the segmented algorithm");
+        El::Output("Jumpstarted pass performed ",jumpInfo.numSwaps," swaps");
+    }
+    catch( std::exception& e ) { El::ReportException(e); }
+
+    return 0;
+}
@@ -195,6 +195,49 @@ int pmrrr(char *jobz, char *range, int *n, double  *D,
 
 
 
+/* Variant of 'pmrrr' which accepts tuning parameters and reports
+ * statistics on the computation; 'params' and 'stats' may be NULL,
+ * in which case the behaviour is that of 'pmrrr'. */
+typedef struct {
+  int    nthreads;   /* threads per process; if nonpositive, 
+                      * PMR_NUM_THREADS or DEFAULT_NUM_THREADS */
+  double min_relgap; /* relative gap below which eigenvalues form a
+                      * cluster; if nonpositive, MIN_RELGAP */
+  int    balance;    /* if nonzero, the eigenvectors are assigned to 
+                      * the processes by their estimated cost rather
+                      * than in chunks of equal size */
+  int    max_nz;     /* if balancing, the maximum number of eigenvectors
+                      * a process may be assigned (the width of Z); 
+                      * if nonpositive, 2*ceil('#eigenpairs'/'#processes') */
+} pmrrr_params_t;
+
+typedef struct {
+  int    nthreads;       /* threads used by the process */
+  int    num_clusters;   /* number of clusters of the root representations
+                          * within the computed eigenpairs */
+  int    num_clustered;  /* number of local eigenvectors within clusters */
+  double time_vals;      /* seconds spent computing the eigenvalues */
+  double time_vecs;      /* seconds spent computing the eigenvectors */
+  double time_refine;    /* seconds spent refining to high rel. accuracy */
+} pmrrr_stats_t;
+
+int pmrrr_ctrl(char *jobz, char *range, int *n, double  *D,
+	       double *E, double *vl, double *vu, int *il, int *iu,
+	       int *tryrac, MPI_Comm comm, int *nz, int *offset,
+	       double *W, double *Z, int *ldz, int *Zsupp,
+	       const pmrrr_params_t *params, pmrrr_stats_t *stats);
+
+/* Relative cost of computing an eigenvector within a cluster, 
+ * which requires a new representation and the refinement of its 
+ * eigenvalue, compared to that of a singleton when balancing the 
+ * eigenvectors across processes; default: 2.0 */
+#define CLUSTER_COST      2.0
+
+/* Relative deviation from the ideal cost of a process which is 
+ * accepted in order to avoid splitting a cluster between processes
+ * when balancing; default: 0.25 */
+#define CLUSTER_SPLIT_TOL 0.25
+
 /* Set the number of threads in case PMR_NUM_THREADS is not 
  * specified */
 #define DEFAULT_NUM_THREADS 1
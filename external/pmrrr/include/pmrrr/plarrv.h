@@ -49,7 +49,7 @@
  */
 int plarrv(proc_t *procinfo, in_t *Dstruct, val_t *Wstruct,
 	   vec_t *Zstruct, tol_t *tolstruct, int *nzp,
-	   int *myfirstp);
+	   int *myfirstp, int *nclustersp, int *nclusteredp);
 
 #define COMM_COMPLETE        0
 #define COMM_INCOMPLETE      1
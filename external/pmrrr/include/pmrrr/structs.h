@@ -85,6 +85,8 @@ typedef struct {
   MPI_Comm comm;
   int      nthreads;
   int      thread_support;
+  int      balance;
+  int      max_nz;
 } proc_t;
 
 typedef struct {
@@ -92,6 +94,7 @@ typedef struct {
   double rtol1;
   double rtol2;
   double pivmin;
+  double min_relgap;
 } tol_t;
 
 typedef struct {
@@ -96,9 +96,8 @@ typedef struct {
   double     bl_spdiam;
   int        producer_tid; // not longer needed
 #ifndef DISABLE_PTHREADS
-  sem_t      *sem; /* since semt_t is a handle could also store it
-		      instead of pointer to it, but pointer is all
-                      that is needed */
+  sem_t      *sem; /* shared by all refinement tasks of a cluster,
+                      which post to it upon completion */
 #endif
 } refine_t;
 
@@ -113,9 +112,11 @@ task_t *PMR_create_c_task(int first, int last, int depth,
 			  int proc_W_end, int left_pid, int right_pid, 
 			  rrr_t *RRR);
 
+/* The task posts to the semaphore of 'barrier', which must have been
+ * initialized with PMR_refine_sem_init */
 task_t *PMR_create_r_task(int begin, int end, double *D,
 			  double *DLL, int p, int q, int bl_size,
-			  double bl_spdiam, int tid);
+			  double bl_spdiam, int tid, refine_t *barrier);
 
 int PMR_refine_sem_init(refine_t *refine);
 int PMR_refine_sem_destroy(refine_t *refine);
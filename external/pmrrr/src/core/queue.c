@@ -89,7 +89,7 @@ int PMR_queue_lock(queue_t *queue)
     fprintf(stderr,"pthread_mutex_lock returned EDEADLK\n");
   else if( info == EPERM )
     fprintf(stderr,"pthread_mutex_lock returned EPERM\n");
-  else
+  else if( info != 0 )
     fprintf(stderr,"pthread_mutex_lock returned %d\n",info);
  #else
   int info = pthread_spin_lock(&queue->lock);
@@ -114,7 +114,7 @@ int PMR_queue_unlock(queue_t *queue)
     fprintf(stderr,"pthread_mutex_unlock returned EDEADLK\n");
   else if( info == EPERM )
     fprintf(stderr,"pthread_mutex_unlock returned EPERM\n");
-  else
+  else if( info != 0 )
     fprintf(stderr,"pthread_mutex_unlock returned %d\n",info);
  #else
   int info = pthread_spin_unlock(&queue->lock);
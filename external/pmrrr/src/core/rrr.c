@@ -80,7 +80,7 @@ int PMR_rrr_lock(rrr_t *RRR)
     fprintf(stderr,"pthread_mutex_lock returned EDEADLK\n");
   else if( info == EPERM )
     fprintf(stderr,"pthread_mutex_lock returned EPERM\n");
-  else
+  else if( info != 0 )
     fprintf(stderr,"pthread_mutex_lock returned %d\n",info);
   assert(info == 0);
   return info;
@@ -101,7 +101,7 @@ int PMR_rrr_unlock(rrr_t *RRR)
     fprintf(stderr,"pthread_mutex_unlock returned EDEADLK\n");
   else if( info == EPERM )
     fprintf(stderr,"pthread_mutex_unlock returned EPERM\n");
-  else
+  else if( info != 0 )
     fprintf(stderr,"pthread_mutex_unlock returned %d\n",info);
   assert(info == 0);
   return info;
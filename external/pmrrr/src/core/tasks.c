@@ -103,6 +103,7 @@ task_t *PMR_create_c_task
 int PMR_refine_sem_init(refine_t *refine)
 {
 #ifndef DISABLE_PTHREADS
+  refine->sem = (sem_t*)malloc(sizeof(sem_t)); assert(refine->sem!=NULL);
   int info = sem_init(refine->sem, 0, 0);
   assert(info == 0);
   return info;
@@ -116,6 +117,7 @@ int PMR_refine_sem_destroy(refine_t *refine)
 #ifndef DISABLE_PTHREADS
   int info = sem_destroy(refine->sem);
   assert(info == 0);
+  free(refine->sem);
   return info;
 #else
   return 0;
@@ -146,7 +148,8 @@ int PMR_refine_sem_post(refine_t *refine)
 
 task_t *PMR_create_r_task
 (int begin, int end, double *D, double *DLL, 
- int p, int q, int bl_size, double bl_spdiam, int tid)
+ int p, int q, int bl_size, double bl_spdiam, int tid,
+ refine_t *barrier)
 {
   task_t *t = (task_t*)malloc(sizeof(task_t)); assert(t!=NULL);
   refine_t *r = (refine_t*)malloc(sizeof(refine_t)); assert(r!=NULL); 
@@ -160,8 +163,9 @@ task_t *PMR_create_r_task
   r->bl_size      = bl_size;
   r->bl_spdiam    = bl_spdiam;
   r->producer_tid = tid;
-
-  PMR_refine_sem_init(r);
+#ifndef DISABLE_PTHREADS
+  r->sem          = barrier->sem;
+#endif
 
   t->data = (void*)r;
   t->flag = REFINE_TASK_FLAG;
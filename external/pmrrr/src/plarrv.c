@@ -53,10 +53,13 @@
 
 static int assign_to_proc
 (proc_t *procinfo, in_t *Dstruct, val_t *Wstruct, vec_t *Zstruct, 
- int *nzp, int *myfirstp);
+ tol_t *tolstruct, int *nzp, int *myfirstp, int *nclustersp,
+ int *nclusteredp);
+static void balance_chunks(int, int, int, int, double*, int*, int*);
 static int cmpa(const void*, const void*);
 static int init_workQ
-(proc_t *procinfo, in_t *Dstruct, val_t *Wstruct, int *nzp, workQ_t *workQ);
+(proc_t *procinfo, in_t *Dstruct, val_t *Wstruct, tol_t *tolstruct,
+ int *nzp, workQ_t *workQ);
 static void *empty_workQ(void*);
 static workQ_t *create_workQ();
 static void destroy_workQ(workQ_t*);
@@ -71,7 +74,8 @@ static void retrieve_auxarg3
 #ifndef DISABLE_PTHREADS
 int plarrv
 (proc_t *procinfo, in_t *Dstruct, val_t *Wstruct,
- vec_t *Zstruct, tol_t *tolstruct, int *nzp, int *myfirstp)
+ vec_t *Zstruct, tol_t *tolstruct, int *nzp, int *myfirstp,
+ int *nclustersp, int *nclusteredp)
 {
   int     nthreads = procinfo->nthreads;
   int     n        = Dstruct->n;
@@ -88,7 +92,8 @@ int plarrv
   assert(threads != NULL);
 
   /* Assign eigenvectors to processes */
-  assign_to_proc(procinfo, Dstruct, Wstruct, Zstruct, nzp, myfirstp);
+  assign_to_proc(procinfo, Dstruct, Wstruct, Zstruct, tolstruct, 
+		 nzp, myfirstp, nclustersp, nclusteredp);
 
   /* Create work queue Q, counter, threads to empty Q */
   workQ_t *workQ = create_workQ();
@@ -109,7 +114,7 @@ int plarrv
   }
 
   /* Initialize work queue of process */
-  int info = init_workQ(procinfo, Dstruct, Wstruct, nzp, workQ);
+  int info = init_workQ(procinfo, Dstruct, Wstruct, tolstruct, nzp, workQ);
   assert(info == 0);
 
   /* Empty the work queue */
@@ -136,7 +141,8 @@ int plarrv
 #else
 int plarrv
 (proc_t *procinfo, in_t *Dstruct, val_t *Wstruct,
- vec_t *Zstruct, tol_t *tolstruct, int *nzp, int *myfirstp)
+ vec_t *Zstruct, tol_t *tolstruct, int *nzp, int *myfirstp,
+ int *nclustersp, int *nclusteredp)
 {
   int     n  = Dstruct->n;
   double  *W = Wstruct->W;
@@ -149,14 +155,15 @@ int plarrv
   Wstruct->Wshifted = Wshifted;
 
   /* Assign eigenvectors to processes */
-  assign_to_proc(procinfo, Dstruct, Wstruct, Zstruct, nzp, myfirstp);
+  assign_to_proc(procinfo, Dstruct, Wstruct, Zstruct, tolstruct, 
+		 nzp, myfirstp, nclustersp, nclusteredp);
 
   /* Create work queue Q, counter, threads to empty Q */
   workQ_t *workQ = create_workQ();
   counter_t *num_left = PMR_create_counter(*nzp);
 
   /* Initialize work queue of process */
-  int info = init_workQ(procinfo, Dstruct, Wstruct, nzp, workQ);
+  int info = init_workQ(procinfo, Dstruct, Wstruct, tolstruct, nzp, workQ);
   assert(info == 0);
 
   /* Empty the work queue */
@@ -174,13 +181,86 @@ int plarrv
 }
 #endif
 
+/* 
+ * Split the (sorted) eigenvectors ibegin:iend among the processes 
+ * such that the estimated costs are balanced, no process is assigned
+ * more than max_nz eigenvectors, and clusters of the root 
+ * representations are kept within a process where this is cheap;
+ * on output, process id is assigned first[id]:first[id+1]-1
+ */
+static
+void balance_chunks
+(int ibegin, int iend, int nproc, int max_nz, 
+ double *cost, int *cl, int *first)
+{
+  double remaining = 0.0;
+  int j;
+  for (j=ibegin; j<=iend; j++)
+    remaining += cost[j];
+
+  int pos = ibegin;
+  int id;
+  first[0] = ibegin;
+  for (id=0; id<nproc-1; id++) {
+    int rem = iend - pos + 1;
+    int lo  = imax(0, rem - (nproc-id-1)*max_nz);
+    int hi  = imin(rem, max_nz);
+    double target = remaining / (nproc-id);
+
+    /* Largest chunk whose cost does not exceed the target by more 
+     * than half of its last eigenvector */
+    int c = lo;
+    double sum = 0.0;
+    for (j=0; j<c; j++)
+      sum += cost[pos+j];
+    while (c < hi && sum + 0.5*cost[pos+c] <= target) {
+      sum += cost[pos+c];
+      c++;
+    }
+
+    /* Move the boundary to the nearer end of a split cluster unless
+     * this would unbalance the chunk by more than CLUSTER_SPLIT_TOL */
+#define SPLITS(k) ((k) > 0 && (k) < rem && cl[pos+(k)-1] >= 0 && \
+                   cl[pos+(k)-1] == cl[pos+(k)])
+    if (SPLITS(c)) {
+      int a = c, b = c;
+      double suma = sum, sumb = sum;
+      while (a > lo && SPLITS(a)) {
+        a--;
+        suma -= cost[pos+a];
+      }
+      while (b < hi && SPLITS(b)) {
+        sumb += cost[pos+b];
+        b++;
+      }
+      double tol = CLUSTER_SPLIT_TOL*target;
+      bool a_ok = !SPLITS(a) && target-suma <= tol;
+      bool b_ok = !SPLITS(b) && sumb-target <= tol;
+      if (a_ok && (!b_ok || target-suma <= sumb-target)) {
+        c   = a;
+        sum = suma;
+      } else if (b_ok) {
+        c   = b;
+        sum = sumb;
+      }
+    }
+#undef SPLITS
+
+    pos        += c;
+    remaining  -= sum;
+    first[id+1] = pos;
+  }
+  first[nproc] = iend + 1;
+}
+
 /* 
  * Assign the computation of eigenvectors to the processes
  */
 static  
 int assign_to_proc
 (proc_t *procinfo, in_t *Dstruct, val_t *Wstruct,
- vec_t *Zstruct, int *nzp, int *myfirstp)
+ vec_t *Zstruct, tol_t *tolstruct, int *nzp, int *myfirstp,
+ int *nclustersp, int *nclusteredp)
 {
   /* From inputs */
   int              pid     = procinfo->pid;
@@ -191,10 +271,12 @@ int assign_to_proc
   int              il      = *(Wstruct->il);
   int              iu      = *(Wstruct->iu);
   double *restrict W       = Wstruct->W;
+  double *restrict Wgap    = Wstruct->Wgap;
   int    *restrict Windex  = Wstruct->Windex;
   int    *restrict iblock  = Wstruct->iblock;
   int    *restrict iproc   = Wstruct->iproc;
   int    *restrict Zindex  = Zstruct->Zindex;
+  double min_relgap        = tolstruct->min_relgap;
   
   sort_struct_t *array = (sort_struct_t *) malloc(n*sizeof(sort_struct_t));
   
@@ -214,27 +296,74 @@ int assign_to_proc
 
   qsort(array, n, sizeof(sort_struct_t), cmpa);
 
-  /* Mark eigenvectors that do not need to be computed */
+  /* Identify the clusters of the root representations with the same
+   * criterion as used when initializing the work queue */
+  int *clid = (int*)malloc(n*sizeof(int)); assert(clid != NULL);
+  int ncl = 0;
+  for (i=0; i<n; i++)
+    clid[i] = -1;
+  for (i=0; i<n-1; i++) {
+    if (iblock[i] == iblock[i+1] && Wgap[i] < min_relgap*fabs(W[i])) {
+      if (clid[i] == -1)
+        clid[i] = ncl++;
+      clid[i+1] = clid[i];
+    }
+  }
+  double *cost = (double*)malloc(n*sizeof(double)); assert(cost != NULL);
+  int    *cl   = (int*)malloc(n*sizeof(int)); assert(cl != NULL);
+  int    *seen = (int*)calloc(ncl+1, sizeof(int)); assert(seen != NULL);
   int j;
+  *nclustersp = 0;
+  for (j=0; j<n; j++) {
+    cl[j]   = clid[array[j].ind];
+    cost[j] = (cl[j] >= 0 ? CLUSTER_COST : 1.0);
+    if (j >= il-1 && j <= iu-1 && cl[j] >= 0 && !seen[cl[j]]) {
+      seen[cl[j]] = 1;
+      (*nclustersp)++;
+    }
+  }
+
+  /* Mark eigenvectors that do not need to be computed */
   for (j = 0; j < il-1; j++ ) {
     iproc[array[j].ind]  = -1;
     Zindex[array[j].ind] = -1;
   }
 
   int isize = iu - il + 1;
+  int *first = (int*)malloc((nproc+1)*sizeof(int)); assert(first != NULL);
+
+  if (procinfo->balance) {
+    int max_nz = procinfo->max_nz;
+    if (max_nz <= 0)
+      max_nz = 2*iceil(isize,nproc);
+    max_nz = imax(max_nz, iceil(isize,nproc));
+    balance_chunks(il-1, iu-1, nproc, max_nz, cost, cl, first);
+  } else {
+    int ibegin=il-1, iend;
+    int id;
+    for (id=0; id<nproc; id++) {
+
+      int chunk = imax(1, isize/nproc + (id < isize%nproc));
+      
+      if (id==nproc-1) {
+        iend = iu - 1;
+      } else {
+        iend = ibegin + chunk - 1;
+        iend = imin(iend, iu -1);
+      }
+      first[id] = ibegin;
+
+      ibegin = iend + 1;
+      ibegin = imin(ibegin, iu);
+    } /* end id */
+    first[nproc] = iu;
+  }
 
-  int ibegin=il-1, iend;
   int id;
+  *nclusteredp = 0;
   for (id=0; id<nproc; id++) {
-
-    int chunk = imax(1, isize/nproc + (id < isize%nproc));
-    
-    if (id==nproc-1) {
-      iend = iu - 1;
-    } else {
-      iend = ibegin + chunk - 1;
-      iend = imin(iend, iu -1);
-    }
+    int ibegin = first[id];
+    int iend   = imax(first[id+1], ibegin) - 1;
 
     int k = 0;
     for (j=ibegin; j<=iend; j++) {
@@ -247,17 +376,22 @@ int assign_to_proc
       *myfirstp   = ibegin - il + 1;
       *nzp        = iend - ibegin + 1;
       Zstruct->nz = *nzp; 
+      for (j=ibegin; j<=iend; j++)
+        if (cl[j] >= 0)
+          (*nclusteredp)++;
     }
-
-    ibegin = iend + 1;
-    ibegin = imin(ibegin, iu);
   } /* end id */
 
-  for (j = iend+1; j < n; j++ ) {
+  for (j = iu; j < n; j++ ) {
     iproc[array[j].ind]  = -1;
     Zindex[array[j].ind] = -1;
   }
   
+  free(first);
+  free(seen);
+  free(cl);
+  free(cost);
+  free(clid);
   free(array);
   return 0;
 }
@@ -297,7 +431,8 @@ int cmpa(const void *a1, const void *a2)
  */
 static 
 int init_workQ
-(proc_t *procinfo, in_t *Dstruct, val_t *Wstruct, int *nzp, workQ_t *workQ)
+(proc_t *procinfo, in_t *Dstruct, val_t *Wstruct, tol_t *tolstruct,
+ int *nzp, workQ_t *workQ)
 {
   int              pid      = procinfo->pid;
   int              nproc    = procinfo->nproc;
@@ -312,6 +447,7 @@ int init_workQ
   int    *restrict iproc    = Wstruct->iproc;
   double *restrict Wshifted = Wstruct->Wshifted;
   double *restrict gersch   = Wstruct->gersch;
+  double           min_relgap = tolstruct->min_relgap;
   int              nz       = *nzp;
 
   /* Loop over blocks */
@@ -388,7 +524,7 @@ int init_workQ
     for (i=ibegin; i<=iend; i++) {
       if (i == iend)
         new_last = i;
-      else if (Wgap[i] >= MIN_RELGAP*fabs(Wshifted[i]))
+      else if (Wgap[i] >= min_relgap*fabs(Wshifted[i]))
         new_last = i;
       else
         continue;
@@ -421,7 +557,7 @@ int init_workQ
 
         /* Insert task if ... */
         if (i==iWend || sn_size>=max_size ||
-            Wgap[i+1] < MIN_RELGAP*fabs(Wshifted[i+1])) {
+            Wgap[i+1] < min_relgap*fabs(Wshifted[i+1])) {
 
           double lgap;
           if (sn_first == ibegin) {
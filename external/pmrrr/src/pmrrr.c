@@ -80,6 +80,17 @@ int pmrrr
  double *E, double *vl, double *vu, int *il,
  int *iu, int *tryracp, MPI_Comm comm, int *nzp,
  int *offsetp, double *W, double *Z, int *ldz, int *Zsupp)
+{
+  return pmrrr_ctrl(jobz, range, np, D, E, vl, vu, il, iu, tryracp,
+		    comm, nzp, offsetp, W, Z, ldz, Zsupp, NULL, NULL);
+}
+
+int pmrrr_ctrl
+(char *jobz, char *range, int *np, double  *D,
+ double *E, double *vl, double *vu, int *il,
+ int *iu, int *tryracp, MPI_Comm comm, int *nzp,
+ int *offsetp, double *W, double *Z, int *ldz, int *Zsupp,
+ const pmrrr_params_t *params, pmrrr_stats_t *stats)
 {
   /* Input parameter */
   int  n      = *np;
@@ -90,6 +101,11 @@ int pmrrr
   bool valeig = toupper(range[0]) == 'V';
   bool indeig = toupper(range[0]) == 'I';
 
+  pmrrr_stats_t stats_dummy;
+  if (stats == NULL) stats = &stats_dummy;
+  memset(stats, 0, sizeof(pmrrr_stats_t));
+  stats->nthreads = 1;
+
   /* Check input parameters */
   if(!(onlyW  || wantZ  || cntval)) return 1;
   if(!(alleig || valeig || indeig)) return 1;
@@ -123,6 +139,8 @@ int pmrrr
      * MPI_THREAD_SERIALIZED the code must be changed slightly; this 
      * is not supported at the moment */
     nthreads = 1;
+  } else if (params != NULL && params->nthreads > 0) {
+    nthreads = params->nthreads;
   } else {
     char *ompvar = getenv("PMR_NUM_THREADS");
     if (ompvar == NULL) {
@@ -147,6 +165,11 @@ int pmrrr
     }
   }
 #endif
+  stats->nthreads = nthreads;
+
+  double min_relgap = MIN_RELGAP;
+  if (params != NULL && params->min_relgap > 0.0)
+    min_relgap = params->min_relgap;
 
   /* If only maximal number of local eigenvectors are queried
    * return if possible here */
@@ -195,6 +218,8 @@ int pmrrr
   procinfo->comm           = comm_dup;
   procinfo->nthreads       = nthreads;
   procinfo->thread_support = thread_support;
+  procinfo->balance        = (params != NULL ? params->balance : 0);
+  procinfo->max_nz         = (params != NULL ? params->max_nz : 0);
 
   Dstruct->n      = n;
   Dstruct->D      = D;
@@ -220,6 +245,8 @@ int pmrrr
   Zstruct->Zsupp  = Zsupp;
   Zstruct->Zindex = Zindex;
 
+  tolstruct->min_relgap = min_relgap;
+
   /* Scale matrix to allowable range, returns 1.0 if not scaled */
   double scale = scale_matrix(Dstruct, Wstruct, valeig);
 
@@ -253,15 +280,17 @@ int pmrrr
   } else {
     /* Do not compute to full accuracy first, but refine later */
     tolstruct->rtol1 = sqrt(DBL_EPSILON);
-    tolstruct->rtol1 = fmin(1e-2*MIN_RELGAP, tolstruct->rtol1);
+    tolstruct->rtol1 = fmin(1e-2*min_relgap, tolstruct->rtol1);
     tolstruct->rtol2 = sqrt(DBL_EPSILON)*5.0E-3;
-    tolstruct->rtol2 = fmin(5e-6*MIN_RELGAP, tolstruct->rtol2);
+    tolstruct->rtol2 = fmin(5e-6*min_relgap, tolstruct->rtol2);
     tolstruct->rtol2 = fmax(4.0 * DBL_EPSILON, tolstruct->rtol2);
   }
 
   /*  Compute all eigenvalues: sorted by block */
+  double t0 = MPI_Wtime();
   info = plarre(procinfo,jobz,range,Dstruct,Wstruct,tolstruct,nzp,offsetp);
   assert(info == 0);
+  stats->time_vals = MPI_Wtime() - t0;
 
   /* If just number of local eigenvectors are queried */
   if (cntval & valeig) {    
@@ -276,10 +305,12 @@ int pmrrr
 
     /* Refine to high relative with respect to input T */
     if (*tryracp) {
+      t0 = MPI_Wtime();
       info = 
         refine_to_highrac
         (procinfo, jobz, Dcopy, E2copy, Dstruct, nzp, Wstruct, tolstruct);
       assert(info == 0);
+      stats->time_refine = MPI_Wtime() - t0;
     }
 
     /* Sort eigenvalues */
@@ -324,15 +355,19 @@ int pmrrr
   } /* end of only eigenvalues to compute */
 
   /* Compute eigenvectors */
+  t0 = MPI_Wtime();
   info = plarrv(procinfo, Dstruct, Wstruct, Zstruct, tolstruct, 
-		nzp, offsetp);
+		nzp, offsetp, &stats->num_clusters, &stats->num_clustered);
   assert(info == 0);
+  stats->time_vecs = MPI_Wtime() - t0;
 
   /* Refine to high relative with respect to input matrix */
   if (*tryracp) {
+    t0 = MPI_Wtime();
     info = refine_to_highrac(procinfo, jobz, Dcopy, E2copy, 
 			     Dstruct, nzp, Wstruct, tolstruct);
     assert(info == 0);
+    stats->time_refine = MPI_Wtime() - t0;
   }
 
   /* If matrix was scaled, rescale eigenvalues */
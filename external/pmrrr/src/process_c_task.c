@@ -76,7 +76,7 @@ static inline
 int create_subtasks
 (cluster_t *cl, int tid, proc_t *procinfo,
  rrr_t *RRR, val_t *Wstruct, vec_t *Zstruct,
- workQ_t *workQ, counter_t *num_left);
+ tol_t *tolstruct, workQ_t *workQ, counter_t *num_left);
 
 int PMR_process_c_task
 (cluster_t *cl, int tid, proc_t *procinfo,
@@ -99,7 +99,8 @@ int PMR_process_c_task
     status = test_comm_status(cl, Wstruct);
     if (status == COMM_COMPLETE) {
       create_subtasks
-      (cl, tid, procinfo, cl->RRR, Wstruct, Zstruct, workQ, num_left);
+      (cl, tid, procinfo, cl->RRR, Wstruct, Zstruct, tolstruct, workQ,
+       num_left);
       return C_TASK_PROCESSED;
     } else {
       return C_TASK_NOT_PROCESSED;
@@ -134,7 +135,8 @@ int PMR_process_c_task
   }
 
   if (status == COMM_COMPLETE) {
-    create_subtasks(cl, tid, procinfo, RRR, Wstruct, Zstruct, workQ, num_left);
+    create_subtasks
+    (cl, tid, procinfo, RRR, Wstruct, Zstruct, tolstruct, workQ, num_left);
     return C_TASK_PROCESSED;
   } else {
     return C_TASK_NOT_PROCESSED;
@@ -311,20 +313,26 @@ int refine_eigvals
     int num_tasks   = iceil(rf_size, own_part) - 1; /* >1 */
     int chunk       = others_part/num_tasks;        /* floor */
 
+    /* The created tasks signal their completion through a single
+     * semaphore owned by this routine */
+    refine_t barrier;
+    PMR_refine_sem_init(&barrier);
+
     int ts_begin=rf_begin, ts_end;
     p = Windex[rf_begin];
     for (i=0; i<num_tasks; i++) {
       ts_end = ts_begin + chunk - 1;
       q      = p        + chunk - 1;
 
-      task = 
-        PMR_create_r_task
-        (ts_begin, ts_end, D, DLL, p, q, bl_size, bl_spdiam, tid);
-     
-      if (ts_begin <= ts_end)
+      if (ts_begin <= ts_end) {
+        task = 
+          PMR_create_r_task
+          (ts_begin, ts_end, D, DLL, p, q, bl_size, bl_spdiam, tid,
+           &barrier);
 	PMR_insert_task_at_back(workQ->r_queue, task);
-      else
-        PMR_refine_sem_post(task->data); /* case chunk=0 */
+      } else {
+        PMR_refine_sem_post(&barrier); /* case chunk=0 */
+      }
 
       ts_begin = ts_end + 1;
       p        = q      + 1;
@@ -361,10 +369,10 @@ int refine_eigvals
     /* Barrier: wait until all created tasks finished */
     int count = num_tasks;
     while (count > 0) {
-      while ( PMR_refine_sem_wait(task->data) != 0 ) { };
+      while ( PMR_refine_sem_wait(&barrier) != 0 ) { };
       count--;
     }
-    PMR_refine_sem_destroy(task->data);
+    PMR_refine_sem_destroy(&barrier);
 
     /* Edit right gap at splitting point */
     ts_begin = rf_begin;
@@ -598,7 +606,7 @@ static inline
 int create_subtasks
 (cluster_t *cl, int tid, proc_t *procinfo, 
  rrr_t *RRR, val_t *Wstruct, vec_t *Zstruct,
- workQ_t *workQ, counter_t *num_left)
+ tol_t *tolstruct, workQ_t *workQ, counter_t *num_left)
 {
   /* From inputs */
   int              cl_begin  = cl->begin;
@@ -608,6 +616,7 @@ int create_subtasks
   int              bl_end    = cl->bl_end;
   int              bl_size   = bl_end - bl_begin + 1;
   double           bl_spdiam = cl->bl_spdiam;
+  double           min_relgap = tolstruct->min_relgap;
   double           lgap;
 
   int  pid       = procinfo->pid;
@@ -646,7 +655,7 @@ int create_subtasks
 
     if ( i == cl_end )
       new_last = i;
-    else if ( Wgap[i] >= MIN_RELGAP*fabs(Wshifted[i]) )
+    else if ( Wgap[i] >= min_relgap*fabs(Wshifted[i]) )
       new_last = i;
     else
       continue;
@@ -669,7 +678,7 @@ int create_subtasks
       
       /* insert task if ... */
       if (i==cl_end || sn_size>=max_size ||
-	    Wgap[i+1] < MIN_RELGAP*fabs(Wshifted[i+1])) {
+	    Wgap[i+1] < min_relgap*fabs(Wshifted[i+1])) {
 
 	/* Check if process involved in s-task */
 	proc_involved = false;
@@ -63,11 +63,43 @@ void Copy( const Matrix<S>& A, Matrix<T>& B )
     EntrywiseMap( A, B, MakeFunction(Caster<S,T>::Cast) );
 }
 
+namespace copy {
+
+// The number of bytes of B's local matrix which this process does not already
+// own as part of A (and which must therefore be received during the
+// redistribution). The local entries of both matrices form Cartesian
+// products of their local rows and columns, so only the intersections of the
+// local row and column sets need to be counted.
+template<typename T>
+double RedistributedBytes
+( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B )
+{
+    const Int localHeight = B.LocalHeight();
+    const Int localWidth = B.LocalWidth();
+    Int sharedHeight=0, sharedWidth=0;
+    if( A.Participating() )
+    {
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            if( A.IsLocalRow(B.GlobalRow(iLoc)) )
+                ++sharedHeight;
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            if( A.IsLocalCol(B.GlobalCol(jLoc)) )
+                ++sharedWidth;
+    }
+    return ( double(localHeight)*localWidth -
+             double(sharedHeight)*sharedWidth )*sizeof(T);
+}
+
+} // namespace copy
+
 template<typename T,Dist U,Dist V>
 void Copy( const ElementalMatrix<T>& A, DistMatrix<T,U,V>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Copy")
     B = A;
+    if( ProfilingEnabled() )
+        ProfileBytes( copy::RedistributedBytes( A, B ) );
 }
 
 // Datatype conversions should not be very common, and so it is likely best to
@@ -103,7 +135,10 @@ template<typename T,Dist U,Dist V>
 void Copy( const BlockMatrix<T>& A, DistMatrix<T,U,V,BLOCK>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Copy")
     B = A;
+    if( ProfilingEnabled() )
+        ProfileBytes( copy::RedistributedBytes( A, B ) );
 }
 
 // Datatype conversions should not be very common, and so it is likely best to
@@ -50,6 +50,28 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                     B.Matrix() = A.LockedMatrix();
                 El::Broadcast( B, A.ColComm(), A.ColAlign() );
             }
+            else if( IsPacked<T>::value && DerivedDatatypesEnabled() &&
+                     B.LDim()*B.LocalWidth() <=
+                     Int(limits::Max<int>()/sizeof(T)) )
+            {
+                // Gather directly into the interleaved rows of B (whose byte
+                // offsets must fit in an int for MPI_Alltoallw)
+                const int colStride = A.ColStride();
+                vector<int> heights(colStride),
+                            widths(colStride,A.LocalWidth()),
+                            rowOffs(colStride),
+                            colOffs(colStride,0);
+                for( int q=0; q<colStride; ++q )
+                {
+                    rowOffs[q] = Shift( q, A.ColAlign(), colStride );
+                    heights[q] = Length( height, rowOffs[q], colStride );
+                }
+                mpi::StridedAllGather
+                ( A.LockedBuffer(), A.LocalHeight(), A.LocalWidth(), A.LDim(),
+                  B.Buffer(), B.LDim(), colStride, 1,
+                  heights.data(), widths.data(),
+                  rowOffs.data(), colOffs.data(), A.ColComm() );
+            }
             else
             {
                 const Int colStride = A.ColStride();
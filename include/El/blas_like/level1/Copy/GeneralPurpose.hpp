@@ -12,12 +12,200 @@
 namespace El {
 namespace copy {
 
+// Compute the destination of each local entry of A, and exchange the local
+// indices within B of each remotely-owned entry, exactly once
+template<typename S,typename T>
+RedistPlan BuildRedistPlan
+( const AbstractDistMatrix<S>& A,
+  const AbstractDistMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    const Grid& g = B.Grid();
+    const bool BPartic = B.Participating();
+    const int BRoot = B.Root();
+    const int redundantRootB = 0;
+
+    RedistPlan plan;
+    plan.includeViewers = (A.Grid() != B.Grid());
+    mpi::Comm comm = ( plan.includeViewers ? g.ViewingComm() : g.VCComm() );
+    const int commSize = mpi::Size( comm );
+
+    const int distBSize = mpi::Size( B.DistComm() );
+    vector<int> distBToComm(distBSize);
+    for( int distBRank=0; distBRank<distBSize; ++distBRank )
+    {
+        const int vcOwner =
+          g.CoordsToVC
+          (B.ColDist(),B.RowDist(),distBRank,BRoot,redundantRootB);
+        distBToComm[distBRank] =
+          ( plan.includeViewers ? g.VCToViewing(vcOwner) : vcOwner );
+    }
+
+    vector<Int> sourceRows, sourceCols, targetRows, targetCols;
+    vector<int> owners;
+    if( A.RedundantRank() == 0 )
+    {
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        const bool noRedundant = B.RedundantSize() == 1;
+        const int colStride = B.ColStride();
+        const int rowRank = B.RowRank();
+        const int colRank = B.ColRank();
+
+        vector<Int> localRows(localHeight);
+        vector<int> ownerRows(localHeight);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            ownerRows[iLoc] = B.RowOwner(i);
+            localRows[iLoc] = B.LocalRow(i,ownerRows[iLoc]);
+        }
+
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            const int ownerCol = B.ColOwner(j);
+            const Int localCol = B.LocalCol(j,ownerCol);
+            const bool isLocalCol = ( BPartic && ownerCol == rowRank );
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const int ownerRow = ownerRows[iLoc];
+                const bool isLocalRow = ( BPartic && ownerRow == colRank );
+                if( noRedundant && isLocalRow && isLocalCol )
+                {
+                    plan.localSourceRows.push_back( iLoc );
+                    plan.localSourceCols.push_back( jLoc );
+                    plan.localTargetRows.push_back( localRows[iLoc] );
+                    plan.localTargetCols.push_back( localCol );
+                }
+                else
+                {
+                    sourceRows.push_back( iLoc );
+                    sourceCols.push_back( jLoc );
+                    targetRows.push_back( localRows[iLoc] );
+                    targetCols.push_back( localCol );
+                    owners.push_back
+                    ( distBToComm[ownerRow+colStride*ownerCol] );
+                }
+            }
+        }
+    }
+
+    // Order the remote entries by their owners
+    const Int totalSend = owners.size();
+    plan.sendCounts.resize( commSize, 0 );
+    for( Int k=0; k<totalSend; ++k )
+        ++plan.sendCounts[owners[k]];
+    Scan( plan.sendCounts, plan.sendOffs );
+    plan.sendRows.resize( totalSend );
+    plan.sendCols.resize( totalSend );
+    vector<Int> sendTargets(2*totalSend);
+    auto offs = plan.sendOffs;
+    for( Int k=0; k<totalSend; ++k )
+    {
+        const Int slot = offs[owners[k]]++;
+        plan.sendRows[slot] = sourceRows[k];
+        plan.sendCols[slot] = sourceCols[k];
+        sendTargets[2*slot  ] = targetRows[k];
+        sendTargets[2*slot+1] = targetCols[k];
+    }
+
+    // Exchange the target locations
+    plan.recvCounts.resize( commSize );
+    mpi::AllToAll
+    ( plan.sendCounts.data(), 1, plan.recvCounts.data(), 1, comm );
+    const Int totalRecv = Scan( plan.recvCounts, plan.recvOffs );
+    vector<int> sendIndexCounts(commSize), sendIndexOffs(commSize),
+                recvIndexCounts(commSize), recvIndexOffs(commSize);
+    for( int q=0; q<commSize; ++q )
+    {
+        sendIndexCounts[q] = 2*plan.sendCounts[q];
+        sendIndexOffs[q] = 2*plan.sendOffs[q];
+        recvIndexCounts[q] = 2*plan.recvCounts[q];
+        recvIndexOffs[q] = 2*plan.recvOffs[q];
+    }
+    vector<Int> recvTargets(2*totalRecv);
+    mpi::AllToAll
+    ( sendTargets.data(), sendIndexCounts.data(), sendIndexOffs.data(),
+      recvTargets.data(), recvIndexCounts.data(), recvIndexOffs.data(),
+      comm );
+    plan.recvRows.resize( totalRecv );
+    plan.recvCols.resize( totalRecv );
+    for( Int k=0; k<totalRecv; ++k )
+    {
+        plan.recvRows[k] = recvTargets[2*k  ];
+        plan.recvCols[k] = recvTargets[2*k+1];
+    }
+    return plan;
+}
+
+// Since the plan determines where each entry is sent, only the values of
+// the entries (rather than their locations) need to be transmitted
+template<typename S,typename T>
+void PlannedHelper
+( const AbstractDistMatrix<S>& A,
+        AbstractDistMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Grid& g = B.Grid();
+    B.Resize( height, width );
+    Zero( B );
+    const bool includeViewers = (A.Grid() != B.Grid());
+    if( !includeViewers && !g.InGrid() )
+        return;
+
+    const DistData AData(A), BData(B);
+    const RedistPlan* planPtr = FindRedistPlan( AData, BData, height, width );
+    if( planPtr == nullptr )
+        planPtr =
+          &StoreRedistPlan
+          ( AData, BData, height, width, BuildRedistPlan( A, B ) );
+    const RedistPlan& plan = *planPtr;
+    mpi::Comm comm = ( includeViewers ? g.ViewingComm() : g.VCComm() );
+
+    auto& ALoc = A.LockedMatrix();
+    auto& BLoc = B.Matrix();
+    const Int numLocal = plan.localSourceRows.size();
+    for( Int k=0; k<numLocal; ++k )
+        BLoc(plan.localTargetRows[k],plan.localTargetCols[k]) =
+          Caster<S,T>::Cast
+          (ALoc(plan.localSourceRows[k],plan.localSourceCols[k]));
+
+    const Int totalSend = plan.sendRows.size();
+    const Int totalRecv = plan.recvRows.size();
+    vector<S> sendBuf, recvBuf;
+    FastResize( sendBuf, totalSend );
+    FastResize( recvBuf, totalRecv );
+    for( Int k=0; k<totalSend; ++k )
+        sendBuf[k] = ALoc(plan.sendRows[k],plan.sendCols[k]);
+    mpi::AllToAll
+    ( sendBuf.data(), plan.sendCounts.data(), plan.sendOffs.data(),
+      recvBuf.data(), plan.recvCounts.data(), plan.recvOffs.data(), comm );
+    if( B.Participating() )
+    {
+        if( B.RedundantRank() == 0 )
+        {
+            for( Int k=0; k<totalRecv; ++k )
+                BLoc(plan.recvRows[k],plan.recvCols[k]) =
+                  Caster<S,T>::Cast(recvBuf[k]);
+        }
+        El::Broadcast( B, B.RedundantComm(), 0 );
+    }
+}
+
 template<typename S,typename T,typename=EnableIf<CanCast<S,T>>>
 void Helper
 ( const AbstractDistMatrix<S>& A,
         AbstractDistMatrix<T>& B )
 {
     EL_DEBUG_CSE
+    if( RedistPlansEnabled() )
+    {
+        PlannedHelper( A, B );
+        return;
+    }
 
     // TODO: Decide whether S or T should be used as the transmission type
     //       based upon which is smaller. Transmit S by default.
@@ -43,6 +43,28 @@ void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 mpi::Broadcast
                 ( B.Buffer(), B.LocalHeight(), A.RowAlign(), A.RowComm() );
             }
+            else if( IsPacked<T>::value && DerivedDatatypesEnabled() &&
+                     B.LDim()*B.LocalWidth() <=
+                     Int(limits::Max<int>()/sizeof(T)) )
+            {
+                // Gather directly into the interleaved columns of B (whose byte
+                // offsets must fit in an int for MPI_Alltoallw)
+                const int rowStride = A.RowStride();
+                vector<int> heights(rowStride,A.LocalHeight()),
+                            widths(rowStride),
+                            rowOffs(rowStride,0),
+                            colOffs(rowStride);
+                for( int q=0; q<rowStride; ++q )
+                {
+                    colOffs[q] = Shift( q, A.RowAlign(), rowStride );
+                    widths[q] = Length( width, colOffs[q], rowStride );
+                }
+                mpi::StridedAllGather
+                ( A.LockedBuffer(), A.LocalHeight(), A.LocalWidth(), A.LDim(),
+                  B.Buffer(), B.LDim(), 1, rowStride,
+                  heights.data(), widths.data(),
+                  rowOffs.data(), colOffs.data(), A.RowComm() );
+            }
             else
             {
                 const Int rowStride = A.RowStride();
@@ -22,6 +22,28 @@ void GeneralPurpose
 ( const AbstractDistMatrix<T>& A,
         AbstractDistMatrix<T>& B );
 
+// The precomputed index maps of a general-purpose redistribution
+struct RedistPlan
+{
+    bool includeViewers;
+    // The local entries of A which are directly copied into B
+    vector<Int> localSourceRows, localSourceCols;
+    vector<Int> localTargetRows, localTargetCols;
+    // The local entries of A in the order in which they are packed
+    vector<Int> sendRows, sendCols;
+    vector<int> sendCounts, sendOffs;
+    // The local locations in B of the received entries
+    vector<Int> recvRows, recvCols;
+    vector<int> recvCounts, recvOffs;
+};
+
+// Returns nullptr if there is no plan for the given key
+const RedistPlan* FindRedistPlan
+( const DistData& A, const DistData& B, Int height, Int width );
+const RedistPlan& StoreRedistPlan
+( const DistData& A, const DistData& B, Int height, Int width,
+  RedistPlan&& plan );
+
 template<typename T>
 void Exchange
 ( const ElementalMatrix<T>& A,
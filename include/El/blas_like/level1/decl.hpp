@@ -504,6 +504,34 @@ template<typename S,typename T,
          typename=EnableIf<CanCast<S,T>>>
 void Copy( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B );
 
+// The general-purpose redistributions (e.g., between block and elemental
+// distributions, or between grids) may cache a communication plan keyed on
+// the distributions, alignments, and grids of the source and target, as well
+// as the matrix dimensions. Building a plan requires one extra exchange of
+// the local indices, after which redistributions with the same key only
+// transmit the matrix entries. At most 'maxPlans' plans are retained, with
+// the oldest evicted first.
+//
+// NOTE: Plans are built and evicted collectively, so all processes must
+//       enable plans at the same point.
+class Grid;
+void EnableRedistPlans( Int maxPlans=64 );
+void DisableRedistPlans();
+bool RedistPlansEnabled();
+// Invalidate all plans, or only those involving the given grid (which is
+// performed automatically when the grid is destroyed)
+void ClearRedistPlans();
+void ClearRedistPlans( const Grid& grid );
+
+// The aligned column and row AllGather redistributions (e.g., [MC,MR] to
+// [MC,* ] or [* ,MR]) may describe the strided local matrices with MPI
+// derived datatypes so that the collective reads from and writes to the local
+// matrices directly rather than packing and unpacking contiguous buffers.
+// This only affects packed datatypes.
+void EnableDerivedDatatypes();
+void DisableDerivedDatatypes();
+bool DerivedDatatypesEnabled();
+
 template<typename T>
 void CopyFromRoot
 ( const Matrix<T>& A, DistMatrix<T,CIRC,CIRC>& B,
@@ -31,6 +31,10 @@ struct DistGraphMultMeta
     vector<int> sendSizes, sendOffs,
                 recvSizes, recvOffs;
     vector<Int> sendInds, colOffs;
+    // A compressed-column mirror of the local edges (with the targets
+    // indexed by 'colOffs'), which is built upon the first threaded
+    // transposed multiplication
+    GraphTransposeMeta localTranspose;
 
     DistGraphMultMeta() : ready(false), numRecvInds(0) { }
 
@@ -44,6 +48,7 @@ struct DistGraphMultMeta
         SwapClear( recvOffs );
         SwapClear( sendInds );
         SwapClear( colOffs );
+        localTranspose.Clear();
     }
 
     const DistGraphMultMeta& operator=( const DistGraphMultMeta& meta )
@@ -56,6 +61,7 @@ struct DistGraphMultMeta
         recvOffs = meta.recvOffs;
         sendInds = meta.sendInds;
         colOffs = meta.colOffs;
+        localTranspose = meta.localTranspose;
         return *this;
     }
 };
@@ -184,7 +190,7 @@ public:
     double Imbalance() const EL_NO_RELEASE_EXCEPT;
 
     mutable DistGraphMultMeta multMeta;
-    DistGraphMultMeta InitializeMultMeta() const;
+    const DistGraphMultMeta& InitializeMultMeta() const;
 
     void AssertConsistent() const;
     void AssertLocallyConsistent() const;
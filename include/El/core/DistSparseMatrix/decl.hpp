@@ -168,7 +168,7 @@ public:
     // total number of nonzeros divided by the number of processes
     double Imbalance() const EL_NO_RELEASE_EXCEPT;
 
-    DistGraphMultMeta InitializeMultMeta() const;
+    const DistGraphMultMeta& InitializeMultMeta() const;
 
     void MappedSources
     ( const DistMap& reordering, vector<Int>& mappedSources ) const;
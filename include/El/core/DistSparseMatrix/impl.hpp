@@ -727,7 +727,8 @@ void DistSparseMatrix<Ring>::AssertLocallyConsistent() const
         LogicError("Distributed sparse matrix must be consistent");
 }
 template<typename Ring>
-DistGraphMultMeta DistSparseMatrix<Ring>::InitializeMultMeta() const
+const DistGraphMultMeta&
+DistSparseMatrix<Ring>::InitializeMultMeta() const
 {
     EL_DEBUG_CSE
     return distGraph_.InitializeMultMeta();
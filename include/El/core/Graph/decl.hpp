@@ -32,6 +32,52 @@ class SparseMatrix;
 template<typename T>
 class DistSparseMatrix;
 
+// A compressed-column mirror of a graph, which allows transposed
+// multiplications to gather into each target rather than scatter, so that
+// the targets may be updated concurrently
+struct GraphTransposeMeta
+{
+    bool ready=false;
+    // The offsets of each target's edges within the mirror, the source of each
+    // edge of the mirror, and the index of each such edge within the original
+    // (source-major) ordering
+    vector<Int> targetOffsets, sources, edges;
+
+    void Clear()
+    {
+        ready = false;
+        SwapClear( targetOffsets );
+        SwapClear( sources );
+        SwapClear( edges );
+    }
+
+    void Initialize
+    ( Int numSources, Int numTargets,
+      const Int* sourceOffsets, const Int* targets )
+    {
+        const Int numEdges = sourceOffsets[numSources] - sourceOffsets[0];
+        targetOffsets.assign( numTargets+1, 0 );
+        for( Int e=sourceOffsets[0]; e<sourceOffsets[numSources]; ++e )
+            ++targetOffsets[targets[e]+1];
+        for( Int t=0; t<numTargets; ++t )
+            targetOffsets[t+1] += targetOffsets[t];
+
+        sources.resize( numEdges );
+        edges.resize( numEdges );
+        vector<Int> offsets( targetOffsets.begin(), targetOffsets.end()-1 );
+        for( Int s=0; s<numSources; ++s )
+        {
+            for( Int e=sourceOffsets[s]; e<sourceOffsets[s+1]; ++e )
+            {
+                const Int k = offsets[targets[e]]++;
+                sources[k] = s;
+                edges[k] = e;
+            }
+        }
+        ready = true;
+    }
+};
+
 class Graph
 {
 public:
@@ -116,12 +162,19 @@ public:
 
     void AssertConsistent() const;
 
+    // Return the compressed-column mirror, building it if necessary
+    const GraphTransposeMeta& InitializeTransposeMeta() const;
+
 private:
     Int numSources_, numTargets_;
     bool frozenSparsity_ = false;
     vector<Int> sources_, targets_;
     set<pair<Int,Int>> markedForRemoval_;
 
+    // The compressed-column mirror is built upon request and discarded
+    // whenever the edges are (potentially) modified
+    mutable GraphTransposeMeta transposeMeta_;
+
     // Helpers for local indexing
     bool consistent_=true;
     vector<Int> sourceOffsets_;
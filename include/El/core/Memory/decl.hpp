@@ -11,10 +11,80 @@
 
 namespace El {
 
+// Memory pooling
+// ==============
+// When enabled, every Memory<G> buffer is 64-byte aligned and drawn from a
+// process-wide pool of free lists bucketed by size class (four classes per
+// power of two), so that buffers released by one Memory<G> object are reused
+// by subsequent Require calls rather than being returned to the system.
+//
+// Allocation sites are labeled via a stack of names which the caller is
+// responsible for maintaining, e.g.,
+//
+//   PushAllocationSite("LU panel");
+//   ...
+//   PopAllocationSite();
+
+const size_t memoryAlignment = 64;
+
+struct MemoryStats
+{
+    size_t numRequests=0;
+    size_t numPoolHits=0;
+    size_t numBytesInUse=0;
+    size_t peakBytesInUse=0;
+    size_t numBytesCached=0;
+    std::map<string,size_t> requestsPerSite;
+
+    double HitRate() const
+    { return numRequests==0 ? 0. : double(numPoolHits)/double(numRequests); }
+};
+
+void EnableMemoryPool();
+void DisableMemoryPool();
+bool MemoryPoolEnabled();
+
+// Return all of the cached buffers to the system
+void ClearMemoryPool();
+
+// Cached buffers beyond this number of bytes are returned to the system
+// (the default is to never do so)
+void SetMemoryPoolCacheLimit( size_t numBytes );
+
+// Label the pooled allocations made until the matching pop
+void PushAllocationSite( string site );
+void PopAllocationSite();
+
+// Scoped allocation sites; the constructor and destructor only test a flag
+// when the pool is disabled
+class AllocationSite
+{
+public:
+    explicit AllocationSite( const char* site );
+    ~AllocationSite();
+private:
+    bool active_;
+};
+
+MemoryStats GetMemoryStats();
+void ResetMemoryStats();
+void PrintMemoryStats( ostream& os=cout );
+
+namespace memory {
+
+// Returns a 64-byte aligned buffer of at least 'numBytes' bytes and sets
+// 'capacity' to the size of the corresponding size class
+void* PooledAllocate( size_t numBytes, size_t& capacity );
+void PooledFree( void* buffer, size_t capacity );
+
+} // namespace memory
+
 template<typename G>
 class Memory
 {
     size_t size_;
+    size_t capacity_;
+    bool pooled_;
     G* rawBuffer_;
     G* buffer_;
 public:
@@ -38,4 +108,6 @@ public:
 
 } // namespace El
 
+#define EL_ALLOCATION_SITE(site) El::AllocationSite elAllocationSite(site);
+
 #endif // ifndef EL_MEMORY_DECL_HPP
@@ -11,16 +11,59 @@ namespace El {
 
 namespace {
 
+template<typename G,typename=EnableIf<IsPacked<G>>>
+static void Construct( G* buffer, size_t size )
+{ }
+
+template<typename G,typename=DisableIf<IsPacked<G>>,typename=void>
+static void Construct( G* buffer, size_t size )
+{
+    for( size_t i=0; i<size; ++i )
+        new (&buffer[i]) G;
+}
+
+template<typename G,typename=EnableIf<IsPacked<G>>>
+static void Destruct( G* buffer, size_t size )
+{ }
+
+template<typename G,typename=DisableIf<IsPacked<G>>,typename=void>
+static void Destruct( G* buffer, size_t size )
+{
+    for( size_t i=0; i<size; ++i )
+        buffer[i].~G();
+}
+
 template<typename G>
-static G* New( size_t size )
+static G* New( size_t size, size_t& capacity, bool& pooled )
 {
-    return new G[size];
+    pooled = MemoryPoolEnabled();
+    if( pooled )
+    {
+        G* ptr =
+          static_cast<G*>(memory::PooledAllocate( size*sizeof(G), capacity ));
+        Construct( ptr, size );
+        return ptr;
+    }
+    else
+    {
+        capacity = size*sizeof(G);
+        return new G[size];
+    }
 }
 
 template<typename G>
-static void Delete( G*& ptr )
+static void Delete( G*& ptr, size_t size, size_t capacity, bool pooled )
 {
-    delete[] ptr;
+    if( pooled )
+    {
+        if( ptr != nullptr )
+        {
+            Destruct( ptr, size );
+            memory::PooledFree( ptr, capacity );
+        }
+    }
+    else
+        delete[] ptr;
     ptr = nullptr;
 }
 
@@ -28,17 +71,17 @@ static void Delete( G*& ptr )
 
 template<typename G>
 Memory<G>::Memory()
-: size_(0), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), capacity_(0), pooled_(false), rawBuffer_(nullptr), buffer_(nullptr)
 { }
 
 template<typename G>
 Memory<G>::Memory( size_t size )
-: size_(0), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), capacity_(0), pooled_(false), rawBuffer_(nullptr), buffer_(nullptr)
 { Require( size ); }
 
 template<typename G>
 Memory<G>::Memory( Memory<G>&& mem )
-: size_(mem.size_), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), capacity_(0), pooled_(false), rawBuffer_(nullptr), buffer_(nullptr)
 { ShallowSwap(mem); }
 
 template<typename G>
@@ -49,6 +92,8 @@ template<typename G>
 void Memory<G>::ShallowSwap( Memory<G>& mem )
 {
     std::swap(size_,mem.size_);
+    std::swap(capacity_,mem.capacity_);
+    std::swap(pooled_,mem.pooled_);
     std::swap(rawBuffer_,mem.rawBuffer_);
     std::swap(buffer_,mem.buffer_);
 }
@@ -56,7 +101,7 @@ void Memory<G>::ShallowSwap( Memory<G>& mem )
 template<typename G>
 Memory<G>::~Memory() 
 { 
-    Delete( rawBuffer_ );
+    Delete( rawBuffer_, size_, capacity_, pooled_ );
 }
 
 template<typename G>
@@ -70,14 +115,14 @@ G* Memory<G>::Require( size_t size )
 {
     if( size > size_ )
     {
-        Delete( rawBuffer_ );
+        Delete( rawBuffer_, size_, capacity_, pooled_ );
 
 #ifndef EL_RELEASE
         try {
 #endif
 
-            // TODO: Optionally overallocate to force alignment of buffer_
-            rawBuffer_ = New<G>( size );
+            // NOTE: Pooled buffers are aligned to 'memoryAlignment' bytes
+            rawBuffer_ = New<G>( size, capacity_, pooled_ );
             buffer_ = rawBuffer_;
 
             size_ = size;
@@ -86,6 +131,7 @@ G* Memory<G>::Require( size_t size )
         catch( std::bad_alloc& e )
         {
             size_ = 0;
+            capacity_ = 0;
             ostringstream os;
             os << "Failed to allocate " << size*sizeof(G) 
                << " bytes on process " << mpi::Rank() << endl;
@@ -110,9 +156,10 @@ void Memory<G>::Release()
 template<typename G>
 void Memory<G>::Empty()
 {
-    Delete( rawBuffer_ );
+    Delete( rawBuffer_, size_, capacity_, pooled_ );
     buffer_ = nullptr;
     size_ = 0;
+    capacity_ = 0;
 }
 
 #ifdef EL_INSTANTIATE_CORE
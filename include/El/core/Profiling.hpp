@@ -0,0 +1,102 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PROFILING_HPP
+#define EL_PROFILING_HPP
+
+namespace El {
+
+// Hierarchical, per-rank profiling of Elemental's top-level routines
+// ==================================================================
+// Unlike the call stack maintained by EL_DEBUG_CSE, profiling is available in
+// Release builds. Each rank maintains a tree of regions (e.g., HermitianEig
+// containing HermitianTridiag, HermitianTridiagEig, and the back-transformation
+// HermitianTridiagApplyQ), and each node records its number of invocations,
+// inclusive wall-clock time, flop count, number of bytes redistributed, and
+// the time spent within MPI calls.
+//
+// The per-rank trees can then be reduced into min/avg/max statistics on the
+// root of a communicator and printed, exported as JSON, or the individual
+// region invocations can be exported in the Chrome trace-event format (which
+// can be loaded into chrome://tracing), with one 'process' per rank.
+
+struct ProfileNode
+{
+    string name;
+    Int numCalls=0;
+    double time=0;
+    double flops=0;
+    double bytes=0;
+    double mpiTime=0;
+    vector<ProfileNode> children;
+};
+
+// Begin recording; if 'recordTrace' is true, then the start and stop time of
+// each region invocation is also stored for exporting as a Chrome trace
+void EnableProfiling( bool recordTrace=false );
+void DisableProfiling();
+bool ProfilingEnabled();
+
+// Clear the tree (and trace) of the calling process
+void ResetProfile();
+
+// Returns a copy of the calling process's tree, whose root is unnamed
+ProfileNode LocalProfile();
+
+// Attribute work to the innermost active region
+void ProfileFlops( double flops );
+void ProfileBytes( double bytes );
+void ProfileMPITime( double seconds );
+
+// Scoped regions; the constructor and destructor only test a flag when
+// profiling is disabled
+class ProfileRegion
+{
+public:
+    ProfileRegion( const char* name );
+    ~ProfileRegion();
+private:
+    bool active_;
+};
+
+// Times the enclosing MPI call and attributes it to the innermost region
+// (nested instances are only counted once)
+class ProfileMPICall
+{
+public:
+    ProfileMPICall();
+    ~ProfileMPICall();
+private:
+    bool active_;
+    Clock::time_point start_;
+};
+
+// Attributes the flops of an operation to the innermost region unless an
+// enclosing operation has already done so (e.g., a distributed Gemm records
+// its share of the flops and the local Gemm calls within it are not counted)
+class ProfileFlopCount
+{
+public:
+    explicit ProfileFlopCount( double flops );
+    ~ProfileFlopCount();
+private:
+    bool active_;
+};
+
+// The following are collective over 'comm' and produce output on its root
+void PrintProfile( mpi::Comm comm=mpi::COMM_WORLD, ostream& os=cout );
+void WriteProfileJSON
+( const string& filename, mpi::Comm comm=mpi::COMM_WORLD );
+void WriteProfileTrace
+( const string& filename, mpi::Comm comm=mpi::COMM_WORLD );
+
+} // namespace El
+
+#define EL_PROFILE_REGION(name) El::ProfileRegion elProfileRegion(name);
+
+#endif // ifndef EL_PROFILING_HPP
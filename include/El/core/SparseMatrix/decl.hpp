@@ -24,6 +24,65 @@ namespace El {
 // Forward declaration for constructor
 template<typename Ring> class DistSparseMatrix;
 
+enum SparseMultFormat
+{
+  SPARSE_MULT_CSR,
+  SPARSE_MULT_SELL,
+  SPARSE_MULT_BCSR
+};
+
+// Secondary storage formats for (non-transposed) multiplication, which are
+// built from the CSR storage once a matrix has been multiplied with several
+// times without modification
+template<typename Ring>
+struct SparseMultMeta
+{
+    // The number of rows per chunk of the SELL-C-sigma format and the number
+    // of rows within which the rows are sorted by length
+    static const Int sellChunkHeight = 8;
+    static const Int sellSortWindow = 32*sellChunkHeight;
+
+    bool ready=false;
+    Int numMultiplies=0;
+    SparseMultFormat format=SPARSE_MULT_CSR;
+
+    // SELL-C-sigma: the rows (in the permuted order 'sellRows') are packed
+    // into chunks of 'sellChunkHeight' rows which are stored column-major and
+    // padded to the length of their longest row
+    vector<Int> sellRows, sellRowLengths, sellChunkOffsets, sellCols;
+    vector<Ring> sellVals;
+
+    // Blocked CSR with dense, row-major blocks of size 'blockSize' (at most
+    // four). Bit 'r*blockSize+c' of a block's mask is set if entry (r,c) is
+    // a structural nonzero.
+    Int blockSize=1;
+    vector<Int> blockOffsets, blockCols;
+    vector<unsigned> blockMasks;
+    vector<Ring> blockVals;
+
+    void Invalidate() EL_NO_EXCEPT
+    {
+        ready = false;
+        numMultiplies = 0;
+    }
+
+    void Clear()
+    {
+        Invalidate();
+        format = SPARSE_MULT_CSR;
+        blockSize = 1;
+        SwapClear( sellRows );
+        SwapClear( sellRowLengths );
+        SwapClear( sellChunkOffsets );
+        SwapClear( sellCols );
+        SwapClear( sellVals );
+        SwapClear( blockOffsets );
+        SwapClear( blockCols );
+        SwapClear( blockMasks );
+        SwapClear( blockVals );
+    }
+};
+
 template<typename Ring>
 class SparseMatrix
 {
@@ -137,6 +196,9 @@ public:
 
     void AssertConsistent() const;
 
+    // Any modification of the matrix invalidates the secondary formats
+    mutable SparseMultMeta<Ring> multMeta;
+
 private:
     El::Graph graph_;
     vector<Ring> vals_;
@@ -68,6 +68,7 @@ void SparseMatrix<Ring>::Empty( bool clearMemory )
         SwapClear( vals_ );
     else
         vals_.resize( 0 );
+    multMeta.Clear();
 }
 
 template<typename Ring>
@@ -78,6 +79,7 @@ void SparseMatrix<Ring>::Resize( Int height, Int width )
         return;
     graph_.Resize( height, width );
     vals_.resize( 0 );
+    multMeta.Invalidate();
 }
 
 // Assembly
@@ -125,6 +127,7 @@ void SparseMatrix<Ring>::QueueUpdate( Int row, Int col, const Ring& value )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    multMeta.Invalidate();
     if( FrozenSparsity() )
     {
         const Int offset = Offset( row, col );
@@ -147,6 +150,7 @@ void SparseMatrix<Ring>::QueueZero( Int row, Int col )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    multMeta.Invalidate();
     if( FrozenSparsity() )
     {
         const Int offset = Offset( row, col );
@@ -169,6 +173,7 @@ const SparseMatrix<Ring>& SparseMatrix<Ring>::operator=( const SparseMatrix<Ring
     EL_DEBUG_CSE
     graph_ = A.graph_;
     vals_ = A.vals_;
+    multMeta.Invalidate();
     return *this;
 }
 
@@ -182,6 +187,7 @@ SparseMatrix<Ring>::operator=( const DistSparseMatrix<Ring>& A )
 
     graph_ = A.distGraph_;
     vals_ = A.vals_;
+    multMeta.Invalidate();
     return *this;
 }
 
@@ -289,7 +295,10 @@ bool SparseMatrix<Ring>::Consistent() const EL_NO_EXCEPT
 
 template<typename Ring>
 El::Graph& SparseMatrix<Ring>::Graph() EL_NO_EXCEPT
-{ return graph_; }
+{
+    multMeta.Invalidate();
+    return graph_;
+}
 template<typename Ring>
 const El::Graph& SparseMatrix<Ring>::LockedGraph() const EL_NO_EXCEPT
 { return graph_; }
@@ -364,6 +373,7 @@ void SparseMatrix<Ring>::Set
     if( Row(index) == row && Col(index) == col )
     {
         vals_[index] = val;
+        multMeta.Invalidate();
     }
     else
     {
@@ -372,18 +382,32 @@ void SparseMatrix<Ring>::Set
     }
 }
 
+// Since the matrix may be modified through the mutable buffers, the secondary
+// formats are conservatively invalidated
 template<typename Ring>
 Int* SparseMatrix<Ring>::SourceBuffer() EL_NO_EXCEPT
-{ return graph_.SourceBuffer(); }
+{
+    multMeta.Invalidate();
+    return graph_.SourceBuffer();
+}
 template<typename Ring>
 Int* SparseMatrix<Ring>::TargetBuffer() EL_NO_EXCEPT
-{ return graph_.TargetBuffer(); }
+{
+    multMeta.Invalidate();
+    return graph_.TargetBuffer();
+}
 template<typename Ring>
 Int* SparseMatrix<Ring>::OffsetBuffer() EL_NO_EXCEPT
-{ return graph_.OffsetBuffer(); }
+{
+    multMeta.Invalidate();
+    return graph_.OffsetBuffer();
+}
 template<typename Ring>
 Ring* SparseMatrix<Ring>::ValueBuffer() EL_NO_EXCEPT
-{ return vals_.data(); }
+{
+    multMeta.Invalidate();
+    return vals_.data();
+}
 
 template<typename Ring>
 const Int* SparseMatrix<Ring>::LockedSourceBuffer() const EL_NO_EXCEPT
@@ -404,11 +428,15 @@ void SparseMatrix<Ring>::ForceNumEntries( Int numEntries )
     EL_DEBUG_CSE
     graph_.ForceNumEdges( numEntries );
     vals_.resize( numEntries );
+    multMeta.Invalidate();
 }
 
 template<typename Ring>
 void SparseMatrix<Ring>::ForceConsistency( bool consistent ) EL_NO_EXCEPT
-{ graph_.ForceConsistency( consistent ); }
+{
+    graph_.ForceConsistency( consistent );
+    multMeta.Invalidate();
+}
 
 // Auxiliary routines
 // ==================
@@ -483,6 +511,7 @@ void SparseMatrix<Ring>::ProcessQueues()
 
     graph_.ComputeSourceOffsets();
     graph_.consistent_ = true;
+    multMeta.Invalidate();
 }
 
 template<typename Ring>
@@ -93,6 +93,66 @@ void PushBlocksizeStack( Int blocksize );
 void PopBlocksizeStack();
 void EmptyBlocksizeStack();
 
+// For per-routine blocksizes tuned for a particular scalar type, process grid
+// shape, and band of problem sizes (bands are the floor of the base-two
+// logarithm of the problem size). When tuned blocksizes are enabled, which
+// loading a tuning file implies, a matching entry takes precedence over the
+// blocksize stack; otherwise Blocksize() is returned. If the environment
+// variable EL_BLOCKSIZE_TUNING_FILE is set, the file it names is loaded
+// during Initialize. Sequential routines use a 0 x 0 grid so that their
+// entries are kept separate from those of distributed routines on a 1 x 1
+// process grid.
+Int Blocksize
+( const string& routine,
+  const string& typeName,
+  Int n,
+  Int gridHeight=0,
+  Int gridWidth=0 );
+template<typename T>
+Int Blocksize
+( const string& routine, Int n, Int gridHeight=0, Int gridWidth=0 )
+{ return Blocksize( routine, TypeName<T>(), n, gridHeight, gridWidth ); }
+
+Int BlocksizeBand( Int n );
+void SetTunedBlocksize
+( const string& routine,
+  const string& typeName,
+  Int n,
+  Int gridHeight,
+  Int gridWidth,
+  Int blocksize );
+
+void EnableTunedBlocksizes();
+void DisableTunedBlocksizes();
+bool TunedBlocksizesEnabled();
+void ClearBlocksizeTuning();
+
+// Tuning files contain one entry per line of the form
+//   routine typeName gridHeight gridWidth band blocksize
+// and lines beginning with '#' are ignored
+void LoadBlocksizeTuning( const string& filename );
+void SaveBlocksizeTuning( const string& filename );
+
+// Time 'run' (collectively over 'comm', keeping the fastest of 'numReps'
+// repetitions) with each of the candidate blocksizes pushed onto the
+// blocksize stack, then record and return the fastest candidate
+Int TuneBlocksize
+( const string& routine,
+  const string& typeName,
+  Int n,
+  Int gridHeight,
+  Int gridWidth,
+  const vector<Int>& candidates,
+  function<void()> run,
+  mpi::Comm comm=mpi::COMM_WORLD,
+  Int numReps=3 );
+
+// For the number of panels which the distributed blocked Cholesky and LU
+// factorizations may factor ahead of their trailing updates (zero selects the
+// bulk-synchronous algorithms)
+Int LookAheadDepth();
+void SetLookAheadDepth( Int depth );
+
 template<typename T,
          typename=EnableIf<IsScalar<T>>>
 const T& Max( const T& m, const T& n ) EL_NO_EXCEPT;
@@ -283,6 +343,17 @@ void ClearIndent();
 Int IndentLevel();
 std::string Indent();
 
+// Increase the indentation for the lifetime of the guard, and restore the
+// previous level on exit from its scope, including by an exception
+class IndentGuard
+{
+public:
+    IndentGuard() : level_(PushIndent()) { }
+    ~IndentGuard() { SetIndent( level_ ); }
+private:
+    Int level_;
+};
+
 template<typename... ArgPack>
 void Output( const ArgPack& ... args );
 
@@ -52,6 +52,13 @@ namespace blas {
 
 // NOTE: templated routines are custom and not wrappers
 
+// Threading
+// =========
+// The number of threads used by the BLAS library (always one if it is not
+// known how to query or set it)
+int GetNumThreads();
+void SetNumThreads( int numThreads );
+
 // Level 1 BLAS 
 // ============
 template<typename T>
@@ -575,6 +582,29 @@ void Gemm
   const T& beta,
         T* C, BlasInt CLDim );
 
+// The triple loop used by the templated Gemm for small products and for
+// datatypes without a register-blocked micro-kernel (e.g., BigFloat)
+template<typename T>
+void UnblockedGemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim, 
+  const T* B, BlasInt BLDim,
+  const T& beta,
+        T* C, BlasInt CLDim );
+
+// A packed, cache-blocked Gemm with compile-time register blocking which the
+// templated Gemm uses for sufficiently large DoubleDouble, QuadDouble, and
+// Quad (and their complex counterparts) products
+template<typename T>
+void BlockedGemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim, 
+  const T* B, BlasInt BLDim,
+  const T& beta,
+        T* C, BlasInt CLDim );
+
 void Gemm
 ( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
   const float& alpha,
@@ -81,6 +81,8 @@ inline bool operator!=( const Op& a, const Op& b ) EL_NO_EXCEPT
 typedef MPI_Aint Aint;
 typedef MPI_Datatype Datatype;
 typedef MPI_Errhandler ErrorHandler;
+typedef MPI_File File;
+typedef MPI_Offset Offset;
 typedef MPI_Status Status;
 typedef MPI_User_function UserFunction;
 
@@ -282,6 +284,34 @@ void Translate
 ( Comm origComm, int size, const int* origRanks,
   Comm newComm,                  int* newRanks ) EL_NO_RELEASE_EXCEPT;
 
+// Parallel file I/O
+// -----------------
+// Opening for writing creates (or truncates) the file. Unlike most MPI
+// errors, failing to open a file is always reported.
+void FileOpen
+( Comm comm, const std::string& filename, bool write, File& file );
+void FileClose( File& file ) EL_NO_RELEASE_EXCEPT;
+Offset FileSize( File file ) EL_NO_RELEASE_EXCEPT;
+void FileReadAt
+( File file, Offset offset, byte* buf, int numBytes ) EL_NO_RELEASE_EXCEPT;
+void FileWriteAt
+( File file, Offset offset, const byte* buf, int numBytes )
+EL_NO_RELEASE_EXCEPT;
+
+// Collectively read (or write) the submatrix of a column-major matrix with
+// entries of 'entrySize' bytes and the given height, stored starting at byte
+// 'disp' of the file, which consists of the (increasing) row indices
+// 'rowInds' and column indices 'colInds'. The submatrix is stored in the
+// column-major buffer 'buf' with leading dimension 'ldim' (in entries).
+void FileReadSubmatrixAll
+( File file, Offset disp, int entrySize, Int height,
+  const vector<Int>& rowInds, const vector<Int>& colInds,
+  byte* buf, Int ldim ) EL_NO_RELEASE_EXCEPT;
+void FileWriteSubmatrixAll
+( File file, Offset disp, int entrySize, Int height,
+  const vector<Int>& rowInds, const vector<Int>& colInds,
+  const byte* buf, Int ldim ) EL_NO_RELEASE_EXCEPT;
+
 // Utilities
 void Barrier( Comm comm=COMM_WORLD ) EL_NO_RELEASE_EXCEPT;
 
@@ -751,6 +781,35 @@ void AllGather
         T* rbuf, const int* rcs, const int* rds, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 
+// AllGather directly between strided matrices
+// -------------------------------------------
+// Every process contributes its sHeight x sWidth column-major matrix (with
+// leading dimension sLDim), and the contribution of process q is written to
+// the entries
+//
+//   rbuf[(rRowOffs[q]+i*rRowStride)+(rColOffs[q]+j*rColStride)*rLDim],
+//
+// for 0 <= i < rHeights[q] and 0 <= j < rWidths[q], where the strided
+// layouts are described with derived datatypes rather than by packing into
+// and unpacking from contiguous buffers. Since MPI_Alltoallw only accepts int
+// byte displacements, a RuntimeError is thrown if an offset into 'rbuf' does
+// not fit in an int.
+template<typename T,
+         typename=EnableIf<IsPacked<T>>>
+void StridedAllGather
+( const T* sbuf, int sHeight, int sWidth, int sLDim,
+        T* rbuf, int rLDim, int rRowStride, int rColStride,
+  const int* rHeights, const int* rWidths,
+  const int* rRowOffs, const int* rColOffs, Comm comm );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void StridedAllGather
+( const T* sbuf, int sHeight, int sWidth, int sLDim,
+        T* rbuf, int rLDim, int rRowStride, int rColStride,
+  const int* rHeights, const int* rWidths,
+  const int* rRowOffs, const int* rColOffs, Comm comm );
+
 // Scatter
 // -------
 template<typename Real,
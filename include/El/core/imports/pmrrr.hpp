@@ -22,40 +22,69 @@ Estimate EigEstimate
 ( int n,  double* d, double* e, double* w, mpi::Comm comm, 
   double lowerBound, double upperBound );
 
+struct Ctrl {
+    // The number of threads used by each process; if nonpositive, PMRRR
+    // falls back to the PMR_NUM_THREADS environment variable
+    int numThreads=0;
+
+    // The relative gap below which eigenvalues form a cluster; if
+    // nonpositive, PMRRR's default of 1e-3 is used
+    double minRelGap=0;
+
+    bool highAccuracy=false;
+
+    // Assign the eigenvectors to processes by their estimated cost, with at
+    // most 'maxLocalEigenvectors' per process (the width of Z), rather than
+    // in chunks of equal size
+    bool balance=false;
+    int maxLocalEigenvectors=0;
+};
+
 struct Info {
     int numLocalEigenvalues;
     int numGlobalEigenvalues;
 
     int firstLocalEigenvalue;
+
+    int numThreads=1;
+    int numClusters=0;
+    int numLocalClustered=0;
+
+    // Local wall-clock times (in seconds) of each phase
+    double eigenvalueTime=0;
+    double eigenvectorTime=0;
+    double refineTime=0;
 };
 
 // Compute all of the eigenvalues
-Info Eig( int n, double* d, double* e, double* w, mpi::Comm comm );
+Info Eig( int n, double* d, double* e, double* w, mpi::Comm comm,
+  const Ctrl& ctrl=Ctrl() );
 
 // Compute all of the eigenpairs
 Info Eig
-( int n, double* d, double* e, double* w, double* Z, int ldz, mpi::Comm comm );
+( int n, double* d, double* e, double* w, double* Z, int ldz, mpi::Comm comm,
+  const Ctrl& ctrl=Ctrl() );
 
 // Compute all of the eigenvalues in [lowerBound,upperBound)
 Info Eig
 ( int n, double* d, double* e, double* w, mpi::Comm comm, 
-  double lowerBound, double upperBound );
+  double lowerBound, double upperBound, const Ctrl& ctrl=Ctrl() );
 
 // Compute all of the eigenpairs with eigenvalues in [lowerBound,upperBound)
 Info Eig
 ( int n, double* d, double* e, double* w, double* Z, int ldz, mpi::Comm comm, 
-  double lowerBound, double upperBound );
+  double lowerBound, double upperBound, const Ctrl& ctrl=Ctrl() );
 
 // Compute all of the eigenvalues with indices in [lowerBound,upperBound)
 Info Eig
 ( int n, double* d, double* e, double* w, mpi::Comm comm, 
-  int lowerBound, int upperBound );
+  int lowerBound, int upperBound, const Ctrl& ctrl=Ctrl() );
 
 // Compute all of the eigenpairs with ordered eigenvalue indices in 
 // [lowerBound,upperBound)
 Info Eig
 ( int n, double* d, double* e, double* w, double* Z, int ldz, mpi::Comm comm, 
-  int lowerBound, int upperBound );
+  int lowerBound, int upperBound, const Ctrl& ctrl=Ctrl() );
 
 } // namespace herm_tridiag_eig
 } // namespace El
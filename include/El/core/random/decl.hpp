@@ -13,6 +13,39 @@ namespace El {
 
 std::mt19937& Generator();
 
+// Counter-based random number generation
+// --------------------------------------
+// The Philox4x32-10 bijection of Salmon et al., "Parallel Random Numbers:
+// As Easy as 1, 2, 3", maps a 128-bit counter and a 64-bit key to 128
+// random bits. If counter-based generation is enabled, the independent
+// random ensembles (e.g., Uniform, Gaussian, Bernoulli, and ThreeValued)
+// draw entry (i,j) from the counter (i,j,stream) and the key 'seed' rather
+// than from Generator(), so that each process and thread fills its own
+// entries without communication and the result does not depend upon the
+// distribution or the number of threads.
+//
+// Each fill consumes a new stream so that successive matrices differ.
+// Distributed fills agree upon their stream over the communicator of the
+// matrix, so redundant copies are identical even if some processes made
+// additional fills in between. Process-local fills draw from a separate
+// sequence of streams with a key offset by the rank of the process, so
+// that they neither perturb the distributed streams nor coincide across
+// processes.
+void SetCounterBasedRandom( bool counterBased );
+bool CounterBasedRandom();
+void SetCounterBasedSeed( unsigned long long seed );
+unsigned long long CounterBasedSeed();
+unsigned long long CounterBasedLocalSeed();
+std::uint32_t NextCounterBasedStream();
+std::uint32_t NextCounterBasedStream( mpi::Comm comm );
+
+std::array<std::uint32_t,4>
+Philox4x32
+( std::uint64_t i, std::uint64_t j, std::uint32_t stream, std::uint64_t seed );
+
+// Map 64 random bits to a double-precision sample from [0,1)
+double CounterBasedUnit( std::uint32_t hi, std::uint32_t lo );
+
 template<typename Real>
 Real Choose( Int n, Int k );
 template<typename Real>
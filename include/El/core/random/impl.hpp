@@ -11,6 +11,42 @@
 
 namespace El {
 
+inline std::array<std::uint32_t,4>
+Philox4x32
+( std::uint64_t i, std::uint64_t j, std::uint32_t stream, std::uint64_t seed )
+{
+    const std::uint32_t mult0 = 0xD2511F53, mult1 = 0xCD9E8D57;
+    const std::uint32_t weyl0 = 0x9E3779B9, weyl1 = 0xBB67AE85;
+
+    // The leading 48 bits of each index are used
+    std::uint32_t c0 = std::uint32_t(i);
+    std::uint32_t c1 = std::uint32_t(j);
+    std::uint32_t c2 = stream;
+    std::uint32_t c3 =
+      std::uint32_t((i>>32) & 0xFFFF) | (std::uint32_t((j>>32) & 0xFFFF)<<16);
+    std::uint32_t k0 = std::uint32_t(seed);
+    std::uint32_t k1 = std::uint32_t(seed>>32);
+    for( int round=0; round<10; ++round )
+    {
+        const std::uint64_t prod0 = std::uint64_t(mult0)*c0;
+        const std::uint64_t prod1 = std::uint64_t(mult1)*c2;
+        c0 = std::uint32_t(prod1>>32) ^ c1 ^ k0;
+        c1 = std::uint32_t(prod1);
+        c2 = std::uint32_t(prod0>>32) ^ c3 ^ k1;
+        c3 = std::uint32_t(prod0);
+        k0 += weyl0;
+        k1 += weyl1;
+    }
+    return {{c0,c1,c2,c3}};
+}
+
+inline double CounterBasedUnit( std::uint32_t hi, std::uint32_t lo )
+{
+    const std::uint64_t bits = (std::uint64_t(hi)<<32) | lo;
+    // Keep the 53 leading bits so that the result is exactly representable
+    return double(bits>>11)*(1./9007199254740992.);
+}
+
 template<typename Real>
 Real Choose( Int n, Int k )
 {
@@ -247,6 +247,7 @@ typedef enum {
   EL_PPM,
   EL_XBM,
   EL_XPM,
+  EL_BINARY_DIST,
   EL_FileFormat_MAX
 } ElFileFormat;
 
@@ -506,6 +506,7 @@ enum FileFormat
     PPM,
     XBM,
     XPM,
+    BINARY_DIST, // Parallel (MPI-IO) binary with the distribution in the header
     FileFormat_MAX // For detecting number of entries in enum
 };
 }
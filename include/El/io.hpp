@@ -113,19 +113,59 @@ void Print( const vector<T>& x, string title="vector", ostream& os=cout );
 
 // Read
 // ====
+// The distributed Matrix Market readers are collective: each process parses
+// its own share of the bytes of the file and sends the entries to their
+// owners. If 'progress' is true, the per-process throughput is reported.
 template<typename T>
 void Read( Matrix<T>& A, const string filename, FileFormat format=AUTO );
 template<typename T>
 void Read
 ( AbstractDistMatrix<T>& A, 
-  const string filename, FileFormat format=AUTO, bool sequential=false );
+  const string filename, FileFormat format=AUTO, bool sequential=false,
+  bool progress=false );
 
 template<typename T>
 void Read
 ( SparseMatrix<T>& A, const string filename, FileFormat format=AUTO );
 template<typename T>
 void Read
-( DistSparseMatrix<T>& A, const string filename, FileFormat format=AUTO );
+( DistSparseMatrix<T>& A, const string filename, FileFormat format=AUTO,
+  bool progress=false );
+
+// Memory-mapped BINARY_FLAT files
+// ===============================
+// A view of a column-major BINARY_FLAT file which is mapped into memory rather
+// than read, so that no copy is made and pages are only loaded as they are
+// accessed. Read-only mappings only provide locked views, whereas writable
+// mappings are shared with the file (which is created if it does not exist),
+// so that modifications are written back to it.
+//
+// When memory mapping is not available, the file is instead read into (and,
+// if writable, written back from) a buffer owned by the view.
+template<typename T>
+class MappedMatrix
+{
+public:
+    MappedMatrix
+    ( const string filename, Int height, Int width, bool writable=false );
+    ~MappedMatrix();
+
+    MappedMatrix( const MappedMatrix& ) = delete;
+    MappedMatrix& operator=( const MappedMatrix& ) = delete;
+
+    El::Matrix<T>& Matrix();
+    const El::Matrix<T>& LockedMatrix() const;
+
+    // Synchronously write any modifications back to the file
+    void Flush();
+
+private:
+    string filename_;
+    bool writable_;
+    size_t numBytes_;
+    void* map_=nullptr;
+    El::Matrix<T> A_;
+};
 
 // Spy
 // ===
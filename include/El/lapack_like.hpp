@@ -27,4 +27,6 @@
 
 #include <El/lapack_like/props.hpp>
 
+#include <El/lapack_like/batched.hpp>
+
 #endif // ifndef EL_LAPACK_HPP
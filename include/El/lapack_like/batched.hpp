@@ -0,0 +1,198 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BATCHED_HPP
+#define EL_BATCHED_HPP
+
+namespace El {
+
+// Batched operations on many small matrices
+// =========================================
+// Each of the routines in this namespace independently applies the same
+// operation to every member of a batch of small, column-major matrices
+// (say, of order 8 to 64). Rather than paying the per-call overhead of the
+// Matrix<T> interface for every member, consecutive groups of members are
+// interleaved into a structure-of-arrays buffer, so that the innermost loops
+// of the kernels run across the batch (and vectorize), and the groups are
+// distributed over OpenMP threads when Elemental is built with EL_HYBRID.
+//
+// A batch member which could not be factored does not prevent the remaining
+// members from being processed; the exception is thrown once the entire batch
+// has been traversed.
+
+namespace batched {
+
+// A batch of column-major matrices sharing a common leading dimension.
+// The members are either spaced a fixed stride apart in a single buffer or
+// are individually addressed through an array of pointers.
+template<typename T>
+class BatchView
+{
+public:
+    // Member k begins at buffer + k*stride
+    BatchView( T* buffer, Int ldim, Int stride )
+    : buffer_(buffer), pointers_(nullptr), ldim_(ldim), stride_(stride)
+    { }
+
+    // Member k begins at pointers[k]
+    BatchView( T* const* pointers, Int ldim )
+    : buffer_(nullptr), pointers_(pointers), ldim_(ldim), stride_(0)
+    { }
+
+    T* Member( Int k ) const EL_NO_EXCEPT
+    { return pointers_ == nullptr ? buffer_ + k*stride_ : pointers_[k]; }
+
+    Int LDim() const EL_NO_EXCEPT { return ldim_; }
+
+private:
+    T* buffer_;
+    T* const* pointers_;
+    Int ldim_, stride_;
+};
+
+// BLAS-like
+// =========
+
+// C[k] := alpha op(A[k]) op(B[k]) + beta C[k], where op(A[k]) is m x numSum,
+// op(B[k]) is numSum x n, and C[k] is not read if beta is zero.
+template<typename T>
+void Gemm
+( Orientation orientA,
+  Orientation orientB,
+  Int m,
+  Int n,
+  Int numSum,
+  T alpha,
+  const BatchView<T>& A,
+  const BatchView<T>& B,
+  T beta,
+  const BatchView<T>& C,
+  Int batchSize );
+
+// Overwrite the m x n matrices B[k] with the solutions X[k] of
+//
+//   op(A[k]) X[k] = alpha B[k]   (side=LEFT), or
+//   X[k] op(A[k]) = alpha B[k]   (side=RIGHT),
+//
+// where A[k] is triangular and only its 'uplo' triangle is accessed.
+template<typename T>
+void Trsm
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  Int m,
+  Int n,
+  T alpha,
+  const BatchView<T>& A,
+  const BatchView<T>& B,
+  Int batchSize );
+
+// LAPACK-like
+// ===========
+
+// Cholesky
+// --------
+// Overwrite the 'uplo' triangle of each n x n HPD A[k] with its Cholesky
+// factor (A[k] = L[k] L[k]^H or A[k] = U[k]^H U[k]). The opposite triangle is
+// not accessed. A NonHPDMatrixException is thrown if any member was not HPD.
+template<typename Field>
+void Cholesky
+( UpperOrLower uplo,
+  Int n,
+  const BatchView<Field>& A,
+  Int batchSize );
+
+// LU with partial pivoting
+// ------------------------
+// Overwrite each m x n A[k] with the unit-lower and upper-triangular factors
+// of P[k] A[k] = L[k] U[k]. Entry j of the (length min(m,n)) pivot vector
+// p[k] is the row which was exchanged with row j during step j. A
+// SingularMatrixException is thrown if any member had an exactly zero pivot.
+template<typename Field>
+void LU
+( Int m,
+  Int n,
+  const BatchView<Field>& A,
+  const BatchView<Int>& p,
+  Int batchSize );
+
+// Householder QR
+// --------------
+// Overwrite each m x n A[k] with R[k] in its upper trapezoid and the
+// Householder vectors beneath the diagonal, so that A[k] = Q[k] R[k] with
+//
+//   Q[k] = H_0 H_1 ... H_{min(m,n)-1},  H_j = I - tau_j v_j v_j^H,
+//
+// where v_j has a unit j'th entry and zeros above it (the LAPACK convention).
+// The min(m,n) scalars tau_j are stored in householderScalars[k].
+template<typename Field>
+void QR
+( Int m,
+  Int n,
+  const BatchView<Field>& A,
+  const BatchView<Field>& householderScalars,
+  Int batchSize );
+
+namespace cholesky {
+
+// Overwrite each n x numRHS B[k] with the solution of op(A[k]) X[k] = B[k]
+// given the Cholesky factorization of A[k] computed by batched::Cholesky.
+template<typename Field>
+void SolveAfter
+( UpperOrLower uplo,
+  Orientation orientation,
+  Int n,
+  Int numRHS,
+  const BatchView<Field>& A,
+  const BatchView<Field>& B,
+  Int batchSize );
+
+} // namespace cholesky
+
+namespace lu {
+
+// Overwrite each n x numRHS B[k] with the solution of op(A[k]) X[k] = B[k]
+// given the partially-pivoted LU factorization computed by batched::LU.
+template<typename Field>
+void SolveAfter
+( Orientation orientation,
+  Int n,
+  Int numRHS,
+  const BatchView<Field>& A,
+  const BatchView<Int>& p,
+  const BatchView<Field>& B,
+  Int batchSize );
+
+} // namespace lu
+
+namespace qr {
+
+// Given the QR factorizations of the m x n (m >= n) matrices A[k] computed by
+// batched::QR, each B[k] should be m x numRHS. If orientation is NORMAL,
+// the leading n rows of B[k] are overwritten with the least-squares solution
+// of min || A[k] X[k] - B[k] ||_F; otherwise, the leading n rows of B[k]
+// are taken as the right-hand sides and B[k] is overwritten with the
+// minimum-norm solution of op(A[k]) X[k] = B[k].
+template<typename Field>
+void SolveAfter
+( Orientation orientation,
+  Int m,
+  Int n,
+  Int numRHS,
+  const BatchView<Field>& A,
+  const BatchView<Field>& householderScalars,
+  const BatchView<Field>& B,
+  Int batchSize );
+
+} // namespace qr
+
+} // namespace batched
+} // namespace El
+
+#endif // ifndef EL_BATCHED_HPP
@@ -115,6 +115,11 @@ typedef struct {
   ElHermitianTridiagApproach approach;
   ElGridOrderType order;
   ElSymvCtrl symvCtrl;
+  /* The two-stage reduction is only supported when the reflectors are not
+     returned (e.g., by ElHermitianTridiagOnlyXDist), as the packed form
+     cannot hold those of its bulge-chasing stage */
+  bool twoStage;
+  ElInt bandwidth;
 } ElHermitianTridiagCtrl;
 EL_EXPORT ElError
 ElHermitianTridiagCtrlDefault_s( ElHermitianTridiagCtrl* ctrl );
@@ -107,11 +107,53 @@ struct HermitianTridiagCtrl
     HermitianTridiagApproach approach=HERMITIAN_TRIDIAG_SQUARE;
     GridOrder order=ROW_MAJOR;
     SymvCtrl<Field> symvCtrl;
+
+    // Rather than the one-stage reduction, whose matrix-vector products are
+    // memory-bound, first reduce to a band with Level 3 BLAS and then chase
+    // the band down to tridiagonal form
+    bool twoStage=false;
+    // The bandwidth of the intermediate banded matrix (the algorithmic
+    // blocksize is used if zero)
+    Int bandwidth=0;
+};
+
+namespace herm_tridiag {
+
+// The Householder reflectors of the bulge-chasing stage of the two-stage
+// reduction. Sweep 'j' begins with a reflector acting upon the indices
+// [j+1,j+1+bandwidth), and each subsequent reflector of the sweep acts upon
+// the 'bandwidth' indices following those of its predecessor, until fewer
+// than two indices remain (the first reflector of each sweep is always
+// stored). Each reflector is truncated to the last index of the matrix and
+// stored, with its unit leading entry, in a column of 'V'.
+//
+// The sweeps are grouped into blocks of 'bandwidth' consecutive sweeps, which
+// are assigned to the processes of 'comm' in a round-robin manner, and each
+// process only stores the reflectors of its own blocks (in order). The
+// reflectors of a distributed reduction can therefore only be applied to
+// matrices distributed over the same grid.
+//
+// A one-stage reduction is described by an empty sequence with a
+// bandwidth of one over mpi::COMM_SELF.
+template<typename Field>
+struct BulgeReflectors
+{
+    Int bandwidth=1;
+    Matrix<Field> V;
+    Matrix<Field> householderScalars;
+    mpi::Comm comm=mpi::COMM_SELF;
 };
 
+} // namespace herm_tridiag
+
+// NOTE: The two-stage reduction can only be requested from the overloads
+//       which return the bulge-chasing reflectors, as its orthogonal
+//       similarity transformation is not determined by 'A' and
+//       'householderScalars' alone.
 template<typename Field>
 void HermitianTridiag
-( UpperOrLower uplo, Matrix<Field>& A, Matrix<Field>& householderScalars );
+( UpperOrLower uplo, Matrix<Field>& A, Matrix<Field>& householderScalars,
+  const HermitianTridiagCtrl<Field>& ctrl=HermitianTridiagCtrl<Field>() );
 template<typename Field>
 void HermitianTridiag
 ( UpperOrLower uplo,
@@ -119,10 +161,30 @@ void HermitianTridiag
   AbstractDistMatrix<Field>& householderScalars,
   const HermitianTridiagCtrl<Field>& ctrl=HermitianTridiagCtrl<Field>() );
 
+// If the two-stage reduction was requested, the reflectors of the band
+// reduction are stored below the band of 'A' (with their scalars in
+// 'householderScalars'), and the reflectors of the bulge chasing are
+// returned within 'bulgeReflectors' (spread over the processes in the
+// distributed case)
+template<typename Field>
+void HermitianTridiag
+( UpperOrLower uplo, Matrix<Field>& A, Matrix<Field>& householderScalars,
+  herm_tridiag::BulgeReflectors<Field>& bulgeReflectors,
+  const HermitianTridiagCtrl<Field>& ctrl=HermitianTridiagCtrl<Field>() );
+template<typename Field>
+void HermitianTridiag
+( UpperOrLower uplo,
+  AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& householderScalars,
+  herm_tridiag::BulgeReflectors<Field>& bulgeReflectors,
+  const HermitianTridiagCtrl<Field>& ctrl=HermitianTridiagCtrl<Field>() );
+
 namespace herm_tridiag {
 
 template<typename Field>
-void ExplicitCondensed( UpperOrLower uplo, Matrix<Field>& A );
+void ExplicitCondensed
+( UpperOrLower uplo, Matrix<Field>& A,
+  const HermitianTridiagCtrl<Field>& ctrl=HermitianTridiagCtrl<Field>() );
 template<typename Field>
 void ExplicitCondensed
 ( UpperOrLower uplo, AbstractDistMatrix<Field>& A,
@@ -141,6 +203,22 @@ void ApplyQ
   const AbstractDistMatrix<Field>& householderScalars,
         AbstractDistMatrix<Field>& B );
 
+// Apply the orthogonal factor of a (possibly two-stage) reduction
+template<typename Field>
+void ApplyQ
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& householderScalars,
+  const BulgeReflectors<Field>& bulgeReflectors,
+        Matrix<Field>& B );
+template<typename Field>
+void ApplyQ
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& householderScalars,
+  const BulgeReflectors<Field>& bulgeReflectors,
+        AbstractDistMatrix<Field>& B );
+
 } // namespace herm_tridiag
 
 // Hessenberg
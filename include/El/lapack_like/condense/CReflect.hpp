@@ -27,6 +27,8 @@ CReflect( const HermitianTridiagCtrl<Field>& ctrl )
     ctrlC.approach = CReflect(ctrl.approach);
     ctrlC.order = CReflect(ctrl.order);
     ctrlC.symvCtrl = CReflect(ctrl.symvCtrl);
+    ctrlC.twoStage = ctrl.twoStage;
+    ctrlC.bandwidth = ctrl.bandwidth;
     return ctrlC;
 }
 
@@ -38,6 +40,8 @@ CReflect( const ElHermitianTridiagCtrl& ctrlC )
     ctrl.approach = CReflect(ctrlC.approach);
     ctrl.order = CReflect(ctrlC.order);
     ctrl.symvCtrl = CReflect<Field>(ctrlC.symvCtrl);
+    ctrl.twoStage = ctrlC.twoStage;
+    ctrl.bandwidth = ctrlC.bandwidth;
     return ctrl;
 }
 
@@ -356,11 +356,21 @@ enum LUPivotType
     LU_PARTIAL,
     LU_FULL,
     LU_ROOK, /* not yet supported */
-    LU_WITHOUT_PIVOTING
+    LU_WITHOUT_PIVOTING,
+    LU_TOURNAMENT
 };
 }
 using namespace LUPivotTypeNS;
 
+struct LUCtrl
+{
+    // Either LU_PARTIAL or LU_TOURNAMENT. The latter is communication-avoiding
+    // LU (CALU), which chooses the pivots of each distributed panel with a
+    // reduction tree over the process column rather than with one reduction
+    // per column. Sequential factorizations always use partial pivoting.
+    LUPivotType pivotType=LU_PARTIAL;
+};
+
 // LU without pivoting
 // -------------------
 template<typename Field>
@@ -376,6 +386,11 @@ template<typename Field>
 void LU( Matrix<Field>& A, Permutation& P );
 template<typename Field>
 void LU( AbstractDistMatrix<Field>& A, DistPermutation& P );
+template<typename Field>
+void LU( Matrix<Field>& A, Permutation& P, const LUCtrl& ctrl );
+template<typename Field>
+void LU
+( AbstractDistMatrix<Field>& A, DistPermutation& P, const LUCtrl& ctrl );
 
 // LU with full pivoting
 // ---------------------
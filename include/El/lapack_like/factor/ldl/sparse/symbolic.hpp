@@ -30,6 +30,22 @@ namespace ldl {
 Int Analysis( NodeInfo& rootInfo, Int myOff=0 );
 void Analysis( DistNodeInfo& rootInfo, bool storeFactRecvInds=true );
 
+// Statistics of the (dense) fronts before and after relaxed supernode
+// amalgamation, so that the additional fill can be weighed against the
+// reduction in the number of fronts
+struct AmalgamationInfo
+{
+    Int numFrontsBefore=0, numFrontsAfter=0;
+    double numEntriesBefore=0, numEntriesAfter=0;
+    double numFlopsBefore=0, numFlopsAfter=0;
+};
+
+// Merge small fronts into their parents according to the relaxed supernode
+// criteria of the BisectCtrl. The analysis must have already been performed
+// and must be recomputed afterwards.
+AmalgamationInfo Amalgamate
+( Separator& rootSep, NodeInfo& rootInfo, const BisectCtrl& ctrl );
+
 void AMDOrder
 ( const vector<Int>& subOffsets,
   const vector<Int>& subTargets,
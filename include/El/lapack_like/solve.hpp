@@ -248,6 +248,7 @@ void MultiShiftHessSolve
 
 } // namespace El
 
+#include <El/lapack_like/solve/CG.hpp>
 #include <El/lapack_like/solve/FGMRES.hpp>
 #include <El/lapack_like/solve/LGMRES.hpp>
 #include <El/lapack_like/solve/Refined.hpp>
@@ -0,0 +1,288 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_CG_HPP
+#define EL_SOLVE_CG_HPP
+
+// The pseudocode for Preconditioned Conjugate Gradients can be found in
+// "Algorithm 9.1" of
+//   Yousef Saad
+//   "Iterative Methods for Sparse Linear Systems", 2nd edition, SIAM, 2003.
+
+namespace El {
+
+namespace cg {
+
+// In what follows, 'applyA' should be a function of the form
+//
+//   void applyA
+//   ( Field alpha, const Matrix<Field>& x, Field beta, Matrix<Field>& y )
+//
+// and overwrite y := alpha A x + beta y, where A is Hermitian positive-
+// definite. The preconditioner, 'precond', should have the form
+//
+//   void precond( Matrix<Field>& b )
+//
+// and overwrite b with an approximation of inv(A) b, where the approximation
+// of inv(A) must also be Hermitian positive-definite.
+//
+// The iteration begins from the initial guess x and is stopped once
+// || b - A x ||_2 <= relTol || b ||_2. If this did not occur within 'maxIts'
+// iterations, then x is overwritten with the iterate of smallest residual
+// norm, which is often still useful as an inexact solution. (DistMultiVec
+// should be substituted for Matrix above in the distributed case.)
+
+template<typename Field,class ApplyAType,class PrecondType,class VectorType>
+Int Iterate
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+  const VectorType& b,
+        VectorType& x,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+
+    const Real bNorm = Nrm2( b );
+    if( bNorm == Real(0) )
+    {
+        Zero( x );
+        return 0;
+    }
+
+    // r := b - A x
+    // ============
+    VectorType r = b;
+    if( Nrm2( x ) != Real(0) )
+        applyA( Field(-1), x, Field(1), r );
+    const Real origResidNorm = Nrm2( r );
+    if( progress )
+        Output("origResidNorm: ",origResidNorm);
+    if( origResidNorm <= relTol*bNorm )
+        return 0;
+
+    // z := inv(M) r, p := z
+    // =====================
+    VectorType z = r;
+    precond( z );
+    VectorType p = z;
+    VectorType q = r;
+    Field rho = Dot( r, z );
+
+    // The residual norms of CG are not monotone, so keep the best iterate in
+    // case the iteration limit is reached
+    VectorType xBest = x;
+    Real bestResidNorm = origResidNorm;
+
+    Int iter = 0;
+    IndentGuard indentGuard;
+    while( true )
+    {
+        // q := A p
+        // ========
+        applyA( Field(1), p, Field(0), q );
+
+        // alpha := (r, z) / (p, A p)
+        // ==========================
+        const Field pq = Dot( p, q );
+        if( RealPart(pq) <= Real(0) )
+            RuntimeError("CG encountered a non-positive curvature of ",pq);
+        const Field alpha = rho / pq;
+
+        // x := x + alpha p, r := r - alpha q
+        // ==================================
+        Axpy( alpha, p, x );
+        Axpy( -alpha, q, r );
+        ++iter;
+
+        const Real residNorm = Nrm2( r );
+        const Real relResidNorm = residNorm / bNorm;
+        if( relResidNorm <= relTol )
+        {
+            if( progress )
+                Output("converged with relative tolerance: ",relResidNorm);
+            break;
+        }
+        if( progress )
+            Output
+            ("finished iteration ",iter," with relResidNorm=",relResidNorm);
+        if( residNorm < bestResidNorm )
+        {
+            bestResidNorm = residNorm;
+            if( iter < maxIts )
+                xBest = x;
+        }
+        if( iter == maxIts )
+        {
+            if( residNorm > bestResidNorm )
+                x = xBest;
+            if( progress )
+                Output
+                ("did not converge; returning the iterate with relative "
+                 "residual norm ",bestResidNorm/bNorm);
+            break;
+        }
+
+        // z := inv(M) r, p := z + ((r, z) / rho) p
+        // =========================================
+        z = r;
+        precond( z );
+        const Field rhoNew = Dot( r, z );
+        const Field beta = rhoNew / rho;
+        rho = rhoNew;
+        p *= beta;
+        p += z;
+    }
+
+    return iter;
+}
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+  const Matrix<Field>& b,
+        Matrix<Field>& x,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b.Width() != 1 || x.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    return Iterate<Field>( applyA, precond, b, x, relTol, maxIts, progress );
+}
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+  const DistMultiVec<Field>& b,
+        DistMultiVec<Field>& x,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b.Width() != 1 || x.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    const bool rootProgress =
+      progress && mpi::Rank(b.Grid().Comm()) == 0;
+    return Iterate<Field>
+    ( applyA, precond, b, x, relTol, maxIts, rootProgress );
+}
+
+} // namespace cg
+
+// Solve A X = B starting from the initial guess held in X
+template<typename Field,class ApplyAType,class PrecondType>
+Int CG
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    Int mostIts = 0;
+    const Int width = B.Width();
+    for( Int j=0; j<width; ++j )
+    {
+        auto b = B( ALL, IR(j) );
+        auto x = X( ALL, IR(j) );
+        const Int its =
+          cg::Single( applyA, precond, b, x, relTol, maxIts, progress );
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int CG
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+  const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& X,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    const Int height = B.Height();
+    const Int width = B.Width();
+
+    Int mostIts = 0;
+    DistMultiVec<Field> u(B.Grid()), v(B.Grid());
+    Zeros( u, height, 1 );
+    Zeros( v, height, 1 );
+    auto& BLoc = B.LockedMatrix();
+    auto& XLoc = X.Matrix();
+    auto& uLoc = u.Matrix();
+    auto& vLoc = v.Matrix();
+    for( Int j=0; j<width; ++j )
+    {
+        auto bLoc = BLoc( ALL, IR(j) );
+        auto xLoc = XLoc( ALL, IR(j) );
+        uLoc = bLoc;
+        vLoc = xLoc;
+        const Int its =
+          cg::Single( applyA, precond, u, v, relTol, maxIts, progress );
+        xLoc = vLoc;
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
+// Overwrite B with the solution of A X = B, starting from X = 0
+template<typename Field,class ApplyAType,class PrecondType>
+Int CG
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<Field>& B,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> X;
+    Zeros( X, B.Height(), B.Width() );
+    const Int mostIts =
+      CG( applyA, precond, B, X, relTol, maxIts, progress );
+    B = X;
+    return mostIts;
+}
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int CG
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    DistMultiVec<Field> X(B.Grid());
+    Zeros( X, B.Height(), B.Width() );
+    const Int mostIts =
+      CG( applyA, precond, B, X, relTol, maxIts, progress );
+    B = X;
+    return mostIts;
+}
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_CG_HPP
@@ -303,6 +303,53 @@ struct DCCtrl
     bool exploitStructure = true;
 };
 
+// Statistics of the distributed MRRR algorithm (PMRRR [CITATION]). The times
+// are wall-clock seconds maximized over the processes.
+struct MRRRInfo
+{
+    Int numThreads=1;
+
+    // The number of clusters of the root representations within the computed
+    // portion of the spectrum
+    Int numClusters=0;
+
+    // The maximum number of eigenvectors computed by a single process
+    Int maxLocalEigenvectors=0;
+
+    double eigenvalueTime=0;
+    double eigenvectorTime=0;
+    double refineTime=0;
+    double redistTime=0;
+
+    // The ratio of the maximum to the average time spent computing
+    // eigenvectors on each process (one corresponds to perfect balance)
+    double eigenvectorImbalance=1;
+};
+
+struct MRRRCtrl
+{
+    // The number of threads used by each process for computing both the
+    // eigenvalues and eigenvectors; if nonpositive, hybrid builds use the
+    // maximum number of OpenMP threads.
+    Int numThreads=0;
+
+    // Neighbouring eigenvalues whose relative gap is below this threshold are
+    // treated as a cluster, for which a new representation is computed; if
+    // nonpositive, PMRRR's default of 1e-3 is used.
+    double minRelGap=0;
+
+    // Attempt to compute the eigenvalues to high relative accuracy?
+    bool highAccuracy=false;
+
+    // By default, each process computes an equal number of eigenvectors,
+    // though clustered eigenvectors are substantially more expensive than
+    // singletons. If enabled, the eigenvectors are instead assigned by their
+    // estimated cost, and the results are redistributed afterwards. Each
+    // process may temporarily hold up to twice its usual number of
+    // eigenvectors.
+    bool balanceClusters=false;
+};
+
 // Cf. Section 4 of Gu and Eisenstat's "A Divide-and-Conquer Algorithm for the
 // Bidiagonal SVD" [CITATION] and LAPACK's {s,d}lasd2 [CITATION].
 //
@@ -331,7 +378,7 @@ struct HermitianTridiagEigInfo
 {
     herm_tridiag_eig::QRInfo qrInfo;
     herm_tridiag_eig::DCInfo dcInfo;
-    // TODO(poulson): MRRR info
+    herm_tridiag_eig::MRRRInfo mrrrInfo;
 };
 
 enum HermitianTridiagEigAlg {
@@ -353,7 +400,7 @@ struct HermitianTridiagEigCtrl
     HermitianTridiagEigAlg alg=HERM_TRIDIAG_EIG_MRRR;
     herm_tridiag_eig::QRCtrl qrCtrl;
     herm_tridiag_eig::DCCtrl<Real> dcCtrl;
-    // TODO(poulson): MRRR ctrl
+    herm_tridiag_eig::MRRRCtrl mrrrCtrl;
 };
 
 // Compute eigenvalues
@@ -21,9 +21,20 @@ struct BisectCtrl
     Int cutoff;
     bool storeFactRecvInds;
 
+    // Relaxed supernode amalgamation: a front is merged into its parent if
+    // the merged front would have at most 'relaxedSize' indices or if at most
+    // a 'fillTolerance' fraction of the merged (lower-triangular) front would
+    // consist of explicit zeros
+    bool relaxSupernodes;
+    Int relaxedSize;
+    double fillTolerance;
+    bool progress;
+
     BisectCtrl()
     : sequential(true), numDistSeps(1), numSeqSeps(1), cutoff(1024),
-      storeFactRecvInds(false)
+      storeFactRecvInds(false),
+      relaxSupernodes(false), relaxedSize(32), fillTolerance(0.1),
+      progress(false)
     { }
 };
 
@@ -28,6 +28,11 @@ typedef struct
     ElInt numSwaps;
     ElInt firstSwap;
     float logVol;
+    ElInt numSweeps;
+    double qrTime;
+    double localTime;
+    double updateTime;
+    double finalTime;
 } ElLLLInfo_s;
 
 typedef struct
@@ -39,6 +44,11 @@ typedef struct
     ElInt numSwaps;
     ElInt firstSwap;
     double logVol;
+    ElInt numSweeps;
+    double qrTime;
+    double localTime;
+    double updateTime;
+    double finalTime;
 } ElLLLInfo_d;
 
 typedef enum {
@@ -68,6 +78,8 @@ typedef struct
     bool time;
     bool jumpstart;
     ElInt startCol;
+    bool segmented;
+    ElInt segmentSize;
 } ElLLLCtrl_s;
 EL_EXPORT ElError ElLLLCtrlDefault_s( ElLLLCtrl_s* ctrl );
 
@@ -91,6 +103,8 @@ typedef struct
     bool time;
     bool jumpstart;
     ElInt startCol;
+    bool segmented;
+    ElInt segmentSize;
 } ElLLLCtrl_d;
 EL_EXPORT ElError ElLLLCtrlDefault_d( ElLLLCtrl_d* ctrl );
 
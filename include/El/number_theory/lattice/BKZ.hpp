@@ -26,6 +26,11 @@ struct BKZInfo
     Int numEnumFailures;
     Real logVol;
 
+    // The time (in seconds) and the resulting root Hermite factor of each
+    // tour of a parallel-tour reduction
+    vector<double> tourTimes;
+    vector<Real> tourRootHermiteFactors;
+
     template<typename OtherReal>
     BKZInfo<Real>& operator=( const BKZInfo<OtherReal>& info )
     {
@@ -37,6 +42,11 @@ struct BKZInfo
         numEnums = info.numEnums;
         numEnumFailures = info.numEnumFailures;
         logVol = Real(info.logVol);
+        tourTimes = info.tourTimes;
+        tourRootHermiteFactors.resize( info.tourRootHermiteFactors.size() );
+        for( size_t tour=0; tour<tourRootHermiteFactors.size(); ++tour )
+            tourRootHermiteFactors[tour] =
+              Real(info.tourRootHermiteFactors[tour]);
         return *this;
     }
 
@@ -86,6 +96,17 @@ struct BKZCtrl
     // with shuffling at each merge.
     bool recursive=false;
 
+    // Rather than enumerating the blocks of each tour one after another,
+    // concurrently enumerate the disjoint blocks of a tour and then merge any
+    // improvements with a single LLL pass (in the spirit of "pBKZ"). The block
+    // boundaries of successive tours are shifted by 'tourStagger' (half of the
+    // blocksize if it is nonpositive), and the reduction ends once a full
+    // cycle of shifts leaves the basis unchanged. Sub-BKZ is not used and only
+    // checkpointing is supported from the logging options. The blocks are
+    // only enumerated by separate threads for fixed-precision FULL_ENUM.
+    bool parallelTours=false;
+    Int tourStagger=0;
+
     bool logFailedEnums=false;
     std::string failedEnumFile="BKZFailedEnums.txt";
 
@@ -140,6 +161,9 @@ struct BKZCtrl
 
         recursive = ctrl.recursive;
 
+        parallelTours = ctrl.parallelTours;
+        tourStagger = ctrl.tourStagger;
+
         logFailedEnums = ctrl.logFailedEnums;
         logStreakSizes = ctrl.logStreakSizes;
         logNontrivialCoords = ctrl.logNontrivialCoords;
@@ -415,6 +439,212 @@ bool TryLowerPrecisionBigFloat
 }
 #endif
 
+// Each tour of a parallel BKZ enumerates the disjoint blocks
+//
+//   [0,offset), [offset,offset+bsize), [offset+bsize,offset+2 bsize), ...
+//
+// concurrently (the first block is skipped if it has fewer than two columns)
+// and then merges any improvements with a single jumpstarted LLL.
+template<typename F>
+BKZInfo<Base<F>> ParallelTours
+( Matrix<F>& B,
+  Matrix<F>& U,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  bool maintainU,
+  Int rank,
+  Int numSwaps,
+  const BKZCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = B.Width();
+    const Int stagger =
+      ( ctrl.tourStagger > 0 ? ctrl.tourStagger :
+        Max(ctrl.blocksize/2,Int(1)) );
+    const Int numOffsets = (ctrl.blocksize+stagger-1) / stagger;
+
+    auto enumCtrl = ctrl.enumCtrl;
+    enumCtrl.disablePrecDrop = true;
+    enumCtrl.time = false;
+    enumCtrl.progress = false;
+    enumCtrl.parallel = false;
+
+    vector<Range<Int>> blocks;
+    vector<Int> improved;
+    auto enumBlock = [&]( Int b )
+    {
+        const Range<Int> ind = blocks[b];
+        auto blockCtrl( enumCtrl );
+        if( ctrl.variableEnumType )
+            blockCtrl.enumType = ctrl.enumTypeFunc(ind.beg);
+
+        Matrix<F> v;
+        auto BEnum = B( ALL, ind );
+        auto QREnum = QR( ind, ind );
+        const Range<Int> windowInd =
+          IR(0,Min(ctrl.multiEnumWindow,ind.end-ind.beg));
+        auto normUpperBounds =
+          GetRealPartOfDiagonal(QREnum(windowInd,windowInd));
+        Scale( Min(Sqrt(ctrl.lllCtrl.delta),Real(1)), normUpperBounds );
+        std::pair<Real,Int> minPair;
+        if( maintainU )
+        {
+            auto UEnum = U( ALL, ind );
+            minPair = MultiShortestVectorEnrichment
+              ( BEnum, UEnum, QREnum, normUpperBounds, v, blockCtrl );
+        }
+        else
+            minPair = MultiShortestVectorEnrichment
+              ( BEnum, QREnum, normUpperBounds, v, blockCtrl );
+
+        const Int insertionInd = minPair.second;
+        const Real oldProjNorm = RealPart(QREnum(insertionInd,insertionInd));
+        improved[b] = ( minPair.first < oldProjNorm );
+    };
+
+    Timer tourTimer;
+    vector<double> tourTimes;
+    vector<Real> tourRootHermiteFactors;
+    LLLInfo<Real> lllInfo;
+    Int numEnums=0, numEnumFailures=0, numUnchangedTours=0;
+    const Int indent = PushIndent();
+    for( Int tour=0; numUnchangedTours<numOffsets; ++tour )
+    {
+        if( ctrl.checkpoint )
+        {
+            Write( B, ctrl.checkpointFileBase, ctrl.checkpointFormat, "B" );
+            Write( B, ctrl.tourFileBase, ctrl.checkpointFormat, "B" );
+        }
+        tourTimer.Start();
+
+        blocks.clear();
+        const Int offset = Mod(tour*stagger,ctrl.blocksize);
+        if( offset >= 2 && offset <= rank )
+            blocks.push_back( IR(0,offset) );
+        for( Int j=offset; j<rank-1; )
+        {
+            Int bsize = ctrl.blocksize;
+            if( ctrl.variableBlocksize )
+                bsize = Max(ctrl.blocksizeFunc(j),Int(2));
+            const Int k = Min(j+bsize,rank);
+            blocks.push_back( IR(j,k) );
+            j = k;
+        }
+        const Int numBlocks = blocks.size();
+        improved.assign( numBlocks, 0 );
+
+        // The enrichment of a block only modifies its own columns of B (and
+        // U), but BigFloat enumerations depend upon the global MPFR precision
+        // and the pruned (GNR_ENUM) and y-sparse (YSPARSE_ENUM) enumerations
+        // draw from the shared Generator(), so only full enumerations in a
+        // fixed precision are run concurrently
+        bool enumerated = false;
+#ifdef EL_HYBRID
+        const bool threadSafeEnum =
+          IsFixedPrecision<Real>::value &&
+          enumCtrl.enumType == FULL_ENUM && !ctrl.variableEnumType;
+        if( threadSafeEnum && numBlocks > 1 && !omp_in_parallel() )
+        {
+            // An exception thrown by one block's enumeration is recorded
+            // (the first one wins) and rethrown once every thread has joined
+            std::exception_ptr exception;
+            #pragma omp parallel for schedule(dynamic)
+            for( Int b=0; b<numBlocks; ++b )
+            {
+                try
+                {
+                    enumBlock( b );
+                }
+                catch( ... )
+                {
+                    #pragma omp critical
+                    {
+                        if( !exception )
+                            exception = std::current_exception();
+                    }
+                }
+            }
+            if( exception )
+                std::rethrow_exception( exception );
+            enumerated = true;
+        }
+#endif
+        if( !enumerated )
+            for( Int b=0; b<numBlocks; ++b )
+                enumBlock( b );
+        numEnums += numBlocks;
+
+        Int numImproved=0, firstImproved=rank;
+        for( Int b=0; b<numBlocks; ++b )
+        {
+            if( improved[b] )
+            {
+                ++numImproved;
+                firstImproved = Min(firstImproved,blocks[b].beg);
+            }
+        }
+        numEnumFailures += numImproved;
+
+        if( numImproved > 0 )
+        {
+            LLLCtrl<Real> mergeCtrl( ctrl.lllCtrl );
+            mergeCtrl.jumpstart = true;
+            mergeCtrl.startCol = firstImproved;
+            mergeCtrl.recursive = false;
+            mergeCtrl.segmented = false;
+            if( maintainU )
+                lllInfo = LLLWithQ( B, U, QR, t, d, mergeCtrl );
+            else
+                lllInfo = LLLWithQ( B, QR, t, d, mergeCtrl );
+            numSwaps += lllInfo.numSwaps;
+            numUnchangedTours = 0;
+        }
+        else
+            ++numUnchangedTours;
+
+        tourTimes.push_back( tourTimer.Stop() );
+        tourRootHermiteFactors.push_back( lll::RootHermiteFactor(QR) );
+        if( ctrl.time )
+            Output("Tour ",tour," time: ",tourTimes.back()," seconds");
+        if( ctrl.time || ctrl.progress )
+            Output
+            ("Tour ",tour," improved ",numImproved," of ",numBlocks,
+             " blocks; root Hermite factor: ",tourRootHermiteFactors.back());
+
+        if( ctrl.earlyAbort && numEnums >= ctrl.numEnumsBeforeAbort )
+            break;
+    }
+    SetIndent( indent );
+
+    // Perform a final pass to get the full LLL info
+    LLLCtrl<Real> subLLLCtrl( ctrl.lllCtrl );
+    subLLLCtrl.jumpstart = true;
+    subLLLCtrl.startCol = n-1;
+    subLLLCtrl.recursive = false;
+    subLLLCtrl.segmented = false;
+    if( maintainU )
+        lllInfo = LLLWithQ( B, U, QR, t, d, subLLLCtrl );
+    else
+        lllInfo = LLLWithQ( B, QR, t, d, subLLLCtrl );
+    if( lllInfo.numSwaps != 0 )
+        LogicError("Final LLL performed ",lllInfo.numSwaps," swaps");
+
+    BKZInfo<Real> info;
+    info.delta = lllInfo.delta;
+    info.eta = lllInfo.eta;
+    info.rank = lllInfo.rank;
+    info.nullity = lllInfo.nullity;
+    info.numSwaps = numSwaps;
+    info.numEnums = numEnums;
+    info.numEnumFailures = numEnumFailures;
+    info.logVol = lllInfo.logVol;
+    info.tourTimes = tourTimes;
+    info.tourRootHermiteFactors = tourRootHermiteFactors;
+    return info;
+}
+
 } // namespace bkz
 
 template<typename F>
@@ -537,6 +767,9 @@ BKZInfo<Base<F>> BKZWithQ
     }
     // The zero columns should be at the end of B
     const Int rank = lllInfo.rank;
+    if( ctrl.parallelTours )
+        return bkz::ParallelTours
+          ( B, U, QR, t, d, true, rank, numSwaps, ctrl );
 
     ofstream failedEnumFile, streakSizesFile,
              normsFile, projNormsFile,
@@ -681,6 +914,7 @@ BKZInfo<Base<F>> BKZWithQ
             subCtrl.enumCtrl.progress = false;
             subCtrl.lllCtrl.jumpstart = false;
             subCtrl.lllCtrl.recursive = false;
+            subCtrl.lllCtrl.segmented = false;
             if( ctrl.progress )
               Output("Running sub-BKZ with blocksize=",subCtrl.blocksize);
             auto bkzInfo = BKZWithQ( BSub, W, QRSub, tSub, dSub, subCtrl );
@@ -698,6 +932,7 @@ BKZInfo<Base<F>> BKZWithQ
             subLLLCtrl.jumpstart = true;
             subLLLCtrl.startCol = ( keptMin ? j : h-1 );
             subLLLCtrl.recursive = false;
+            subLLLCtrl.segmented = false;
             lllInfo = LLLWithQ( BSub, W, QRSub, tSub, dSub, subLLLCtrl );
             if( lllInfo.numSwaps != 0 )
                 changed = true;
@@ -734,6 +969,7 @@ BKZInfo<Base<F>> BKZWithQ
     subLLLCtrl.jumpstart = true;
     subLLLCtrl.startCol = n-1;
     subLLLCtrl.recursive = false;
+    subLLLCtrl.segmented = false;
     lllInfo = LLLWithQ( B, U, QR, t, d, subLLLCtrl );
     if( lllInfo.numSwaps != 0 )
         LogicError("Final LLL performed ",lllInfo.numSwaps," swaps");
@@ -899,6 +1135,12 @@ BKZInfo<Base<F>> BKZWithQ
     }
     // The zero columns should be at the end of B
     const Int rank = lllInfo.rank;
+    if( ctrl.parallelTours )
+    {
+        Matrix<F> U;
+        return bkz::ParallelTours
+          ( B, U, QR, t, d, false, rank, numSwaps, ctrl );
+    }
 
     ofstream failedEnumFile, streakSizesFile,
              normsFile, projNormsFile,
@@ -1039,6 +1281,7 @@ BKZInfo<Base<F>> BKZWithQ
             subCtrl.enumCtrl.progress = false;
             subCtrl.lllCtrl.jumpstart = false;
             subCtrl.lllCtrl.recursive = false;
+            subCtrl.lllCtrl.segmented = false;
             if( ctrl.progress )
               Output("Running sub-BKZ with blocksize=",subCtrl.blocksize);
             auto bkzInfo = BKZWithQ( BSub, QRSub, tSub, dSub, subCtrl );
@@ -1056,6 +1299,7 @@ BKZInfo<Base<F>> BKZWithQ
             subLLLCtrl.jumpstart = true;
             subLLLCtrl.startCol = ( keptMin ? j : h-1 );
             subLLLCtrl.recursive = false;
+            subLLLCtrl.segmented = false;
             lllInfo = LLLWithQ( BSub, QRSub, tSub, dSub, subLLLCtrl );
             if( lllInfo.numSwaps != 0 )
                 changed = true;
@@ -1090,6 +1334,7 @@ BKZInfo<Base<F>> BKZWithQ
     subLLLCtrl.jumpstart = true;
     subLLLCtrl.startCol = n-1;
     subLLLCtrl.recursive = false;
+    subLLLCtrl.segmented = false;
     lllInfo = LLLWithQ( B, QR, t, d, subLLLCtrl );
     if( lllInfo.numSwaps != 0 )
         LogicError("Final LLL performed ",lllInfo.numSwaps," swaps");
@@ -1199,6 +1444,7 @@ LowerPrecisionMerge
     BKZCtrl<RealLower> ctrlLower( ctrl );
     ctrlLower.recursive = false;
     ctrlLower.lllCtrl.recursive = false;
+    ctrlLower.lllCtrl.segmented = false;
     RealLower eps = limits::Epsilon<RealLower>();
     RealLower minEta = RealLower(1)/RealLower(2)+Pow(eps,RealLower(0.9));
     ctrlLower.lllCtrl.eta = Max(minEta,ctrlLower.lllCtrl.eta);
@@ -1310,6 +1556,7 @@ RecursiveHelper
         auto ctrlMod( ctrl );
         ctrlMod.recursive = false;
         ctrlMod.lllCtrl.recursive = false;
+        ctrlMod.lllCtrl.segmented = false;
         if( maintainU )
             return BKZWithQ( B, U, QR, t, d, ctrlMod );
         else
@@ -1449,6 +1696,7 @@ RecursiveHelper
             auto ctrlMod( ctrl );
             ctrlMod.recursive = false;
             ctrlMod.lllCtrl.recursive = false;
+            ctrlMod.lllCtrl.segmented = false;
             info = BKZWithQ( B, QR, t, d, ctrlMod );
             info.numSwaps += numPrevSwaps;
         }
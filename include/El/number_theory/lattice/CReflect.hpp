@@ -28,6 +28,11 @@ inline LLLInfo<float> CReflect( const ElLLLInfo_s& infoC )
     info.numSwaps = infoC.numSwaps;
     info.firstSwap = infoC.firstSwap;
     info.logVol = infoC.logVol;
+    info.numSweeps = infoC.numSweeps;
+    info.qrTime = infoC.qrTime;
+    info.localTime = infoC.localTime;
+    info.updateTime = infoC.updateTime;
+    info.finalTime = infoC.finalTime;
     return info;
 }
 
@@ -41,6 +46,11 @@ inline LLLInfo<double> CReflect( const ElLLLInfo_d& infoC )
     info.numSwaps = infoC.numSwaps;
     info.firstSwap = infoC.firstSwap;
     info.logVol = infoC.logVol;
+    info.numSweeps = infoC.numSweeps;
+    info.qrTime = infoC.qrTime;
+    info.localTime = infoC.localTime;
+    info.updateTime = infoC.updateTime;
+    info.finalTime = infoC.finalTime;
     return info;
 }
 
@@ -54,6 +64,11 @@ inline ElLLLInfo_s CReflect( const LLLInfo<float>& info )
     infoC.numSwaps = info.numSwaps;
     infoC.firstSwap = info.firstSwap;
     infoC.logVol = info.logVol;
+    infoC.numSweeps = info.numSweeps;
+    infoC.qrTime = info.qrTime;
+    infoC.localTime = info.localTime;
+    infoC.updateTime = info.updateTime;
+    infoC.finalTime = info.finalTime;
     return infoC;
 }
 
@@ -67,6 +82,11 @@ inline ElLLLInfo_d CReflect( const LLLInfo<double>& info )
     infoC.numSwaps = info.numSwaps;
     infoC.firstSwap = info.firstSwap;
     infoC.logVol = info.logVol;
+    infoC.numSweeps = info.numSweeps;
+    infoC.qrTime = info.qrTime;
+    infoC.localTime = info.localTime;
+    infoC.updateTime = info.updateTime;
+    infoC.finalTime = info.finalTime;
     return infoC;
 }
 
@@ -78,6 +98,8 @@ inline LLLCtrl<float> CReflect( const ElLLLCtrl_s& ctrlC )
     ctrl.variant = CReflect(ctrlC.variant);
     ctrl.recursive = ctrlC.recursive;
     ctrl.cutoff = ctrlC.cutoff;
+    ctrl.segmented = ctrlC.segmented;
+    ctrl.segmentSize = ctrlC.segmentSize;
     ctrl.presort = ctrlC.presort;
     ctrl.smallestFirst = ctrlC.smallestFirst;
     ctrl.reorthogTol = ctrlC.reorthogTol;
@@ -99,6 +121,8 @@ inline LLLCtrl<double> CReflect( const ElLLLCtrl_d& ctrlC )
     ctrl.variant = CReflect(ctrlC.variant);
     ctrl.recursive = ctrlC.recursive;
     ctrl.cutoff = ctrlC.cutoff;
+    ctrl.segmented = ctrlC.segmented;
+    ctrl.segmentSize = ctrlC.segmentSize;
     ctrl.presort = ctrlC.presort;
     ctrl.smallestFirst = ctrlC.smallestFirst;
     ctrl.reorthogTol = ctrlC.reorthogTol;
@@ -120,6 +144,8 @@ inline ElLLLCtrl_s CReflect( const LLLCtrl<float>& ctrl )
     ctrlC.variant = CReflect(ctrl.variant);
     ctrlC.recursive = ctrl.recursive;
     ctrlC.cutoff = ctrl.cutoff;
+    ctrlC.segmented = ctrl.segmented;
+    ctrlC.segmentSize = ctrl.segmentSize;
     ctrlC.presort = ctrl.presort;
     ctrlC.smallestFirst = ctrl.smallestFirst;
     ctrlC.reorthogTol = ctrl.reorthogTol;
@@ -141,6 +167,8 @@ inline ElLLLCtrl_d CReflect( const LLLCtrl<double>& ctrl )
     ctrlC.variant = CReflect(ctrl.variant);
     ctrlC.recursive = ctrl.recursive;
     ctrlC.cutoff = ctrl.cutoff;
+    ctrlC.segmented = ctrl.segmented;
+    ctrlC.segmentSize = ctrl.segmentSize;
     ctrlC.presort = ctrl.presort;
     ctrlC.smallestFirst = ctrl.smallestFirst;
     ctrlC.reorthogTol = ctrl.reorthogTol;
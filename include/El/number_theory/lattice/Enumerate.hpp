@@ -62,6 +62,21 @@ struct EnumCtrl
 
     Int progressLevel=0;
 
+    // Parallel enumeration (FULL_ENUM and GNR_ENUM)
+    // ---------------------------------------------
+    // If 'parallel' is true, the enumeration tree is split 'splitDepth'
+    // levels beneath its root into subtrees which are dealt round-robin over
+    // the processes of 'comm' and load-balanced over the OpenMP threads of
+    // each process (when EL_HYBRID is enabled). A 'splitDepth' of zero selects
+    // the shallowest depth yielding 'subtreesPerWorker' subtrees per thread.
+    // The threads of a process share the best radius found so far, rereading
+    // it every 'syncInterval' nodes.
+    bool parallel=false;
+    Int splitDepth=0;
+    Int subtreesPerWorker=16;
+    Int syncInterval=1024;
+    mpi::Comm comm=mpi::COMM_SELF;
+
     template<typename OtherReal>
     EnumCtrl<Real>& operator=( const EnumCtrl<OtherReal>& ctrl )
     {
@@ -97,6 +112,12 @@ struct EnumCtrl
 
         progressLevel = ctrl.progressLevel;
 
+        parallel = ctrl.parallel;
+        splitDepth = ctrl.splitDepth;
+        subtreesPerWorker = ctrl.subtreesPerWorker;
+        syncInterval = ctrl.syncInterval;
+        comm = ctrl.comm;
+
         return *this;
     }
 
@@ -386,6 +407,19 @@ Base<F> GNREnumeration
         Matrix<F>& v,
   const EnumCtrl<Base<F>>& ctrl=EnumCtrl<Base<F>>() );
 
+// A parallel version of GNREnumeration (see EnumCtrl::parallel). If
+// 'findShortest' is true, rather than returning the first vector satisfying
+// the bounds, the bounds are tightened (in proportion) upon each success so
+// that the shortest such vector is returned.
+template<typename F>
+Base<F> ParallelGNREnumeration
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& N,
+  const Matrix<Base<F>>& u,
+        Matrix<F>& v,
+  const EnumCtrl<Base<F>>& ctrl=EnumCtrl<Base<F>>(),
+        bool findShortest=false );
+
 // Convert to/from the so-called "y-sparse" representation of
 //
 //   Dan Ding, Guizhen Zhu, Yang Yu, and Zhongxiang Zheng,
@@ -110,6 +110,13 @@ struct LLLInfo
     Int firstSwap;
     Real logVol;
 
+    // Only filled by segmented LLL
+    Int numSweeps=0;
+    double qrTime=0;
+    double localTime=0;
+    double updateTime=0;
+    double finalTime=0;
+
     template<typename OtherReal>
     LLLInfo<Real>& operator=( const LLLInfo<OtherReal>& info )
     {
@@ -120,6 +127,11 @@ struct LLLInfo
         numSwaps = info.numSwaps;
         firstSwap = info.firstSwap;
         logVol = Real(info.logVol);
+        numSweeps = info.numSweeps;
+        qrTime = info.qrTime;
+        localTime = info.localTime;
+        updateTime = info.updateTime;
+        finalTime = info.finalTime;
         return *this;
     }
 
@@ -169,6 +181,13 @@ struct LLLCtrl
     bool recursive=false;
     Int cutoff=10;
 
+    // If 'segmented' is true, bases with more than 'segmentSize' columns are
+    // reduced by alternating between a blocked QR factorization of the
+    // entire basis and LLL on disjoint segments of the triangular factor,
+    // with each segment's transformation applied to B via a Gemm
+    bool segmented=false;
+    Int segmentSize=64;
+
     // Fudge factor for determining whether to drop precision
     Real precisionFudge=Real(2);
 
@@ -225,6 +244,8 @@ struct LLLCtrl
         variant = ctrl.variant;
         recursive = ctrl.recursive;
         cutoff = ctrl.cutoff;
+        segmented = ctrl.segmented;
+        segmentSize = ctrl.segmentSize;
         presort = ctrl.presort;
         smallestFirst = ctrl.smallestFirst;
         reorthogTol = Real(ctrl.reorthogTol);
@@ -258,6 +279,8 @@ struct LLLCtrl
         variant = ctrl.variant;
         recursive = ctrl.recursive;
         cutoff = ctrl.cutoff;
+        segmented = ctrl.segmented;
+        segmentSize = ctrl.segmentSize;
         presort = ctrl.presort;
         smallestFirst = ctrl.smallestFirst;
         reorthogTol = Real(ctrl.reorthogTol);
@@ -314,6 +337,54 @@ LLLInfo<Base<F>> LLLWithQ
   Matrix<Base<F>>& d,
   const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
 
+// Adaptive-precision LLL
+// ----------------------
+// Rather than computing every Householder step in the precision of F, which
+// is expensive for BigFloat, keep B (and U) in its exact type Z and reduce
+// it with a sequence of passes. Each pass runs LLL on a copy of B rounded to
+// the cheapest of double, DoubleDouble/QuadDouble (or Quad), and a reduced
+// BigFloat precision which holds the current basis, and then applies the
+// unimodular transformation exactly. A failed pass escalates the precision
+// of all later passes. The result is certified by a final pass in the
+// precision of F. That pass is usually a single QR factorization, since the
+// basis is then already reduced.
+//
+// For example, a BigInt basis would be reduced with F=BigFloat.
+template<typename Z,typename F=Z>
+LLLInfo<Base<F>> AdaptiveLLL
+( Matrix<Z>& B,
+  const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
+
+template<typename Z,typename F=Z>
+LLLInfo<Base<F>> AdaptiveLLL
+( Matrix<Z>& B,
+  Matrix<F>& R,
+  const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
+
+template<typename Z,typename F=Z>
+LLLInfo<Base<F>> AdaptiveLLL
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  Matrix<F>& R,
+  const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
+
+template<typename Z,typename F=Z>
+LLLInfo<Base<F>> AdaptiveLLLWithQ
+( Matrix<Z>& B,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
+
+template<typename Z,typename F=Z>
+LLLInfo<Base<F>> AdaptiveLLLWithQ
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
+
 namespace lll {
 
 static Timer stepTimer, houseStepTimer,
@@ -418,6 +489,27 @@ Base<F> LogVolume( const Matrix<F>& R )
     return logVol;
 }
 
+// Return the root Hermite factor, (|| b_0 ||_2 / |det(L)|^{1/n})^{1/n}, of the
+// lattice L with rank n whose basis has the upper-triangular factor R
+template<typename F>
+Base<F> RootHermiteFactor( const Matrix<F>& R )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int minDim = Min(R.Height(),R.Width());
+
+    Int rank = 0;
+    for( Int j=0; j<minDim; ++j )
+        if( RealPart(R(j,j)) > Real(0) )
+            ++rank;
+    if( rank == 0 )
+        return Real(1);
+
+    const Real logVol = LogVolume( R );
+    const Real logb0Norm = Log(RealPart(R(0,0)));
+    return Exp((logb0Norm-logVol/Real(rank))/Real(rank));
+}
+
 } // namespace lll
 
 } // namespace El
@@ -440,6 +532,11 @@ LLLInfo<Base<F>> LLLWithQ
     const Int n = B.Width();
     if( ctrl.recursive && ctrl.cutoff < n )
         return RecursiveLLLWithQ( B, U, QR, t, d, ctrl );
+    // Jumpstarted reductions are typically cheap updates of an already
+    // reduced basis, which the segmented sweeps would redo from scratch
+    if( ctrl.segmented && ctrl.segmentSize < n &&
+        !(ctrl.jumpstart && ctrl.startCol > 0) )
+        return SegmentedLLLWithQ( B, U, QR, t, d, ctrl );
 
     if( ctrl.delta < Real(1)/Real(2) )
         LogicError("delta is assumed to be at least 1/2");
@@ -524,6 +621,11 @@ LLLWithQ
     const Int n = B.Width();
     if( ctrl.recursive && ctrl.cutoff < n )
         return RecursiveLLLWithQ( B, QR, t, d, ctrl );
+    // Jumpstarted reductions are typically cheap updates of an already
+    // reduced basis, which the segmented sweeps would redo from scratch
+    if( ctrl.segmented && ctrl.segmentSize < n &&
+        !(ctrl.jumpstart && ctrl.startCol > 0) )
+        return SegmentedLLLWithQ( B, QR, t, d, ctrl );
 
     if( ctrl.delta < Real(1)/Real(2) )
         LogicError("delta is assumed to be at least 1/2");
@@ -698,6 +800,7 @@ LowerPrecisionMerge
 
     LLLCtrl<RealLower> ctrlLower( ctrl );
     ctrlLower.recursive = false;
+    ctrlLower.segmented = false;
     RealLower eps = limits::Epsilon<RealLower>();
     RealLower minEta = RealLower(1)/RealLower(2)+Pow(eps,RealLower(0.9));
     ctrlLower.eta = Max(minEta,ctrlLower.eta);
@@ -832,6 +935,7 @@ RecursiveHelper
     {
         auto ctrlMod( ctrl );
         ctrlMod.recursive = false;
+        ctrlMod.segmented = false;
         if( maintainU )
             return LLLWithQ( B, U, QR, t, d, ctrlMod );
         else
@@ -1001,6 +1105,7 @@ RecursiveHelper
             ctrlMod.jumpstart = true;
             ctrlMod.startCol = 0;
             ctrlMod.recursive = false;
+            ctrlMod.segmented = false;
             if( maintainU )
             {
                 auto UCopy( U );
@@ -1131,4 +1236,7 @@ void DeepRowSwap( Matrix<Z>& B, Int i, Int k )
 
 } // namespace El
 
+#include <El/number_theory/lattice/LLL/Adaptive.hpp>
+#include <El/number_theory/lattice/LLL/Segment.hpp>
+
 #endif // ifndef EL_LATTICE_LLL_HPP
@@ -0,0 +1,341 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LATTICE_LLL_ADAPTIVE_HPP
+#define EL_LATTICE_LLL_ADAPTIVE_HPP
+
+namespace El {
+namespace lll {
+
+// Run LLL on a copy of the exact basis B converted to the precision RealLower
+// and apply the resulting unimodular transformation to B (and U) in the
+// original arithmetic. Since B is only ever modified by integer column
+// operations, it remains an exact basis for the same lattice no matter how
+// inaccurate the Householder data of the pass was.
+//
+// If the pass fails, or its transformation cannot be exactly represented
+// in RealLower, then B is left untouched, 'minPrec' is raised past
+// 'lowerPrec', and false is returned.
+template<typename RealLower,typename Z,typename Real>
+bool AdaptivePassHelper
+(       Matrix<Z>& B,
+        Matrix<Z>& U,
+        bool maintainU,
+  const LLLCtrl<Real>& ctrl,
+        unsigned lowerPrec,
+        unsigned& minPrec,
+        bool& changed,
+        LLLInfo<Real>& info )
+{
+    EL_DEBUG_CSE
+    typedef ConvertBase<Z,RealLower> FLower;
+    const string typeString = TypeName<RealLower>();
+
+    LLLCtrl<RealLower> ctrlLower( ctrl );
+    ctrlLower.recursive = false;
+    ctrlLower.segmented = false;
+    ctrlLower.jumpstart = false;
+    ctrlLower.progress = false;
+    ctrlLower.time = false;
+
+    Matrix<FLower> BLower, ULower, QRLower, tLower;
+    Matrix<RealLower> dLower;
+    LLLInfo<RealLower> infoLower;
+    try
+    {
+        Copy( B, BLower );
+        infoLower =
+          LLLWithQ( BLower, ULower, QRLower, tLower, dLower, ctrlLower );
+    }
+    catch( std::exception& e )
+    {
+        if( ctrl.progress )
+            Output("  " + typeString + " pass failed: ",e.what());
+        minPrec = lowerPrec+1;
+        return false;
+    }
+
+    // Integers are only exactly representable up to 2^lowerPrec
+    const RealLower UMax = MaxNorm( ULower );
+    if( !limits::IsFinite(UMax) ||
+        UMax >= Pow(RealLower(2),RealLower(lowerPrec)) )
+    {
+        if( ctrl.progress )
+            Output
+            ("  " + typeString + " pass produced a transformation with "
+             "|| U ||_max=",UMax);
+        minPrec = lowerPrec+1;
+        return false;
+    }
+
+    const Int n = ULower.Width();
+    changed = false;
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<n; ++i )
+            if( ULower(i,j) != FLower(i==j ? 1 : 0) )
+                changed = true;
+    if( changed )
+    {
+        Matrix<Z> UPass;
+        Copy( ULower, UPass );
+        auto BCopy( B );
+        Gemm( NORMAL, NORMAL, Z(1), BCopy, UPass, Z(0), B );
+        if( maintainU )
+        {
+            auto UCopy( U );
+            Gemm( NORMAL, NORMAL, Z(1), UCopy, UPass, Z(0), U );
+        }
+    }
+    if( ctrl.progress || ctrl.time )
+        Output
+        ("  " + typeString + " pass performed ",infoLower.numSwaps," swaps");
+
+    info.numSwaps += infoLower.numSwaps;
+    info.firstSwap = Min(info.firstSwap,infoLower.firstSwap);
+    return true;
+}
+
+template<typename RealLower,typename Z,typename Real>
+bool AdaptivePass
+(       Matrix<Z>& B,
+        Matrix<Z>& U,
+        bool maintainU,
+  const LLLCtrl<Real>& ctrl,
+        unsigned neededPrec,
+        unsigned& minPrec,
+        bool& changed,
+        LLLInfo<Real>& info )
+{
+    const unsigned lowerPrec = MantissaBits<RealLower>::value;
+    if( !MantissaIsLonger<Real,RealLower>::value ||
+        lowerPrec < Max(neededPrec,minPrec) )
+        return false;
+    return AdaptivePassHelper<RealLower>
+      ( B, U, maintainU, ctrl, lowerPrec, minPrec, changed, info );
+}
+
+#ifdef EL_HAVE_MPC
+template<typename Z,typename Real>
+bool AdaptiveBigFloatPass
+(       Matrix<Z>& B,
+        Matrix<Z>& U,
+        bool maintainU,
+  const LLLCtrl<Real>& ctrl,
+        unsigned neededPrec,
+        unsigned& minPrec,
+        bool& changed,
+        LLLInfo<Real>& info )
+{
+    bool succeeded = false;
+    if( !IsFixedPrecision<Real>::value )
+    {
+        // Only move down to a lower-precision MPFR type if the jump is
+        // substantial (as in lll::TryLowerPrecisionBigFloatMerge)
+        const mpfr_prec_t minPrecDiff = 32;
+        const mpfr_prec_t inputPrec = mpfr::Precision();
+        const unsigned lowerPrec = Max(neededPrec,minPrec);
+        if( mpfr_prec_t(lowerPrec) <= inputPrec-minPrecDiff )
+        {
+            mpfr::SetPrecision( lowerPrec );
+            succeeded = AdaptivePassHelper<BigFloat>
+              ( B, U, maintainU, ctrl, lowerPrec, minPrec, changed, info );
+            mpfr::SetPrecision( inputPrec );
+        }
+    }
+    return succeeded;
+}
+#endif
+
+template<typename Z,typename F>
+LLLInfo<Base<F>>
+AdaptiveHelper
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  bool maintainU,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = B.Width();
+    if( ctrl.jumpstart && ctrl.startCol > 0 )
+        LogicError("Adaptive LLL cannot be jumpstarted");
+    if( maintainU && !ctrl.jumpstart )
+        Identity( U, n, n );
+
+    LLLInfo<Real> info;
+    info.numSwaps = 0;
+    info.firstSwap = n;
+
+    auto passCtrl( ctrl );
+    if( IsInteger( B ) )
+    {
+        // A pass which changes the basis is followed by another so that
+        // the precision can track the shrinking basis vectors, but a
+        // sequence of passes which do not settle is abandoned
+        const Int maxPasses = 16;
+
+        Timer timer;
+        unsigned minPrec = 0;
+        for( Int pass=0; pass<maxPasses; ++pass )
+        {
+            Matrix<F> BF;
+            Copy( B, BF );
+            const Real BOneNorm = OneNorm( BF );
+            const Real fudge = ctrl.precisionFudge;
+            const unsigned neededPrec =
+              ( BOneNorm > Real(1) ?
+                unsigned(Ceil(Log2(BOneNorm)*fudge)) : 0u );
+            if( ctrl.progress || ctrl.time )
+                Output("Adaptive LLL pass ",pass," needs ",neededPrec," bits");
+
+            if( ctrl.time )
+                timer.Start();
+            bool changed = false;
+            bool succeeded = AdaptivePass<double>
+              ( B, U, maintainU, passCtrl, neededPrec, minPrec, changed,
+                info );
+#ifdef EL_HAVE_QD
+            if( !succeeded )
+                succeeded = AdaptivePass<DoubleDouble>
+                  ( B, U, maintainU, passCtrl, neededPrec, minPrec, changed,
+                    info );
+            if( !succeeded )
+                succeeded = AdaptivePass<QuadDouble>
+                  ( B, U, maintainU, passCtrl, neededPrec, minPrec, changed,
+                    info );
+#elif defined(EL_HAVE_QUAD)
+            if( !succeeded )
+                succeeded = AdaptivePass<Quad>
+                  ( B, U, maintainU, passCtrl, neededPrec, minPrec, changed,
+                    info );
+#endif
+#ifdef EL_HAVE_MPC
+            if( !succeeded )
+                succeeded = AdaptiveBigFloatPass
+                  ( B, U, maintainU, passCtrl, neededPrec, minPrec, changed,
+                    info );
+#endif
+            if( ctrl.time )
+                Output("  pass time: ",timer.Stop()," seconds");
+            if( !succeeded )
+                break;
+            // Any requested presorting has been applied by the first pass
+            passCtrl.presort = false;
+            if( !changed )
+                break;
+        }
+    }
+
+    // Finish (and certify) the reduction in the full precision. This should
+    // typically only involve a single QR factorization of a reduced basis.
+    passCtrl.recursive = false;
+    passCtrl.segmented = false;
+    passCtrl.jumpstart = false;
+    passCtrl.startCol = 0;
+    LLLInfo<Real> finalInfo;
+    if( maintainU )
+    {
+        Matrix<Z> UFinal;
+        finalInfo = LLLWithQ( B, UFinal, QR, t, d, passCtrl );
+        auto UCopy( U );
+        Gemm( NORMAL, NORMAL, Z(1), UCopy, UFinal, Z(0), U );
+    }
+    else
+        finalInfo = LLLWithQ( B, QR, t, d, passCtrl );
+    if( ctrl.progress || ctrl.time )
+        Output
+        ("Final ",TypeName<Real>()," pass performed ",finalInfo.numSwaps,
+         " swaps");
+
+    finalInfo.numSwaps += info.numSwaps;
+    finalInfo.firstSwap = Min(finalInfo.firstSwap,info.firstSwap);
+    return finalInfo;
+}
+
+} // namespace lll
+
+template<typename Z,typename F>
+LLLInfo<Base<F>>
+AdaptiveLLLWithQ
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const bool maintainU = true;
+    return lll::AdaptiveHelper( B, U, QR, t, d, maintainU, ctrl );
+}
+
+template<typename Z,typename F>
+LLLInfo<Base<F>>
+AdaptiveLLLWithQ
+( Matrix<Z>& B,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Z> U;
+    const bool maintainU = false;
+    return lll::AdaptiveHelper( B, U, QR, t, d, maintainU, ctrl );
+}
+
+template<typename Z,typename F>
+LLLInfo<Base<F>>
+AdaptiveLLL
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  Matrix<F>& R,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    Matrix<F> t;
+    Matrix<Real> d;
+    auto info = AdaptiveLLLWithQ( B, U, R, t, d, ctrl );
+    MakeTrapezoidal( UPPER, R );
+    return info;
+}
+
+template<typename Z,typename F>
+LLLInfo<Base<F>>
+AdaptiveLLL
+( Matrix<Z>& B,
+  Matrix<F>& R,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    Matrix<F> t;
+    Matrix<Real> d;
+    auto info = AdaptiveLLLWithQ( B, R, t, d, ctrl );
+    MakeTrapezoidal( UPPER, R );
+    return info;
+}
+
+template<typename Z,typename F>
+LLLInfo<Base<F>>
+AdaptiveLLL
+( Matrix<Z>& B,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<F> R;
+    return AdaptiveLLL( B, R, ctrl );
+}
+
+} // namespace El
+
+#endif // ifndef EL_LATTICE_LLL_ADAPTIVE_HPP
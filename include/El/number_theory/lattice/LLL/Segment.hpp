@@ -0,0 +1,287 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LATTICE_LLL_SEGMENT_HPP
+#define EL_LATTICE_LLL_SEGMENT_HPP
+
+namespace El {
+namespace lll {
+
+// Size reduce every column of the upper-triangular matrix R against its
+// predecessors and return the unit upper-triangular integer transformation
+// T such that B T is the size-reduced basis. Since only multiples of
+// earlier columns are added, the Gram-Schmidt vectors are unchanged.
+template<typename F>
+void SegmentSizeReduce
+( Matrix<F>& R,
+  Matrix<F>& T,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = R.Height();
+    const Int n = R.Width();
+    const Int minDim = Min(m,n);
+    Identity( T, n, n );
+    for( Int k=1; k<n; ++k )
+    {
+        for( Int i=Min(k,minDim)-1; i>=0; --i )
+        {
+            const Real rho_i_i = RealPart(R(i,i));
+            if( Abs(rho_i_i) <= ctrl.zeroTol )
+                continue;
+            F chi = R(i,k)/rho_i_i;
+            if( Abs(RealPart(chi)) > ctrl.eta ||
+                Abs(ImagPart(chi)) > ctrl.eta )
+            {
+                chi = Round(chi);
+                blas::Axpy( i+1, -chi, &R(0,i), 1, &R(0,k), 1 );
+                blas::Axpy( i+1, -chi, &T(0,i), 1, &T(0,k), 1 );
+            }
+        }
+    }
+}
+
+template<typename F>
+bool IsIdentity( const Matrix<F>& U )
+{
+    EL_DEBUG_CSE
+    const Int n = U.Width();
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<n; ++i )
+            if( U(i,j) != F(i==j ? 1 : 0) )
+                return false;
+    return true;
+}
+
+// Apply the integer transformation T to the columns of B (and U) with
+// a Level 3 update
+template<typename Z,typename F>
+void SegmentUpdate
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  const Matrix<F>& T,
+  Range<Int> ind,
+  bool maintainU )
+{
+    EL_DEBUG_CSE
+    Matrix<Z> TZ;
+    Copy( T, TZ );
+
+    auto BSeg = B( ALL, ind );
+    auto BSegCopy( BSeg );
+    Gemm( NORMAL, NORMAL, Z(1), BSegCopy, TZ, Z(0), BSeg );
+    if( maintainU )
+    {
+        auto USeg = U( ALL, ind );
+        auto USegCopy( USeg );
+        Gemm( NORMAL, NORMAL, Z(1), USegCopy, TZ, Z(0), USeg );
+    }
+}
+
+template<typename Z,typename F>
+LLLInfo<Base<F>>
+SegmentHelper
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  bool maintainU,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = B.Height();
+    const Int n = B.Width();
+    const Int minDim = Min(m,n);
+    const Int segSize = ctrl.segmentSize;
+    if( segSize < 2 )
+        LogicError("Segments must contain at least two columns");
+    if( maintainU && !ctrl.jumpstart )
+        Identity( U, n, n );
+
+    auto localCtrl( ctrl );
+    localCtrl.segmented = false;
+    localCtrl.recursive = false;
+    localCtrl.jumpstart = false;
+    localCtrl.startCol = 0;
+    localCtrl.presort = false;
+    localCtrl.progress = false;
+    localCtrl.time = false;
+
+    LLLInfo<Real> info;
+    info.numSwaps = 0;
+    info.firstSwap = n;
+
+    Timer timer;
+    Matrix<F> R, T;
+    Real oldLogPotential = 0;
+    bool prevChanged = false;
+    Int numQuietSweeps = 0;
+    Int sweep = 0;
+    // Two consecutive sweeps without a local swap cover every boundary
+    // between neighbouring segments, so the basis is then nearly reduced
+    while( numQuietSweeps < 2 )
+    {
+        // Form the Gram-Schmidt data of the entire basis with a blocked
+        // Householder QR factorization
+        timer.Start();
+        Copy( B, QR );
+        El::QR( QR, t, d );
+        R = QR;
+        MakeTrapezoidal( UPPER, R );
+        info.qrTime += timer.Stop();
+
+        // Floating-point errors can lead to local reductions which undo one
+        // another, so stop as soon as they no longer decrease the potential
+        Real logPotential = 0;
+        for( Int j=0; j<minDim; ++j )
+        {
+            const Real rho_j_j = Abs(R(j,j));
+            if( rho_j_j > ctrl.zeroTol )
+                logPotential += 2*(n-j)*Log(rho_j_j);
+        }
+        if( prevChanged && logPotential >= oldLogPotential )
+            break;
+        oldLogPotential = logPotential;
+
+        timer.Start();
+        SegmentSizeReduce( R, T, ctrl );
+        info.updateTime += timer.Stop();
+        if( !IsIdentity( T ) )
+        {
+            timer.Start();
+            SegmentUpdate( B, U, T, IR(0,n), maintainU );
+            info.updateTime += timer.Stop();
+        }
+
+        // Alternate the segment boundaries between sweeps so that vectors
+        // can move between neighbouring segments
+        const Int offset = ( sweep % 2 == 0 ? 0 : segSize/2 );
+        vector<Int> bounds(1,0);
+        for( Int j=offset; j<minDim; j+=segSize )
+            if( j > 0 )
+                bounds.push_back( j );
+        bounds.push_back( minDim );
+
+        Int numSweepSwaps = 0;
+        bool changed = false;
+        const Int numSegments = bounds.size()-1;
+        for( Int s=0; s<numSegments; ++s )
+        {
+            const Range<Int> ind(bounds[s],bounds[s+1]);
+            if( ind.end-ind.beg < 2 )
+                continue;
+
+            timer.Start();
+            Matrix<F> RSeg( R(ind,ind) ), USeg, RSegRed;
+            auto segInfo = LLL( RSeg, USeg, RSegRed, localCtrl );
+            info.localTime += timer.Stop();
+            if( IsIdentity( USeg ) )
+                continue;
+
+            timer.Start();
+            SegmentUpdate( B, U, USeg, ind, maintainU );
+            info.updateTime += timer.Stop();
+
+            changed = true;
+            numSweepSwaps += segInfo.numSwaps;
+            info.firstSwap = Min(info.firstSwap,ind.beg+segInfo.firstSwap);
+        }
+        info.numSwaps += numSweepSwaps;
+        if( ctrl.progress || ctrl.time )
+            Output
+            ("Segmented LLL sweep ",sweep," performed ",numSweepSwaps,
+             " swaps");
+
+        numQuietSweeps = ( changed ? 0 : numQuietSweeps+1 );
+        prevChanged = changed;
+        ++sweep;
+    }
+
+    // Certify the reduction (and fix any boundaries the sweeps could not)
+    // with a single sequential pass
+    auto finalCtrl( ctrl );
+    finalCtrl.segmented = false;
+    finalCtrl.jumpstart = false;
+    finalCtrl.startCol = 0;
+    finalCtrl.presort = false;
+    LLLInfo<Real> finalInfo;
+    timer.Start();
+    if( maintainU )
+    {
+        Matrix<Z> UFinal;
+        finalInfo = LLLWithQ( B, UFinal, QR, t, d, finalCtrl );
+        auto UCopy( U );
+        Gemm( NORMAL, NORMAL, Z(1), UCopy, UFinal, Z(0), U );
+    }
+    else
+        finalInfo = LLLWithQ( B, QR, t, d, finalCtrl );
+    finalInfo.finalTime = timer.Stop();
+    if( ctrl.progress || ctrl.time )
+        Output
+        ("Segmented LLL: ",sweep," sweeps with ",info.numSwaps," swaps, "
+         "final pass with ",finalInfo.numSwaps," swaps\n",
+         "  QR time:     ",info.qrTime," seconds\n",
+         "  local time:  ",info.localTime," seconds\n",
+         "  update time: ",info.updateTime," seconds\n",
+         "  final time:  ",finalInfo.finalTime," seconds");
+
+    finalInfo.numSwaps += info.numSwaps;
+    finalInfo.firstSwap = Min(finalInfo.firstSwap,info.firstSwap);
+    finalInfo.numSweeps = sweep;
+    finalInfo.qrTime = info.qrTime;
+    finalInfo.localTime = info.localTime;
+    finalInfo.updateTime = info.updateTime;
+    return finalInfo;
+}
+
+} // namespace lll
+
+template<typename Z,typename F>
+LLLInfo<Base<F>>
+SegmentedLLLWithQ
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.progress && ctrl.jumpstart && ctrl.startCol > 0 )
+        Output("Warning: Segmented LLL ignores jumpstarts");
+    if( ctrl.progress && ctrl.presort )
+        Output("Warning: Segmented LLL ignores presorting");
+    const bool maintainU = true;
+    return lll::SegmentHelper( B, U, QR, t, d, maintainU, ctrl );
+}
+
+template<typename Z,typename F>
+LLLInfo<Base<F>>
+SegmentedLLLWithQ
+( Matrix<Z>& B,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.progress && ctrl.jumpstart && ctrl.startCol > 0 )
+        Output("Warning: Segmented LLL ignores jumpstarts");
+    if( ctrl.progress && ctrl.presort )
+        Output("Warning: Segmented LLL ignores presorting");
+    Matrix<Z> U;
+    const bool maintainU = false;
+    return lll::SegmentHelper( B, U, QR, t, d, maintainU, ctrl );
+}
+
+} // namespace El
+
+#endif // ifndef EL_LATTICE_LLL_SEGMENT_HPP
@@ -44,6 +44,10 @@ inline ElMehrotraCtrl_s CReflect( const MehrotraCtrl<float>& ctrl )
     ctrlC.forceSameStep     = ctrl.forceSameStep;
     ctrlC.solveCtrl         = CReflect(ctrl.solveCtrl);
     ctrlC.resolveReg        = ctrl.resolveReg;
+    ctrlC.krylovKKT         = ctrl.krylovKKT;
+    ctrlC.krylovForcing     = ctrl.krylovForcing;
+    ctrlC.krylovMaxIts      = ctrl.krylovMaxIts;
+    ctrlC.warmStartFloor    = ctrl.warmStartFloor;
     ctrlC.outerEquil        = ctrl.outerEquil;
     ctrlC.basisSize         = ctrl.basisSize;
     ctrlC.print             = ctrl.print;
@@ -88,6 +92,10 @@ inline ElMehrotraCtrl_d CReflect( const MehrotraCtrl<double>& ctrl )
     ctrlC.forceSameStep     = ctrl.forceSameStep;
     ctrlC.solveCtrl         = CReflect(ctrl.solveCtrl);
     ctrlC.resolveReg        = ctrl.resolveReg;
+    ctrlC.krylovKKT         = ctrl.krylovKKT;
+    ctrlC.krylovForcing     = ctrl.krylovForcing;
+    ctrlC.krylovMaxIts      = ctrl.krylovMaxIts;
+    ctrlC.warmStartFloor    = ctrl.warmStartFloor;
     ctrlC.outerEquil        = ctrl.outerEquil;
     ctrlC.basisSize         = ctrl.basisSize;
     ctrlC.print             = ctrl.print;
@@ -125,6 +133,10 @@ inline MehrotraCtrl<float> CReflect( const ElMehrotraCtrl_s& ctrlC )
     ctrl.forceSameStep     = ctrlC.forceSameStep;
     ctrl.solveCtrl         = CReflect(ctrlC.solveCtrl);
     ctrl.resolveReg        = ctrlC.resolveReg;
+    ctrl.krylovKKT         = ctrlC.krylovKKT;
+    ctrl.krylovForcing     = ctrlC.krylovForcing;
+    ctrl.krylovMaxIts      = ctrlC.krylovMaxIts;
+    ctrl.warmStartFloor    = ctrlC.warmStartFloor;
     ctrl.outerEquil        = ctrlC.outerEquil;
     ctrl.basisSize         = ctrlC.basisSize;
     ctrl.print             = ctrlC.print;
@@ -162,6 +174,10 @@ inline MehrotraCtrl<double> CReflect( const ElMehrotraCtrl_d& ctrlC )
     ctrl.forceSameStep     = ctrlC.forceSameStep;
     ctrl.solveCtrl         = CReflect(ctrlC.solveCtrl);
     ctrl.resolveReg        = ctrlC.resolveReg;
+    ctrl.krylovKKT         = ctrlC.krylovKKT;
+    ctrl.krylovForcing     = ctrlC.krylovForcing;
+    ctrl.krylovMaxIts      = ctrlC.krylovMaxIts;
+    ctrl.warmStartFloor    = ctrlC.warmStartFloor;
     ctrl.outerEquil        = ctrlC.outerEquil;
     ctrl.basisSize         = ctrlC.basisSize;
     ctrl.print             = ctrlC.print;
@@ -53,6 +53,11 @@ typedef struct {
   float reg0Perm;
   float reg1Perm;
   float reg2Perm;
+
+  bool krylovKKT;
+  float krylovForcing;
+  ElInt krylovMaxIts;
+  float warmStartFloor;
 } ElMehrotraCtrl_s;
 
 typedef struct {
@@ -86,6 +91,11 @@ typedef struct {
   double reg0Perm;
   double reg1Perm;
   double reg2Perm;
+
+  bool krylovKKT;
+  double krylovForcing;
+  ElInt krylovMaxIts;
+  double warmStartFloor;
 } ElMehrotraCtrl_d;
 
 EL_EXPORT ElError ElMehrotraCtrlDefault_s( ElMehrotraCtrl_s* ctrl );
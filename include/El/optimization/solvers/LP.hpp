@@ -47,6 +47,51 @@ struct Ctrl
     { mehrotraCtrl.system = ( isSparse ? AUGMENTED_KKT : NORMAL_KKT ); }
 };
 
+// The symbolic analyses (nested dissections and frontal trees) of the KKT
+// systems formed by the sparse Mehrotra IPM. Passing the same instance to a
+// sequence of solves whose constraint matrices share a sparsity pattern,
+// e.g., when only 'b' and 'c' change, restricts each solve to numerical
+// factorizations. The analyses are recomputed whenever the sparsity pattern
+// of 'A' or the KKT system differs from that of the previous solve.
+//
+// NOTE: Only the direct-form sparse LP and QP solvers (see
+//       qp::direct::SparseKKTAnalysis) currently accept an analysis; the
+//       affine-form LP, QP, and SOCP solvers analyze their KKT systems anew
+//       on every solve.
+template<typename Real>
+struct SparseKKTAnalysis
+{
+    // The KKT system and the constraint matrix pattern of the analyses
+    KKTSystem system=FULL_KKT;
+    Int height=0, width=0;
+    vector<Int> offsets, targets;
+
+    // The augmented system used to compute the initial point (and, if
+    // 'system' is AUGMENTED_KKT, during the iterations)
+    bool augmentedAnalyzed=false;
+    SparseLDLFactorization<Real> augmentedFact;
+
+    // The full or normal KKT system used during the iterations
+    bool analyzed=false;
+    SparseLDLFactorization<Real> fact;
+};
+
+template<typename Real>
+struct DistSparseKKTAnalysis
+{
+    // The KKT system and the constraint matrix pattern of the analyses;
+    // each process stores the pattern of its local rows
+    KKTSystem system=FULL_KKT;
+    Int height=0, width=0;
+    vector<Int> offsets, targets;
+
+    bool augmentedAnalyzed=false;
+    DistSparseLDLFactorization<Real> augmentedFact;
+
+    bool analyzed=false;
+    DistSparseLDLFactorization<Real> fact;
+};
+
 } // namespace direct
 
 namespace affine {
@@ -261,6 +306,23 @@ void LP
         DirectLPSolution<DistMultiVec<Real>>& solution,
   const lp::direct::Ctrl<Real>& ctrl=lp::direct::Ctrl<Real>(true) );
 
+// Reuse the symbolic analyses of the KKT systems from previous solves with
+// constraint matrices of the same sparsity pattern. A warm start from a
+// previous solution is requested by setting both 'mehrotraCtrl.primalInit'
+// and 'mehrotraCtrl.dualInit' (see 'mehrotraCtrl.warmStartFloor').
+template<typename Real>
+void LP
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        DirectLPSolution<Matrix<Real>>& solution,
+        lp::direct::SparseKKTAnalysis<Real>& analysis,
+  const lp::direct::Ctrl<Real>& ctrl=lp::direct::Ctrl<Real>(true) );
+template<typename Real>
+void LP
+( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        DirectLPSolution<DistMultiVec<Real>>& solution,
+        lp::direct::DistSparseKKTAnalysis<Real>& analysis,
+  const lp::direct::Ctrl<Real>& ctrl=lp::direct::Ctrl<Real>(true) );
+
 // These interfaces are now deprecated in favor of the above.
 template<typename Real>
 [[deprecated]]
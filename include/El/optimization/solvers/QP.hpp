@@ -45,6 +45,44 @@ struct Ctrl
     Ctrl() { mehrotraCtrl.system = AUGMENTED_KKT; }
 };
 
+// The symbolic analyses of the KKT systems formed by the sparse Mehrotra IPM
+// (see lp::direct::SparseKKTAnalysis), which are recomputed whenever the
+// sparsity pattern of 'Q' or 'A', or the KKT system, differs from that of the
+// previous solve
+template<typename Real>
+struct SparseKKTAnalysis
+{
+    // The KKT system and the patterns of 'Q' and 'A' of the analyses
+    KKTSystem system=AUGMENTED_KKT;
+    Int height=0, width=0;
+    vector<Int> QOffsets, QTargets, AOffsets, ATargets;
+
+    // The augmented system used to compute the initial point (and, if
+    // 'system' is AUGMENTED_KKT, during the iterations)
+    bool augmentedAnalyzed=false;
+    SparseLDLFactorization<Real> augmentedFact;
+
+    // The full KKT system used during the iterations
+    bool analyzed=false;
+    SparseLDLFactorization<Real> fact;
+};
+
+template<typename Real>
+struct DistSparseKKTAnalysis
+{
+    // The KKT system and the patterns of 'Q' and 'A' of the analyses; each
+    // process stores the patterns of its local rows
+    KKTSystem system=AUGMENTED_KKT;
+    Int height=0, width=0;
+    vector<Int> QOffsets, QTargets, AOffsets, ATargets;
+
+    bool augmentedAnalyzed=false;
+    DistSparseLDLFactorization<Real> augmentedFact;
+
+    bool analyzed=false;
+    DistSparseLDLFactorization<Real> fact;
+};
+
 } // namespace direct
 
 namespace affine {
@@ -143,6 +181,33 @@ void QP
         DistMultiVec<Real>& z,
   const qp::direct::Ctrl<Real>& ctrl=qp::direct::Ctrl<Real>() );
 
+// Reuse the symbolic analyses of the KKT systems from previous solves with
+// the same sparsity patterns of 'Q' and 'A'. A warm start is requested by
+// setting both 'mehrotraCtrl.primalInit' and 'mehrotraCtrl.dualInit' (see
+// 'mehrotraCtrl.warmStartFloor').
+template<typename Real>
+void QP
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        qp::direct::SparseKKTAnalysis<Real>& analysis,
+  const qp::direct::Ctrl<Real>& ctrl=qp::direct::Ctrl<Real>() );
+template<typename Real>
+void QP
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+        qp::direct::DistSparseKKTAnalysis<Real>& analysis,
+  const qp::direct::Ctrl<Real>& ctrl=qp::direct::Ctrl<Real>() );
+
 // Affine conic form
 // -----------------
 template<typename Real>
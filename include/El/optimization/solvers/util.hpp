@@ -84,6 +84,15 @@ struct MehrotraCtrl
     // Use a simple shift for forcing cone membership during initialization?
     bool standardInitShift=true;
 
+    // If both the primal and dual variables were user-initialized, e.g., with
+    // the solution of a nearby problem, raise each entry of 'x' and 'z' to at
+    // least 'warmStartFloor' times the maximum of one and the largest entry of
+    // its vector. A previous solution is nearly complementary, and so this
+    // moves it away from the boundary of the cone before the first step.
+    // A value of zero disables the clip. This is currently only used by the
+    // sparse direct-form LP and QP IPMs.
+    Real warmStartFloor=0;
+
     // If the maximum ratio between the primary and dual variables exceeds this
     // value, the barrier parameter is kept at its previous value to attempt to
     // increase the centrality.
@@ -101,6 +110,20 @@ struct MehrotraCtrl
     // both the cost and number of iterations.
     bool resolveReg=true;
 
+    // Solve the NORMAL_KKT systems of sparse direct-form LPs with
+    // Jacobi-preconditioned Conjugate Gradients applied to the implicit
+    // operator A D^2 A^T + delta^2 I rather than factoring its explicit form,
+    // so that the memory requirements are those of A rather than of the
+    // fill-in of a Cholesky factor. Each solve is inexact, with a relative
+    // tolerance of 'krylovForcing' times the (at most unit) barrier
+    // parameter, and may take at most 'krylovMaxIts' iterations, after which
+    // the iterate of smallest residual is used as an inexact direction. The
+    // initial point is also computed with CG (with a tolerance of
+    // solveCtrl.relTol).
+    bool krylovKKT=false;
+    Real krylovForcing=Real(0.1);
+    Int krylovMaxIts=2000;
+
     // Wrap the Interior Point Method with an equilibration.
     // This should almost always be set to true.
     bool outerEquil=true;
@@ -20,14 +20,26 @@ class LLLInfo_s(ctypes.Structure):
               ("rank",iType),
               ("nullity",iType),
               ("numSwaps",iType),
-              ("logVol",sType)]
+              ("firstSwap",iType),
+              ("logVol",sType),
+              ("numSweeps",iType),
+              ("qrTime",dType),
+              ("localTime",dType),
+              ("updateTime",dType),
+              ("finalTime",dType)]
 class LLLInfo_d(ctypes.Structure):
   _fields_ = [("delta",dType),
               ("eta",dType),
               ("rank",iType),
               ("nullity",iType),
               ("numSwaps",iType),
-              ("logVol",dType)]
+              ("firstSwap",iType),
+              ("logVol",dType),
+              ("numSweeps",iType),
+              ("qrTime",dType),
+              ("localTime",dType),
+              ("updateTime",dType),
+              ("finalTime",dType)]
 
 (LLL_WEAK,LLL_NORMAL,LLL_DEEP,LLL_DEEP_REDUCE)=(0,1,2,3)
 
@@ -52,7 +64,9 @@ class LLLCtrl_s(ctypes.Structure):
               ("progress",bType),
               ("time",bType),
               ("jumpstart",bType),
-              ("startCol",iType)]
+              ("startCol",iType),
+              ("segmented",bType),
+              ("segmentSize",iType)]
   def __init__(self):
     lib.ElLLLCtrlDefault_s(pointer(self))
 class LLLCtrl_d(ctypes.Structure):
@@ -73,7 +87,9 @@ class LLLCtrl_d(ctypes.Structure):
               ("progress",bType),
               ("time",bType),
               ("jumpstart",bType),
-              ("startCol",iType)]
+              ("startCol",iType),
+              ("segmented",bType),
+              ("segmentSize",iType)]
   def __init__(self):
     lib.ElLLLCtrlDefault_d(pointer(self))
 
@@ -43,7 +43,11 @@ class MehrotraCtrl_s(ctypes.Structure):
               ("diagEquilTol",sType),
               ("checkResiduals",bType),
               ("reg0Tmp",sType),("reg1Tmp",sType),("reg2Tmp",sType),
-              ("reg0Perm",sType),("reg1Perm",sType),("reg2Perm",sType)]
+              ("reg0Perm",sType),("reg1Perm",sType),("reg2Perm",sType),
+              ("krylovKKT",bType),
+              ("krylovForcing",sType),
+              ("krylovMaxIts",iType),
+              ("warmStartFloor",sType)]
   def __init__(self):
     lib.ElMehrotraCtrlDefault_s(pointer(self))
 class MehrotraCtrl_d(ctypes.Structure):
@@ -70,7 +74,11 @@ class MehrotraCtrl_d(ctypes.Structure):
               ("diagEquilTol",dType),
               ("checkResiduals",bType),
               ("reg0Tmp",dType),("reg1Tmp",dType),("reg2Tmp",dType),
-              ("reg0Perm",dType),("reg1Perm",dType),("reg2Perm",dType)]
+              ("reg0Perm",dType),("reg1Perm",dType),("reg2Perm",dType),
+              ("krylovKKT",bType),
+              ("krylovForcing",dType),
+              ("krylovMaxIts",iType),
+              ("warmStartFloor",dType)]
   def __init__(self):
     lib.ElMehrotraCtrlDefault_d(pointer(self))
 
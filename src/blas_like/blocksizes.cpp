@@ -9,12 +9,22 @@
 #include <El-lite.hpp>
 #include <El/blas_like.hpp>
 #include <stack>
+#include <tuple>
 
 namespace {
 using namespace El;
 
 std::stack<Int> blocksizeStack;
 
+// Tuned blocksizes are keyed by (routine, type name, grid height, grid width),
+// where sequential routines use a 0 x 0 grid, and then by the problem size
+// band
+typedef std::tuple<string,string,Int,Int> TuningKey;
+std::map<TuningKey,std::map<Int,Int>> tunedBlocksizes;
+bool useTunedBlocksizes = false;
+
+Int lookAheadDepth = 0;
+
 template<typename T>
 struct LocalSymvBlocksizeHelper { static Int value; };
 template<typename T>
@@ -70,6 +80,169 @@ void EmptyBlocksizeStack()
         ::blocksizeStack.pop();
 }
 
+Int BlocksizeBand( Int n )
+{
+    Int band = 0;
+    while( n > 1 )
+    {
+        n /= 2;
+        ++band;
+    }
+    return band;
+}
+
+Int Blocksize
+( const string& routine,
+  const string& typeName,
+  Int n,
+  Int gridHeight,
+  Int gridWidth )
+{
+    EL_DEBUG_CSE
+    if( !::useTunedBlocksizes )
+        return Blocksize();
+    auto it = ::tunedBlocksizes.find
+      ( TuningKey(routine,typeName,gridHeight,gridWidth) );
+    if( it == ::tunedBlocksizes.end() || it->second.empty() )
+        return Blocksize();
+
+    // Use the entry for the nearest band (preferring the smaller of two
+    // equidistant bands)
+    const auto& bands = it->second;
+    const Int band = BlocksizeBand( n );
+    auto upper = bands.lower_bound( band );
+    if( upper == bands.end() )
+        return std::prev(upper)->second;
+    if( upper->first == band || upper == bands.begin() )
+        return upper->second;
+    auto lower = std::prev(upper);
+    if( band-lower->first <= upper->first-band )
+        return lower->second;
+    else
+        return upper->second;
+}
+
+void SetTunedBlocksize
+( const string& routine,
+  const string& typeName,
+  Int n,
+  Int gridHeight,
+  Int gridWidth,
+  Int blocksize )
+{
+    EL_DEBUG_CSE
+    if( blocksize < 1 )
+        LogicError("Tuned blocksizes must be positive");
+    const TuningKey key(routine,typeName,gridHeight,gridWidth);
+    ::tunedBlocksizes[key][BlocksizeBand(n)] = blocksize;
+}
+
+void EnableTunedBlocksizes() { ::useTunedBlocksizes = true; }
+void DisableTunedBlocksizes() { ::useTunedBlocksizes = false; }
+bool TunedBlocksizesEnabled() { return ::useTunedBlocksizes; }
+
+void ClearBlocksizeTuning() { ::tunedBlocksizes.clear(); }
+
+void LoadBlocksizeTuning( const string& filename )
+{
+    EL_DEBUG_CSE
+    ifstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    string line;
+    Int lineNumber = 0;
+    while( std::getline( file, line ) )
+    {
+        ++lineNumber;
+        std::istringstream lineStream( line );
+        string routine, typeName;
+        Int gridHeight, gridWidth, band, blocksize;
+        if( !(lineStream >> routine) || routine[0] == '#' )
+            continue;
+        if( !(lineStream >> typeName >> gridHeight >> gridWidth
+                         >> band >> blocksize) || blocksize < 1 )
+            RuntimeError("Invalid entry on line ",lineNumber," of ",filename);
+        const TuningKey key(routine,typeName,gridHeight,gridWidth);
+        ::tunedBlocksizes[key][band] = blocksize;
+    }
+    ::useTunedBlocksizes = true;
+}
+
+void SaveBlocksizeTuning( const string& filename )
+{
+    EL_DEBUG_CSE
+    ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file << "# routine typeName gridHeight gridWidth band blocksize\n";
+    for( const auto& entry : ::tunedBlocksizes )
+    {
+        const auto& key = entry.first;
+        for( const auto& bandEntry : entry.second )
+            file << std::get<0>(key) << " " << std::get<1>(key) << " "
+                 << std::get<2>(key) << " " << std::get<3>(key) << " "
+                 << bandEntry.first << " " << bandEntry.second << "\n";
+    }
+}
+
+Int TuneBlocksize
+( const string& routine,
+  const string& typeName,
+  Int n,
+  Int gridHeight,
+  Int gridWidth,
+  const vector<Int>& candidates,
+  function<void()> run,
+  mpi::Comm comm,
+  Int numReps )
+{
+    EL_DEBUG_CSE
+    if( candidates.empty() )
+        LogicError("No candidate blocksizes were provided");
+
+    // The candidates are applied through the blocksize stack, so any tuned
+    // values must be temporarily ignored
+    const bool usedTuned = ::useTunedBlocksizes;
+    ::useTunedBlocksizes = false;
+
+    Timer timer;
+    Int bestBlocksize = candidates[0];
+    double bestTime = std::numeric_limits<double>::max();
+    for( const Int candidate : candidates )
+    {
+        PushBlocksizeStack( candidate );
+        double time = std::numeric_limits<double>::max();
+        for( Int rep=0; rep<numReps; ++rep )
+        {
+            mpi::Barrier( comm );
+            timer.Start();
+            run();
+            time = Min( time, timer.Stop() );
+        }
+        PopBlocksizeStack();
+        time = mpi::AllReduce( time, mpi::MAX, comm );
+        if( time < bestTime )
+        {
+            bestTime = time;
+            bestBlocksize = candidate;
+        }
+    }
+
+    ::useTunedBlocksizes = usedTuned;
+    SetTunedBlocksize
+    ( routine, typeName, n, gridHeight, gridWidth, bestBlocksize );
+    return bestBlocksize;
+}
+
+Int LookAheadDepth() { return ::lookAheadDepth; }
+
+void SetLookAheadDepth( Int depth )
+{
+    if( depth < 0 )
+        LogicError("The look-ahead depth must be non-negative");
+    ::lookAheadDepth = depth;
+}
+
 template<typename T>
 void SetLocalSymvBlocksize( Int blocksize )
 { LocalSymvBlocksizeHelper<T>::value = blocksize; }
@@ -6,6 +6,9 @@
    which can be found in the LICENSE file in the root directory, or at
    http://opensource.org/licenses/BSD-2-Clause
 */
+#include <deque>
+#include <tuple>
+
 #include <El-lite.hpp>
 #include <El/blas_like/level1.hpp>
 
@@ -23,6 +26,7 @@ void Copy( const Graph& A, Graph& B )
     B.targets_ = A.targets_;
     B.consistent_ = A.consistent_;
     B.sourceOffsets_ = A.sourceOffsets_;
+    B.transposeMeta_ = A.transposeMeta_;
     B.ProcessQueues();
 }
 
@@ -56,6 +60,7 @@ void Copy( const DistGraph& A, Graph& B )
     B.targets_ = A.targets_;
     B.consistent_ = A.locallyConsistent_;
     B.sourceOffsets_ = A.localSourceOffsets_;
+    B.transposeMeta_.ready = false;
     B.ProcessQueues();
 }
 
@@ -127,4 +132,118 @@ void CopyFromNonRoot( const DistGraph& distGraph, int root )
       (Int*)0, edgeSizes.data(), edgeOffsets.data(), root, grid.Comm() );
 }
 
+namespace {
+
+bool redistPlansEnabled = false;
+bool derivedDatatypesEnabled = false;
+Int maxRedistPlans = 64;
+
+typedef std::tuple<int,int,Int,Int,int,int,Int,Int,int,const Grid*>
+  DistDataKey;
+typedef std::tuple<DistDataKey,DistDataKey,Int,Int> RedistPlanKey;
+
+DistDataKey MakeKey( const DistData& data )
+{
+    return std::make_tuple
+      ( int(data.colDist), int(data.rowDist),
+        data.blockHeight, data.blockWidth,
+        data.colAlign, data.rowAlign,
+        data.colCut, data.rowCut,
+        data.root, data.grid );
+}
+
+RedistPlanKey MakeKey
+( const DistData& A, const DistData& B, Int height, Int width )
+{ return std::make_tuple( MakeKey(A), MakeKey(B), height, width ); }
+
+// The plans are evicted in the order in which they were created so that
+// every process makes the same decisions
+std::map<RedistPlanKey,copy::RedistPlan> redistPlans;
+std::deque<RedistPlanKey> redistPlanOrder;
+
+void EvictRedistPlan()
+{
+    redistPlans.erase( redistPlanOrder.front() );
+    redistPlanOrder.pop_front();
+}
+
+} // anonymous namespace
+
+void EnableRedistPlans( Int maxPlans )
+{
+    EL_DEBUG_CSE
+    if( maxPlans < 1 )
+        LogicError("The maximum number of plans must be positive");
+    redistPlansEnabled = true;
+    maxRedistPlans = maxPlans;
+    while( Int(redistPlanOrder.size()) > maxRedistPlans )
+        EvictRedistPlan();
+}
+
+void DisableRedistPlans()
+{
+    redistPlansEnabled = false;
+    ClearRedistPlans();
+}
+
+bool RedistPlansEnabled()
+{ return redistPlansEnabled; }
+
+void ClearRedistPlans()
+{
+    redistPlans.clear();
+    redistPlanOrder.clear();
+}
+
+void ClearRedistPlans( const Grid& grid )
+{
+    auto involvesGrid = [&]( const RedistPlanKey& key )
+      { return std::get<9>(std::get<0>(key)) == &grid ||
+               std::get<9>(std::get<1>(key)) == &grid; };
+    for( auto it=redistPlanOrder.begin(); it!=redistPlanOrder.end(); )
+    {
+        if( involvesGrid(*it) )
+        {
+            redistPlans.erase( *it );
+            it = redistPlanOrder.erase( it );
+        }
+        else
+            ++it;
+    }
+}
+
+void EnableDerivedDatatypes()
+{ derivedDatatypesEnabled = true; }
+
+void DisableDerivedDatatypes()
+{ derivedDatatypesEnabled = false; }
+
+bool DerivedDatatypesEnabled()
+{ return derivedDatatypesEnabled; }
+
+namespace copy {
+
+const RedistPlan* FindRedistPlan
+( const DistData& A, const DistData& B, Int height, Int width )
+{
+    auto it = redistPlans.find( MakeKey(A,B,height,width) );
+    return ( it == redistPlans.end() ? nullptr : &it->second );
+}
+
+const RedistPlan& StoreRedistPlan
+( const DistData& A, const DistData& B, Int height, Int width,
+  RedistPlan&& plan )
+{
+    EL_DEBUG_CSE
+    const auto key = MakeKey( A, B, height, width );
+    if( redistPlans.find(key) != redistPlans.end() )
+        LogicError("Redistribution plan already existed");
+    if( Int(redistPlanOrder.size()) >= maxRedistPlans )
+        EvictRedistPlan();
+    redistPlanOrder.push_back( key );
+    return redistPlans[key] = std::move(plan);
+}
+
+} // namespace copy
+
 } // namespace El
@@ -24,6 +24,7 @@ void Gemm
   T beta,        Matrix<T>& C )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm")
     if( orientA == NORMAL && orientB == NORMAL )
     {
         if( A.Height() != C.Height() ||
@@ -59,6 +60,8 @@ void Gemm
     const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
     if( k != 0 )
     {
+        ProfileFlopCount profileFlops
+        ( (IsComplex<T>::value ? 8. : 2.)*m*n*k );
         blas::Gemm
         ( transA, transB, m, n, k,
           alpha, A.LockedBuffer(), A.LDim(),
@@ -95,6 +98,16 @@ void Gemm
   GemmAlgorithm alg )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm")
+    // Each process is credited with an equal share of the flops, independent
+    // of the redundant work of the chosen algorithm
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
+    const double flops =
+      ( C.Participating() ?
+        (IsComplex<T>::value ? 8. : 2.)*m*n*k / C.Grid().Size() : 0. );
+    ProfileFlopCount profileFlops( flops );
     C *= beta;
     if( orientA == NORMAL && orientB == NORMAL )
     {
@@ -14,103 +14,165 @@
 namespace El {
 
 namespace {
-/**
- * MultiplyCSR specialization where the CSR matrix happens to have all nonzeros = 1.
- */
+
+// Compressed sparse row (CSR) kernels
+// ===================================
+// Entry (i,k) of X is stored at X[i*xRowStride+k*xColStride] (and likewise
+// for Y) so that the same kernels apply to column-major matrices and to the
+// interleaved buffers used by the distributed multiplication.
+
+// The values of a graph's (implicit) unit-weight edges
 template<typename T>
-void MultiplyCSR
-( Orientation orientation,
-  Int m, Int n,
+struct PatternValues
+{
+    T operator()( Int ) const { return T(1); }
+};
+
+template<typename T,bool conjugate>
+struct ExplicitValues
+{
+    const T* values;
+    T operator()( Int e ) const
+    { return conjugate ? Conj(values[e]) : values[e]; }
+};
+
+// The values of a compressed-column mirror, which are gathered from the
+// original (row-major) ordering
+template<typename T,bool conjugate>
+struct MirroredValues
+{
+    const T* values;
+    const Int* edges;
+    T operator()( Int e ) const
+    { return conjugate ? Conj(values[edges[e]]) : values[edges[e]]; }
+};
+
+inline Int NumRowChunks( Int m )
+{
+#ifdef EL_HYBRID
+    return Max( Min( Int(omp_get_max_threads()), m ), Int(1) );
+#else
+    return 1;
+#endif
+}
+
+// The first row of the given chunk of a partition of the rows into contiguous
+// chunks with (roughly) equal numbers of nonzeros
+inline Int ChunkStart( Int chunk, Int numChunks, Int m, const Int* rowOffsets )
+{
+    if( chunk == 0 )
+        return 0;
+    if( chunk >= numChunks )
+        return m;
+    const Int numEntries = rowOffsets[m] - rowOffsets[0];
+    const Int target =
+      rowOffsets[0] + Int((double(numEntries)*chunk)/numChunks);
+    return std::lower_bound( rowOffsets, rowOffsets+m, target ) - rowOffsets;
+}
+
+// Y := alpha A X + beta Y, with the rows of A partitioned between the threads
+// and with four right-hand sides processed at a time so that each column
+// index and value of A is loaded once per block
+template<typename T,typename Values>
+void MultiplyRows
+( Int m, Int numRHS,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
-  const T*   x,
+  const Values& value,
+  const T* X, Int xRowStride, Int xColStride,
   T beta,
-        T*   y )
+        T* Y, Int yRowStride, Int yColStride )
 {
     EL_DEBUG_CSE
-    if( orientation == NORMAL )
+    const Int numChunks = NumRowChunks( m );
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
     {
-        for( Int i=0; i<m; ++i )
+        const Int iBeg = ChunkStart( chunk, numChunks, m, rowOffsets );
+        const Int iEnd = ChunkStart( chunk+1, numChunks, m, rowOffsets );
+        for( Int i=iBeg; i<iEnd; ++i )
         {
-            T sum = 0;
             const Int eStart = rowOffsets[i];
             const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += x[colIndices[e]];
-            y[i] = alpha*sum + beta*y[i];
-        }
-    }
-    else
-    {
-        for( Int j=0; j<n; ++j ){
-            y[j] *= beta;
-            for( Int i=0; i<m; ++i )
+            Int k=0;
+            for( ; k+4<=numRHS; k+=4 )
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
+                T sum0=0, sum1=0, sum2=0, sum3=0;
                 for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*x[i];
+                {
+                    const T valueA = value(e);
+                    const T* x = &X[colIndices[e]*xRowStride+k*xColStride];
+                    sum0 += valueA*x[0];
+                    sum1 += valueA*x[xColStride];
+                    sum2 += valueA*x[2*xColStride];
+                    sum3 += valueA*x[3*xColStride];
+                }
+                T* y = &Y[i*yRowStride+k*yColStride];
+                y[0] = alpha*sum0 + beta*y[0];
+                y[yColStride] = alpha*sum1 + beta*y[yColStride];
+                y[2*yColStride] = alpha*sum2 + beta*y[2*yColStride];
+                y[3*yColStride] = alpha*sum3 + beta*y[3*yColStride];
+            }
+            for( ; k<numRHS; ++k )
+            {
+                T sum = 0;
+                for( Int e=eStart; e<eStop; ++e )
+                    sum += value(e)*X[colIndices[e]*xRowStride+k*xColStride];
+                T& y = Y[i*yRowStride+k*yColStride];
+                y = alpha*sum + beta*y;
             }
-	}
+        }
     }
 }
 
-template<typename T,typename=DisableIf<IsBlasScalar<T>>>
-void MultiplyCSR
-( Orientation orientation,
-  Int m, Int n,
+// Y := alpha A^T X + beta Y (or with A^H, depending upon 'value') by
+// scattering each row of A into Y
+template<typename T,typename Values>
+void ScatterRows
+( Int m, Int n, Int numRHS,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
-  const T*   values,
-  const T*   x,
+  const Values& value,
+  const T* X, Int xRowStride, Int xColStride,
   T beta,
-        T*   y )
+        T* Y, Int yRowStride, Int yColStride )
 {
     EL_DEBUG_CSE
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            T sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];
-            y[i] = alpha*sum + beta*y[i];
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
+    for( Int k=0; k<numRHS; ++k )
         for( Int j=0; j<n; ++j )
-            y[j] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*Conj(values[e])*x[i];
-            }
-        }
-        else
+            Y[j*yRowStride+k*yColStride] *= beta;
+    for( Int i=0; i<m; ++i )
+    {
+        const Int eStart = rowOffsets[i];
+        const Int eStop = rowOffsets[i+1];
+        for( Int e=eStart; e<eStop; ++e )
         {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*values[e]*x[i];
-            }
+            const T prod = alpha*value(e);
+            T* y = &Y[colIndices[e]*yRowStride];
+            const T* x = &X[i*xRowStride];
+            for( Int k=0; k<numRHS; ++k )
+                y[k*yColStride] += prod*x[k*xColStride];
         }
     }
 }
 
+template<typename T,typename=DisableIf<IsBlasScalar<T>>>
+bool VendorMultiplyCSR
+( Orientation orientation,
+  Int m, Int n,
+  T alpha,
+  const Int* rowOffsets,
+  const Int* colIndices,
+  const T*   values,
+  const T*   x,
+  T beta,
+        T*   y )
+{ return false; }
+
 template<typename T,typename=EnableIf<IsBlasScalar<T>>,typename=void>
-void MultiplyCSR
+bool VendorMultiplyCSR
 ( Orientation orientation,
   Int m, Int n,
   T alpha,
@@ -129,48 +191,16 @@ void MultiplyCSR
     mkl::csrmv
     ( orientation, m, n, alpha, matDescrA,
       values, colIndices, rowOffsets, rowOffsets+1, x, beta, y );
+    return true;
 #else
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            T sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];
-            y[i] = alpha*sum + beta*y[i];
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            y[j] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*Conj(values[e])*x[i];
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*values[e]*x[i];
-            }
-        }
-    }
+    return false;
 #endif
 }
 
+// Y := alpha op(A) X + beta Y, where A is an m x n CSR matrix (with unit
+// values if 'values' is null). If a compressed-column mirror of A is
+// provided, transposed products gather over the columns of A so that they
+// may be threaded without conflicts.
 template<typename T>
 void MultiplyCSR
 ( Orientation orientation,
@@ -179,343 +209,400 @@ void MultiplyCSR
   const Int* rowOffsets,
   const Int* colIndices,
   const T*   values,
-  const T*   X, Int ldX,
+  const GraphTransposeMeta* transposeMeta,
+  const T*   X, Int xRowStride, Int xColStride,
   T beta,
-        T*   Y, Int ldY )
+        T*   Y, Int yRowStride, Int yColStride )
 {
     EL_DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha,
-          rowOffsets, colIndices, values, X, beta, Y );
+    if( numRHS == 1 && values != nullptr && xRowStride == 1 &&
+        yRowStride == 1 &&
+        VendorMultiplyCSR
+        ( orientation, m, n, alpha, rowOffsets, colIndices, values,
+          X, beta, Y ) )
         return;
-    }
 
+    const bool conjugate = ( orientation == ADJOINT );
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
+        if( values == nullptr )
+            MultiplyRows
+            ( m, numRHS, alpha, rowOffsets, colIndices, PatternValues<T>(),
+              X, xRowStride, xColStride, beta, Y, yRowStride, yColStride );
+        else
+            MultiplyRows
+            ( m, numRHS, alpha, rowOffsets, colIndices,
+              ExplicitValues<T,false>{values},
+              X, xRowStride, xColStride, beta, Y, yRowStride, yColStride );
+    }
+    else if( transposeMeta != nullptr )
+    {
+        const Int* colOffsets = transposeMeta->targetOffsets.data();
+        const Int* rowIndices = transposeMeta->sources.data();
+        const Int* edges = transposeMeta->edges.data();
+        if( values == nullptr )
+            MultiplyRows
+            ( n, numRHS, alpha, colOffsets, rowIndices, PatternValues<T>(),
+              X, xRowStride, xColStride, beta, Y, yRowStride, yColStride );
+        else if( conjugate )
+            MultiplyRows
+            ( n, numRHS, alpha, colOffsets, rowIndices,
+              MirroredValues<T,true>{values,edges},
+              X, xRowStride, xColStride, beta, Y, yRowStride, yColStride );
+        else
+            MultiplyRows
+            ( n, numRHS, alpha, colOffsets, rowIndices,
+              MirroredValues<T,false>{values,edges},
+              X, xRowStride, xColStride, beta, Y, yRowStride, yColStride );
     }
     else
     {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j+k*ldY] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i+k*ldX];
-                }
-            }
-        }
+        if( values == nullptr )
+            ScatterRows
+            ( m, n, numRHS, alpha, rowOffsets, colIndices, PatternValues<T>(),
+              X, xRowStride, xColStride, beta, Y, yRowStride, yColStride );
+        else if( conjugate )
+            ScatterRows
+            ( m, n, numRHS, alpha, rowOffsets, colIndices,
+              ExplicitValues<T,true>{values},
+              X, xRowStride, xColStride, beta, Y, yRowStride, yColStride );
         else
+            ScatterRows
+            ( m, n, numRHS, alpha, rowOffsets, colIndices,
+              ExplicitValues<T,false>{values},
+              X, xRowStride, xColStride, beta, Y, yRowStride, yColStride );
+    }
+}
+
+// Secondary formats
+// =================
+
+// Return the largest block size (of at most four) for which storing the
+// matrix as dense blocks requires at most 25% more entries than CSR, or one
+// if there is no such block size
+template<typename T>
+Int DetectBlockSize( const SparseMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numEntries = A.NumEntries();
+    const Int* rowOffsets = A.LockedOffsetBuffer();
+    const Int* colIndices = A.LockedTargetBuffer();
+    for( Int blockSize=4; blockSize>1; --blockSize )
+    {
+        if( m % blockSize != 0 || n % blockSize != 0 )
+            continue;
+        const Int numBlockRows = m / blockSize;
+        const Int maxStored = numEntries + numEntries/4;
+        vector<Int> lastSeen( n/blockSize, -1 );
+        Int numStored = 0;
+        for( Int blockRow=0; blockRow<numBlockRows; ++blockRow )
         {
-            for( Int i=0; i<m; ++i )
+            const Int eStart = rowOffsets[blockRow*blockSize];
+            const Int eStop = rowOffsets[(blockRow+1)*blockSize];
+            for( Int e=eStart; e<eStop; ++e )
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
+                const Int blockCol = colIndices[e] / blockSize;
+                if( lastSeen[blockCol] != blockRow )
                 {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i+k*ldX];
+                    lastSeen[blockCol] = blockRow;
+                    numStored += blockSize*blockSize;
                 }
             }
+            if( numStored > maxStored )
+                break;
         }
+        if( numStored <= maxStored )
+            return blockSize;
     }
+    return 1;
 }
 
 template<typename T>
-void MultiplyCSR
-( Orientation orientation,
-  Int m, Int n, Int numRHS,
-  T alpha,
-  const Int* rowOffsets,
-  const Int* colIndices,
-  const T*   X, Int ldX,
-  T beta,
-        T*   Y, Int ldY )
+void BuildBCSR( const SparseMatrix<T>& A, Int blockSize )
 {
     EL_DEBUG_CSE
-    if( numRHS == 1 )
+    auto& meta = A.multMeta;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int* rowOffsets = A.LockedOffsetBuffer();
+    const Int* colIndices = A.LockedTargetBuffer();
+    const T* values = A.LockedValueBuffer();
+    const Int blockArea = blockSize*blockSize;
+    const Int numBlockRows = m / blockSize;
+
+    // Since the columns of each row are sorted, the blocks of each block row
+    // can be discovered by merging the rows
+    vector<Int> blockIndex( n/blockSize, -1 );
+    meta.blockSize = blockSize;
+    meta.blockOffsets.resize( numBlockRows+1 );
+    meta.blockCols.resize( 0 );
+    meta.blockVals.resize( 0 );
+    meta.blockOffsets[0] = 0;
+    for( Int blockRow=0; blockRow<numBlockRows; ++blockRow )
     {
-        MultiplyCSR
-        ( orientation, m, n, alpha,
-          rowOffsets, colIndices, X, beta, Y );
-        return;
-    }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
+        const Int blockStart = meta.blockCols.size();
+        const Int eStart = rowOffsets[blockRow*blockSize];
+        const Int eStop = rowOffsets[(blockRow+1)*blockSize];
+        for( Int e=eStart; e<eStop; ++e )
         {
-            for( Int k=0; k<numRHS; ++k )
+            const Int blockCol = colIndices[e] / blockSize;
+            if( blockIndex[blockCol] < blockStart )
             {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
+                blockIndex[blockCol] = meta.blockCols.size();
+                meta.blockCols.push_back( blockCol );
             }
         }
-    }
-    else
-    {
-        for( Int k=0; k<numRHS; ++k )
-	{
-            for( Int j=0; j<n; ++j )
-	    {
-                Y[j+k*ldY] *= beta;
-            	for( Int i=0; i<m; ++i )
-            	{
-            	    const Int eStart = rowOffsets[i];
-            	    const Int eStop = rowOffsets[i+1];
-            	    for( Int e=eStart; e<eStop; ++e )
-            	        for( Int k=0; k<numRHS; ++k )
-            	            Y[colIndices[e]+k*ldY] += alpha*X[i+k*ldX];
-            	}
+        std::sort( meta.blockCols.begin()+blockStart, meta.blockCols.end() );
+        const Int blockStop = meta.blockCols.size();
+        for( Int b=blockStart; b<blockStop; ++b )
+            blockIndex[meta.blockCols[b]] = b;
+        meta.blockOffsets[blockRow+1] = blockStop;
+
+        meta.blockVals.resize( blockStop*blockArea, T(0) );
+        meta.blockMasks.resize( blockStop, 0u );
+        for( Int r=0; r<blockSize; ++r )
+        {
+            const Int i = blockRow*blockSize + r;
+            for( Int e=rowOffsets[i]; e<rowOffsets[i+1]; ++e )
+            {
+                const Int j = colIndices[e];
+                const Int b = blockIndex[j/blockSize];
+                const Int entry = r*blockSize + j%blockSize;
+                meta.blockVals[b*blockArea+entry] = values[e];
+                meta.blockMasks[b] |= 1u << entry;
             }
         }
     }
 }
 
+// Return the number of entries (including padding) of the SELL-C-sigma
+// format of the matrix
 template<typename T>
-void MultiplyCSRInterX
-( Orientation orientation,
-  Int m, Int n, Int numRHS,
-  T alpha,
-  const Int* rowOffsets,
-  const Int* colIndices,
-  const T*   values,
-  const T*   X,
-  T beta,
-        T*   Y, Int ldY )
+Int BuildSELL( const SparseMatrix<T>& A )
 {
     EL_DEBUG_CSE
-    if( numRHS == 1 )
+    auto& meta = A.multMeta;
+    const Int C = SparseMultMeta<T>::sellChunkHeight;
+    const Int sigma = SparseMultMeta<T>::sellSortWindow;
+    const Int m = A.Height();
+    const Int* rowOffsets = A.LockedOffsetBuffer();
+    const Int* colIndices = A.LockedTargetBuffer();
+    const T* values = A.LockedValueBuffer();
+    auto rowLength = [&]( Int i ) { return rowOffsets[i+1] - rowOffsets[i]; };
+
+    // Sort the rows by decreasing length within each window of sigma rows
+    meta.sellRows.resize( m );
+    for( Int i=0; i<m; ++i )
+        meta.sellRows[i] = i;
+    for( Int windowStart=0; windowStart<m; windowStart+=sigma )
     {
-        MultiplyCSR
-        ( orientation, m, n, alpha,
-          rowOffsets, colIndices, values, X, beta, Y );
-        return;
+        const Int windowStop = Min( windowStart+sigma, m );
+        std::stable_sort
+        ( meta.sellRows.begin()+windowStart, meta.sellRows.begin()+windowStop,
+          [&]( Int i, Int j ) { return rowLength(i) > rowLength(j); } );
     }
 
-    if( orientation == NORMAL )
+    const Int numChunks = (m+C-1) / C;
+    meta.sellChunkOffsets.resize( numChunks+1 );
+    meta.sellRowLengths.assign( numChunks*C, 0 );
+    meta.sellChunkOffsets[0] = 0;
+    for( Int chunk=0; chunk<numChunks; ++chunk )
     {
-        for( Int i=0; i<m; ++i )
+        Int chunkWidth = 0;
+        const Int numRows = Min( C, m-chunk*C );
+        for( Int r=0; r<numRows; ++r )
         {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
+            const Int length = rowLength( meta.sellRows[chunk*C+r] );
+            meta.sellRowLengths[chunk*C+r] = length;
+            chunkWidth = Max( chunkWidth, length );
         }
+        meta.sellChunkOffsets[chunk+1] =
+          meta.sellChunkOffsets[chunk] + chunkWidth*C;
     }
-    else
+
+    // The padding refers to the first column with a value of zero
+    const Int numPadded = meta.sellChunkOffsets[numChunks];
+    meta.sellCols.assign( numPadded, 0 );
+    meta.sellVals.assign( numPadded, T(0) );
+    for( Int chunk=0; chunk<numChunks; ++chunk )
     {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j+k*ldY] *= beta;
-        if( conj )
+        const Int off = meta.sellChunkOffsets[chunk];
+        const Int numRows = Min( C, m-chunk*C );
+        for( Int r=0; r<numRows; ++r )
         {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
+            const Int i = meta.sellRows[chunk*C+r];
+            const Int eStart = rowOffsets[i];
+            const Int length = rowLength( i );
+            for( Int t=0; t<length; ++t )
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];
-                }
+                meta.sellCols[off+t*C+r] = colIndices[eStart+t];
+                meta.sellVals[off+t*C+r] = values[eStart+t];
             }
         }
     }
+    return numPadded;
 }
 
+// Choose (and build) the format for multiplication with A: dense blocks if
+// they introduce little fill, SELL-C-sigma if its padding is modest, and
+// otherwise CSR
 template<typename T>
-void MultiplyCSRInterY
-( Orientation orientation,
-  Int m, Int n, Int numRHS,
-  T alpha,
-  const Int* rowOffsets,
-  const Int* colIndices,
-  const T*   values,
-  const T*   X, Int ldX,
-  T beta,
-        T*   Y )
+void BuildMultMeta( const SparseMatrix<T>& A )
 {
     EL_DEBUG_CSE
-    if( numRHS == 1 )
+    auto& meta = A.multMeta;
+    meta.Clear();
+    const Int numEntries = A.NumEntries();
+    const Int blockSize = DetectBlockSize( A );
+    if( blockSize > 1 )
     {
-        MultiplyCSR
-        ( orientation, m, n, alpha,
-          rowOffsets, colIndices, values, X, beta, Y );
-        return;
+        BuildBCSR( A, blockSize );
+        meta.format = SPARSE_MULT_BCSR;
     }
-
-    if( orientation == NORMAL )
+    else if( A.Height() >= 2*SparseMultMeta<T>::sellChunkHeight &&
+             BuildSELL( A ) <= numEntries + numEntries/4 )
     {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
-            }
-        }
+        meta.format = SPARSE_MULT_SELL;
     }
     else
     {
-        const bool conj = ( orientation == ADJOINT );
+        meta.Clear();
+    }
+    meta.ready = true;
+}
+
+template<typename T>
+void MultiplySELL
+( T alpha, const SparseMatrix<T>& A, const Matrix<T>& X,
+  T beta,                                  Matrix<T>& Y )
+{
+    EL_DEBUG_CSE
+    const auto& meta = A.multMeta;
+    const Int C = SparseMultMeta<T>::sellChunkHeight;
+    const Int m = A.Height();
+    const Int numRHS = X.Width();
+    const Int numChunks = (m+C-1) / C;
+    const Int* rows = meta.sellRows.data();
+    const Int* rowLengths = meta.sellRowLengths.data();
+    const Int* chunkOffsets = meta.sellChunkOffsets.data();
+    const Int* cols = meta.sellCols.data();
+    const T* vals = meta.sellVals.data();
+    const T* XBuf = X.LockedBuffer();
+    const Int XLDim = X.LDim();
+    T* YBuf = Y.Buffer();
+    const Int YLDim = Y.LDim();
+
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const Int off = chunkOffsets[chunk];
+        const Int chunkWidth = (chunkOffsets[chunk+1]-off) / C;
+        const Int* lengths = &rowLengths[chunk*C];
+        const Int numRows = Min( C, m-chunk*C );
+        T sums[SparseMultMeta<T>::sellChunkHeight];
         for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j*numRHS+k] *= beta;
-        if( conj )
         {
-            for( Int i=0; i<m; ++i )
+            const T* x = &XBuf[k*XLDim];
+            for( Int r=0; r<C; ++r )
+                sums[r] = 0;
+            // The padding is masked rather than multiplied by zero so that
+            // non-finite entries of X do not propagate into other rows
+            for( Int t=0; t<chunkWidth; ++t )
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];
-                }
+                const Int* colsT = &cols[off+t*C];
+                const T* valsT = &vals[off+t*C];
+                EL_SIMD
+                for( Int r=0; r<C; ++r )
+                    sums[r] += ( t < lengths[r] ? valsT[r]*x[colsT[r]] : T(0) );
             }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
+            for( Int r=0; r<numRows; ++r )
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];
-                }
+                T& y = YBuf[rows[chunk*C+r]+k*YLDim];
+                y = alpha*sums[r] + beta*y;
             }
         }
     }
 }
 
-template<typename T>
-void MultiplyCSRInter
-( Orientation orientation,
-  Int m, Int n, Int numRHS,
-  T alpha,
-  const Int* rowOffsets,
-  const Int* colIndices,
-  const T*   values,
-  const T*   X,
-  T beta,
-        T*   Y )
+template<typename T,Int blockSize>
+void MultiplyBCSR
+( T alpha, const SparseMatrix<T>& A, const Matrix<T>& X,
+  T beta,                                  Matrix<T>& Y )
 {
     EL_DEBUG_CSE
-    if( numRHS == 1 )
+    const auto& meta = A.multMeta;
+    const Int blockArea = blockSize*blockSize;
+    const Int numBlockRows = A.Height() / blockSize;
+    const Int numRHS = X.Width();
+    const Int* blockOffsets = meta.blockOffsets.data();
+    const Int* blockCols = meta.blockCols.data();
+    const unsigned* blockMasks = meta.blockMasks.data();
+    const T* blockVals = meta.blockVals.data();
+    const T* XBuf = X.LockedBuffer();
+    const Int XLDim = X.LDim();
+    T* YBuf = Y.Buffer();
+    const Int YLDim = Y.LDim();
+
+    EL_PARALLEL_FOR
+    for( Int blockRow=0; blockRow<numBlockRows; ++blockRow )
     {
-        MultiplyCSR
-        ( orientation, m, n, alpha,
-          rowOffsets, colIndices, values, X, beta, Y );
-        return;
-    }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
+        T sums[blockSize];
+        for( Int k=0; k<numRHS; ++k )
         {
-            for( Int k=0; k<numRHS; ++k )
+            for( Int r=0; r<blockSize; ++r )
+                sums[r] = 0;
+            // As for SELL, the padded zeros of each block are masked so
+            // that non-finite entries of X do not propagate into other rows
+            for( Int b=blockOffsets[blockRow]; b<blockOffsets[blockRow+1]; ++b )
             {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
+                const T* block = &blockVals[b*blockArea];
+                const unsigned mask = blockMasks[b];
+                const T* x = &XBuf[blockCols[b]*blockSize+k*XLDim];
+                for( Int r=0; r<blockSize; ++r )
+                    for( Int c=0; c<blockSize; ++c )
+                        sums[r] +=
+                          ( (mask >> (r*blockSize+c)) & 1u ?
+                            block[r*blockSize+c]*x[c] : T(0) );
             }
+            T* y = &YBuf[blockRow*blockSize+k*YLDim];
+            for( Int r=0; r<blockSize; ++r )
+                y[r] = alpha*sums[r] + beta*y[r];
         }
     }
-    else
+}
+
+// Attempt to multiply using a secondary format, which is built upon the
+// second multiplication with an unmodified matrix
+template<typename T>
+bool MultiplySecondaryFormat
+( T alpha, const SparseMatrix<T>& A, const Matrix<T>& X,
+  T beta,                                  Matrix<T>& Y )
+{
+    EL_DEBUG_CSE
+    auto& meta = A.multMeta;
+    if( !meta.ready && ++meta.numMultiplies >= 2 )
+        BuildMultMeta( A );
+    if( !meta.ready )
+        return false;
+
+    if( meta.format == SPARSE_MULT_SELL )
     {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            for( Int k=0; k<numRHS; ++k )
-                Y[j*numRHS+k] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i*numRHS+k];
-                }
-            }
-        }
-        else
+        MultiplySELL( alpha, A, X, beta, Y );
+        return true;
+    }
+    else if( meta.format == SPARSE_MULT_BCSR )
+    {
+        switch( meta.blockSize )
         {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i*numRHS+k];
-                }
-            }
+        case 2: MultiplyBCSR<T,2>( alpha, A, X, beta, Y ); return true;
+        case 3: MultiplyBCSR<T,3>( alpha, A, X, beta, Y ); return true;
+        case 4: MultiplyBCSR<T,4>( alpha, A, X, beta, Y ); return true;
+        default: return false;
         }
     }
+    return false;
 }
 
 } // anonymous namespace
@@ -531,13 +618,21 @@ void Multiply
       if( X.Width() != Y.Width() )
           LogicError("X and Y must have the same width");
     )
+    if( orientation == NORMAL &&
+        MultiplySecondaryFormat( alpha, A, X, beta, Y ) )
+        return;
+
+    const GraphTransposeMeta* transposeMeta =
+      ( orientation != NORMAL && NumRowChunks(A.Width()) > 1 ?
+        &A.LockedGraph().InitializeTransposeMeta() : nullptr );
     MultiplyCSR
     ( orientation, A.Height(), A.Width(), X.Width(),
       alpha, A.LockedOffsetBuffer(),
              A.LockedTargetBuffer(),
              A.LockedValueBuffer(),
-             X.LockedBuffer(), X.LDim(),
-      beta,  Y.Buffer(),       Y.LDim() );
+             transposeMeta,
+             X.LockedBuffer(), 1, X.LDim(),
+      beta,  Y.Buffer(),       1, Y.LDim() );
 }
 
 template<typename T>
@@ -551,12 +646,17 @@ void Multiply
       if( X.Width() != Y.Width() )
           LogicError("X and Y must have the same width");
     )
+    const GraphTransposeMeta* transposeMeta =
+      ( orientation != NORMAL && NumRowChunks(A.NumTargets()) > 1 ?
+        &A.InitializeTransposeMeta() : nullptr );
     MultiplyCSR
     ( orientation, A.NumSources(), A.NumTargets(), X.Width(),
       alpha, A.LockedOffsetBuffer(),
              A.LockedTargetBuffer(),
-             X.LockedBuffer(), X.LDim(),
-      beta,  Y.Buffer(), Y.LDim());
+             static_cast<const T*>(nullptr),
+             transposeMeta,
+             X.LockedBuffer(), 1, X.LDim(),
+      beta,  Y.Buffer(),       1, Y.LDim() );
 }
 
 
@@ -592,8 +692,7 @@ void Multiply
     // Y := beta Y
     Y *= beta;
 
-    A.InitializeMultMeta();
-    const auto& meta = A.LockedDistGraph().multMeta;
+    const auto& meta = A.InitializeMultMeta();
     // Convert the sizes and offsets to be compatible with the current width
     const Int b = X.Width();
     vector<int> recvSizes=meta.recvSizes,
@@ -639,15 +738,16 @@ void Multiply
         // Perform the local multiply-accumulate, y := alpha A x + y
         if( time && commRank == 0 )
             timer.Start();
-        MultiplyCSRInterX
+        MultiplyCSR
         ( NORMAL, A.LocalHeight(), meta.numRecvInds, b,
           alpha, A.LockedOffsetBuffer(),
                  meta.colOffs.data(),
                  A.LockedValueBuffer(),
-                 recvVals.data(),
-          T(1),  Y.Matrix().Buffer(), Y.Matrix().LDim() );
+                 static_cast<const GraphTransposeMeta*>(nullptr),
+                 recvVals.data(), b, 1,
+          T(1),  Y.Matrix().Buffer(), 1, Y.Matrix().LDim() );
         if( time && commRank == 0 )
-            Output("  MultiplyCSRInterX time: ",timer.Stop());
+            Output("  MultiplyCSR time: ",timer.Stop());
     }
     else
     {
@@ -660,15 +760,26 @@ void Multiply
         if( time && commRank == 0 )
             timer.Start();
         vector<T> sendVals( meta.numRecvInds*b, 0 );
-        MultiplyCSRInterY
+        const GraphTransposeMeta* transposeMeta = nullptr;
+        if( NumRowChunks(meta.numRecvInds) > 1 )
+        {
+            auto& localTranspose = A.LockedDistGraph().multMeta.localTranspose;
+            if( !localTranspose.ready )
+                localTranspose.Initialize
+                ( A.LocalHeight(), meta.numRecvInds,
+                  A.LockedOffsetBuffer(), meta.colOffs.data() );
+            transposeMeta = &localTranspose;
+        }
+        MultiplyCSR
         ( orientation, A.LocalHeight(), meta.numRecvInds, b,
           alpha, A.LockedOffsetBuffer(),
                  meta.colOffs.data(),
                  A.LockedValueBuffer(),
-                 X.LockedMatrix().LockedBuffer(), X.LockedMatrix().LDim(),
-          T(1),  sendVals.data() );
+                 transposeMeta,
+                 X.LockedMatrix().LockedBuffer(), 1, X.LockedMatrix().LDim(),
+          T(1),  sendVals.data(), b, 1 );
         if( time && commRank == 0 )
-            Output("  MultiplyCSRInterY time: ",timer.Stop());
+            Output("  MultiplyCSR time: ",timer.Stop());
 
         // Inject the updates to Y into the network
         const Int numRecvInds = meta.sendInds.size();
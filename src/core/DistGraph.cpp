@@ -650,7 +650,7 @@ void DistGraph::AssertLocallyConsistent() const
     if( !locallyConsistent_ )
         LogicError("DistGraph was not consistent");
 }
-DistGraphMultMeta DistGraph::InitializeMultMeta() const
+const DistGraphMultMeta& DistGraph::InitializeMultMeta() const
 {
     EL_DEBUG_ONLY(CSE cse("DistSparseMatrix::InitializeMultMeta"))
     if( multMeta.ready )
@@ -658,6 +658,7 @@ DistGraphMultMeta DistGraph::InitializeMultMeta() const
     mpi::Comm comm = grid_->Comm();
     const int commSize = grid_->Size();
     auto& meta = multMeta;
+    meta.localTranspose.ready = false;
 
     // Compute the set of row indices that we need from X in a normal
     // multiply or update of Y in the adjoint case
@@ -121,6 +121,7 @@ void Graph::Empty( bool clearMemory )
     numTargets_ = 0;
     consistent_ = true;
     frozenSparsity_ = false;
+    transposeMeta_.Clear();
     if( clearMemory )
     {
         SwapClear( sources_ );
@@ -146,6 +147,7 @@ void Graph::Resize( Int numSources, Int numTargets )
         return;
 
     frozenSparsity_ = false;
+    transposeMeta_.ready = false;
 
     numSources_ = numSources;
     numTargets_ = numTargets;
@@ -206,6 +208,7 @@ void Graph::QueueConnection( Int source, Int target )
         sources_.push_back( source );
         targets_.push_back( target );
         consistent_ = false;
+        transposeMeta_.ready = false;
     }
 }
 
@@ -218,6 +221,7 @@ void Graph::QueueDisconnection( Int source, Int target )
     {
         markedForRemoval_.insert( pair<Int,Int>(source,target) );
         consistent_ = false;
+        transposeMeta_.ready = false;
     }
 }
 
@@ -363,9 +367,23 @@ Int Graph::NumConnections( Int source ) const EL_NO_RELEASE_EXCEPT
     return SourceOffset(source+1) - SourceOffset(source);
 }
 
-Int* Graph::SourceBuffer() EL_NO_EXCEPT { return sources_.data(); }
-Int* Graph::TargetBuffer() EL_NO_EXCEPT { return targets_.data(); }
-Int* Graph::OffsetBuffer() EL_NO_EXCEPT { return sourceOffsets_.data(); }
+// Since the edges may be modified through the mutable buffers, the transpose
+// mirror is conservatively invalidated
+Int* Graph::SourceBuffer() EL_NO_EXCEPT
+{
+    transposeMeta_.ready = false;
+    return sources_.data();
+}
+Int* Graph::TargetBuffer() EL_NO_EXCEPT
+{
+    transposeMeta_.ready = false;
+    return targets_.data();
+}
+Int* Graph::OffsetBuffer() EL_NO_EXCEPT
+{
+    transposeMeta_.ready = false;
+    return sourceOffsets_.data();
+}
 
 void Graph::ForceNumEdges( Int numEdges )
 {
@@ -373,6 +391,7 @@ void Graph::ForceNumEdges( Int numEdges )
     sources_.resize( numEdges );
     targets_.resize( numEdges );
     consistent_ = false;
+    transposeMeta_.ready = false;
 }
 
 void Graph::ForceConsistency( bool consistent ) EL_NO_EXCEPT
@@ -393,6 +412,7 @@ void Graph::ComputeSourceOffsets()
     EL_DEBUG_CSE
     Int sourceOffset = 0;
     Int prevSource = -1;
+    transposeMeta_.ready = false;
     sourceOffsets_.resize( numSources_+1 );
     const Int numEdges = NumEdges();
     const Int* sourceBuf = LockedSourceBuffer();
@@ -410,6 +430,17 @@ void Graph::ComputeSourceOffsets()
         sourceOffsets_[sourceOffset] = numEdges;
 }
 
+const GraphTransposeMeta& Graph::InitializeTransposeMeta() const
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertConsistent())
+    if( !transposeMeta_.ready )
+        transposeMeta_.Initialize
+        ( numSources_, numTargets_,
+          LockedOffsetBuffer(), LockedTargetBuffer() );
+    return transposeMeta_;
+}
+
 void Graph::AssertConsistent() const
 {
     if( !consistent_ )
@@ -246,6 +246,8 @@ void Grid::SetUpGrid()
 
 Grid::~Grid()
 {
+    // Any cached redistribution plans refer to this grid by its address
+    ClearRedistPlans( *this );
     if( !mpi::Finalized() )
     {
 #ifdef EL_HAVE_SCALAPACK
@@ -0,0 +1,246 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+
+namespace {
+
+using El::size_t;
+using El::string;
+
+struct MemoryPool
+{
+    // Every allocation queries this flag, so it is atomic rather than
+    // guarded by the mutex
+    std::atomic<bool> enabled{false};
+    size_t cacheLimit=std::numeric_limits<size_t>::max();
+
+    // Free lists keyed by the capacity of their size class
+    std::map<size_t,std::vector<void*>> freeLists;
+
+    std::vector<string> siteStack;
+    El::MemoryStats stats;
+
+    std::mutex mutex;
+};
+
+// The pool is intentionally never destructed so that Memory objects with
+// static storage duration may safely release their buffers at exit
+MemoryPool& Pool()
+{
+    static MemoryPool* pool = new MemoryPool;
+    return *pool;
+}
+
+// Round up to the nearest of the four size classes per power of two, i.e.,
+// (4+q) 2^(p-2) for q in {1,2,3,4}, so that at most 25% of each buffer is
+// wasted
+size_t SizeClass( size_t numBytes )
+{
+    const size_t minCapacity = El::memoryAlignment;
+    if( numBytes <= minCapacity )
+        return minCapacity;
+    size_t power = minCapacity;
+    while( 2*power < numBytes )
+        power *= 2;
+    const size_t quarter = power / 4;
+    return power + ((numBytes-power+quarter-1)/quarter)*quarter;
+}
+
+// Overallocate and store the original pointer immediately before the
+// aligned buffer
+void* AlignedMalloc( size_t numBytes )
+{
+    const size_t alignment = El::memoryAlignment;
+    void* rawPtr = std::malloc( numBytes+alignment+sizeof(void*) );
+    if( rawPtr == nullptr )
+        throw std::bad_alloc();
+    const std::uintptr_t rawAddress =
+      reinterpret_cast<std::uintptr_t>(rawPtr) + sizeof(void*);
+    const std::uintptr_t alignedAddress =
+      (rawAddress+alignment-1) & ~std::uintptr_t(alignment-1);
+    void* alignedPtr = reinterpret_cast<void*>(alignedAddress);
+    static_cast<void**>(alignedPtr)[-1] = rawPtr;
+    return alignedPtr;
+}
+
+void AlignedFree( void* alignedPtr )
+{
+    if( alignedPtr != nullptr )
+        std::free( static_cast<void**>(alignedPtr)[-1] );
+}
+
+void TrimCache( MemoryPool& pool )
+{
+    auto it = pool.freeLists.rbegin();
+    while( pool.stats.numBytesCached > pool.cacheLimit &&
+           it != pool.freeLists.rend() )
+    {
+        auto& freeList = it->second;
+        while( pool.stats.numBytesCached > pool.cacheLimit &&
+               !freeList.empty() )
+        {
+            AlignedFree( freeList.back() );
+            freeList.pop_back();
+            pool.stats.numBytesCached -= it->first;
+        }
+        ++it;
+    }
+}
+
+} // anonymous namespace
+
+namespace El {
+
+void EnableMemoryPool() { Pool().enabled = true; }
+
+void DisableMemoryPool() { Pool().enabled = false; }
+
+bool MemoryPoolEnabled() { return Pool().enabled; }
+
+void ClearMemoryPool()
+{
+    auto& pool = Pool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    for( auto& entry : pool.freeLists )
+        for( void* buffer : entry.second )
+            AlignedFree( buffer );
+    pool.freeLists.clear();
+    pool.stats.numBytesCached = 0;
+}
+
+void SetMemoryPoolCacheLimit( size_t numBytes )
+{
+    auto& pool = Pool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.cacheLimit = numBytes;
+    TrimCache( pool );
+}
+
+void PushAllocationSite( string site )
+{
+    auto& pool = Pool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.siteStack.push_back( site );
+}
+
+void PopAllocationSite()
+{
+    auto& pool = Pool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    if( pool.siteStack.empty() )
+        LogicError("Attempted to pop an empty allocation site stack");
+    pool.siteStack.pop_back();
+}
+
+AllocationSite::AllocationSite( const char* site )
+: active_(MemoryPoolEnabled())
+{
+    if( active_ )
+        PushAllocationSite( site );
+}
+
+AllocationSite::~AllocationSite()
+{
+    if( active_ )
+        PopAllocationSite();
+}
+
+MemoryStats GetMemoryStats()
+{
+    auto& pool = Pool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    return pool.stats;
+}
+
+void ResetMemoryStats()
+{
+    auto& pool = Pool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    const size_t numBytesInUse = pool.stats.numBytesInUse;
+    const size_t numBytesCached = pool.stats.numBytesCached;
+    pool.stats = MemoryStats();
+    pool.stats.numBytesInUse = numBytesInUse;
+    pool.stats.peakBytesInUse = numBytesInUse;
+    pool.stats.numBytesCached = numBytesCached;
+}
+
+void PrintMemoryStats( ostream& os )
+{
+    const MemoryStats stats = GetMemoryStats();
+    ostringstream msg;
+    msg << "Memory pool statistics:\n"
+        << "  requests:      " << stats.numRequests << "\n"
+        << "  pool hits:     " << stats.numPoolHits << "\n"
+        << "  hit rate:      " << stats.HitRate() << "\n"
+        << "  bytes in use:  " << stats.numBytesInUse << "\n"
+        << "  peak bytes:    " << stats.peakBytesInUse << "\n"
+        << "  bytes cached:  " << stats.numBytesCached << "\n";
+    if( !stats.requestsPerSite.empty() )
+    {
+        msg << "  requests per allocation site:\n";
+        for( const auto& entry : stats.requestsPerSite )
+            msg << "    " << entry.first << ": " << entry.second << "\n";
+    }
+    os << msg.str() << std::flush;
+}
+
+namespace memory {
+
+void* PooledAllocate( size_t numBytes, size_t& capacity )
+{
+    auto& pool = Pool();
+    capacity = SizeClass( numBytes );
+
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    auto& stats = pool.stats;
+    ++stats.numRequests;
+    if( pool.siteStack.empty() )
+        ++stats.requestsPerSite["(unlabeled)"];
+    else
+        ++stats.requestsPerSite[pool.siteStack.back()];
+
+    void* buffer;
+    auto it = pool.freeLists.find( capacity );
+    if( it != pool.freeLists.end() && !it->second.empty() )
+    {
+        buffer = it->second.back();
+        it->second.pop_back();
+        stats.numBytesCached -= capacity;
+        ++stats.numPoolHits;
+    }
+    else
+    {
+        buffer = AlignedMalloc( capacity );
+    }
+    stats.numBytesInUse += capacity;
+    stats.peakBytesInUse =
+      std::max( stats.peakBytesInUse, stats.numBytesInUse );
+    return buffer;
+}
+
+void PooledFree( void* buffer, size_t capacity )
+{
+    auto& pool = Pool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.stats.numBytesInUse -= capacity;
+    pool.freeLists[capacity].push_back( buffer );
+    pool.stats.numBytesCached += capacity;
+    if( pool.stats.numBytesCached > pool.cacheLimit )
+        TrimCache( pool );
+}
+
+} // namespace memory
+
+} // namespace El
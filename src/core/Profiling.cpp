@@ -0,0 +1,485 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <algorithm>
+#include <iomanip>
+
+namespace {
+
+using El::Int;
+using El::string;
+using El::Clock;
+
+struct Node
+{
+    string name;
+    Int numCalls=0;
+    double time=0, flops=0, bytes=0, mpiTime=0;
+    Node* parent=nullptr;
+    std::vector<std::unique_ptr<Node>> children;
+    Clock::time_point start;
+
+    Node* Child( const char* childName )
+    {
+        for( auto& child : children )
+            if( child->name == childName )
+                return child.get();
+        children.emplace_back( new Node );
+        Node* child = children.back().get();
+        child->name = childName;
+        child->parent = this;
+        return child;
+    }
+
+    void Reset()
+    {
+        numCalls = 0;
+        time = flops = bytes = mpiTime = 0;
+        for( auto& child : children )
+            child->Reset();
+    }
+};
+
+struct TraceEvent
+{
+    const Node* node;
+    double start, duration;
+};
+
+bool profilingEnabled = false;
+bool recordingTrace = false;
+Node root;
+Node* currentNode = &root;
+bool inMPICall = false;
+bool inFlopCount = false;
+Clock::time_point epoch;
+std::vector<TraceEvent> trace;
+
+inline bool OnMainThread()
+{
+#ifdef EL_HYBRID
+    return omp_get_thread_num() == 0;
+#else
+    return true;
+#endif
+}
+
+inline double Seconds( Clock::time_point a, Clock::time_point b )
+{ return std::chrono::duration<double>(b-a).count(); }
+
+// Metrics are stored in the order: calls, time, flops, bytes, MPI time
+const int numMetrics = 5;
+const char* metricNames[numMetrics] =
+  { "calls", "time", "flops", "bytes", "mpiTime" };
+
+void Flatten
+( const Node& node, const string& prefix, std::ostringstream& os )
+{
+    for( const auto& child : node.children )
+    {
+        const string path =
+          ( prefix.empty() ? child->name : prefix+"/"+child->name );
+        os << path << '\t' << child->numCalls << '\t' << child->time << '\t'
+           << child->flops << '\t' << child->bytes << '\t' << child->mpiTime
+           << '\n';
+        Flatten( *child, path, os );
+    }
+}
+
+void CopyTree( const Node& node, El::ProfileNode& copy )
+{
+    copy.name = node.name;
+    copy.numCalls = node.numCalls;
+    copy.time = node.time;
+    copy.flops = node.flops;
+    copy.bytes = node.bytes;
+    copy.mpiTime = node.mpiTime;
+    copy.children.resize( node.children.size() );
+    for( size_t j=0; j<node.children.size(); ++j )
+        CopyTree( *node.children[j], copy.children[j] );
+}
+
+// Gather the strings from each process to the root of the communicator
+std::vector<string> GatherStrings( const string& local, El::mpi::Comm comm )
+{
+    const int commSize = El::mpi::Size( comm );
+    const int commRank = El::mpi::Rank( comm );
+    const int localSize = local.size();
+    std::vector<int> sizes(commSize), offsets(commSize);
+    El::mpi::Gather( &localSize, 1, sizes.data(), 1, 0, comm );
+    int totalSize = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        offsets[q] = totalSize;
+        totalSize += sizes[q];
+    }
+    std::vector<El::byte> recvBuf( commRank==0 ? totalSize : 0 );
+    El::mpi::Gather
+    ( reinterpret_cast<const El::byte*>(local.data()), localSize,
+      recvBuf.data(), sizes.data(), offsets.data(), 0, comm );
+
+    std::vector<string> strings;
+    if( commRank == 0 )
+    {
+        strings.resize( commSize );
+        for( int q=0; q<commSize; ++q )
+            strings[q].assign
+            ( reinterpret_cast<const char*>(&recvBuf[offsets[q]]), sizes[q] );
+    }
+    return strings;
+}
+
+// The min/avg/max of each metric over all processes
+struct SummaryNode
+{
+    string name;
+    double stats[numMetrics][3];
+    std::vector<SummaryNode> children;
+
+    SummaryNode()
+    {
+        for( int k=0; k<numMetrics; ++k )
+            stats[k][0] = stats[k][1] = stats[k][2] = 0;
+    }
+
+    SummaryNode& Child( const string& childName )
+    {
+        for( auto& child : children )
+            if( child.name == childName )
+                return child;
+        children.emplace_back();
+        children.back().name = childName;
+        return children.back();
+    }
+};
+
+// Collective: returns the summary tree on the root (and an empty tree
+// elsewhere)
+SummaryNode Summarize( El::mpi::Comm comm )
+{
+    std::ostringstream os;
+    os.precision( 17 );
+    Flatten( root, "", os );
+    const auto strings = GatherStrings( os.str(), comm );
+
+    SummaryNode summary;
+    if( strings.empty() )
+        return summary;
+    const int commSize = strings.size();
+
+    // Collect the per-process metrics of each path (in first-seen order)
+    std::vector<string> paths;
+    std::map<string,std::vector<std::array<double,numMetrics>>> metrics;
+    for( int q=0; q<commSize; ++q )
+    {
+        std::istringstream is( strings[q] );
+        string line;
+        while( std::getline( is, line ) )
+        {
+            std::istringstream lineStream( line );
+            string path;
+            std::getline( lineStream, path, '\t' );
+            auto it = metrics.find( path );
+            if( it == metrics.end() )
+            {
+                paths.push_back( path );
+                std::array<double,numMetrics> zeros;
+                zeros.fill( 0 );
+                it = metrics.insert
+                  ( std::make_pair
+                    (path,std::vector<std::array<double,numMetrics>>
+                          (commSize,zeros)) ).first;
+            }
+            for( int k=0; k<numMetrics; ++k )
+                lineStream >> it->second[q][k];
+        }
+    }
+
+    for( const auto& path : paths )
+    {
+        SummaryNode* node = &summary;
+        std::istringstream pathStream( path );
+        string component;
+        while( std::getline( pathStream, component, '/' ) )
+            node = &node->Child( component );
+
+        const auto& values = metrics[path];
+        for( int k=0; k<numMetrics; ++k )
+        {
+            double minVal=values[0][k], maxVal=values[0][k], sum=0;
+            for( int q=0; q<commSize; ++q )
+            {
+                minVal = std::min( minVal, values[q][k] );
+                maxVal = std::max( maxVal, values[q][k] );
+                sum += values[q][k];
+            }
+            node->stats[k][0] = minVal;
+            node->stats[k][1] = sum / commSize;
+            node->stats[k][2] = maxVal;
+        }
+    }
+    return summary;
+}
+
+string EscapeJSON( const string& s )
+{
+    string escaped;
+    for( char c : s )
+    {
+        if( c == '"' || c == '\\' )
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+void PrintSummary
+( const SummaryNode& node, Int depth, std::ostringstream& os )
+{
+    for( const auto& child : node.children )
+    {
+        const string label = string(2*depth,' ') + child.name;
+        os << std::left << std::setw(40) << label << std::right
+           << std::setw(10) << child.stats[0][2]
+           << std::setw(13) << child.stats[1][0]
+           << std::setw(13) << child.stats[1][1]
+           << std::setw(13) << child.stats[1][2]
+           << std::setw(13) << child.stats[4][1]
+           << std::setw(13) << child.stats[2][1]/1.e9
+           << std::setw(13) << child.stats[3][1]/1.e6 << "\n";
+        PrintSummary( child, depth+1, os );
+    }
+}
+
+void WriteJSONChildren
+( const SummaryNode& node, const string& indent, std::ofstream& file )
+{
+    file << "[";
+    for( size_t j=0; j<node.children.size(); ++j )
+    {
+        const auto& child = node.children[j];
+        file << (j==0 ? "\n" : ",\n") << indent << "  {\n"
+             << indent << "    \"name\": \"" << EscapeJSON(child.name)
+             << "\",\n";
+        for( int k=0; k<numMetrics; ++k )
+            file << indent << "    \"" << metricNames[k] << "\": "
+                 << "{\"min\": " << child.stats[k][0]
+                 << ", \"avg\": " << child.stats[k][1]
+                 << ", \"max\": " << child.stats[k][2] << "},\n";
+        file << indent << "    \"children\": ";
+        WriteJSONChildren( child, indent+"    ", file );
+        file << "\n" << indent << "  }";
+    }
+    if( !node.children.empty() )
+        file << "\n" << indent;
+    file << "]";
+}
+
+} // anonymous namespace
+
+namespace El {
+
+void EnableProfiling( bool recordTrace )
+{
+    if( !profilingEnabled )
+        epoch = Clock::now();
+    profilingEnabled = true;
+    recordingTrace = recordTrace;
+}
+
+void DisableProfiling() { profilingEnabled = false; }
+
+bool ProfilingEnabled() { return profilingEnabled; }
+
+void ResetProfile()
+{
+    // The tree is zeroed rather than destroyed since regions may be active
+    root.Reset();
+    SwapClear( trace );
+    epoch = Clock::now();
+}
+
+ProfileNode LocalProfile()
+{
+    ProfileNode profile;
+    CopyTree( root, profile );
+    return profile;
+}
+
+void ProfileFlops( double flops )
+{
+    if( profilingEnabled && OnMainThread() )
+        currentNode->flops += flops;
+}
+
+void ProfileBytes( double bytes )
+{
+    if( profilingEnabled && OnMainThread() )
+        currentNode->bytes += bytes;
+}
+
+void ProfileMPITime( double seconds )
+{
+    if( profilingEnabled && OnMainThread() )
+        currentNode->mpiTime += seconds;
+}
+
+ProfileRegion::ProfileRegion( const char* name )
+: active_(profilingEnabled && OnMainThread())
+{
+    if( active_ )
+    {
+        currentNode = currentNode->Child( name );
+        currentNode->start = Clock::now();
+    }
+}
+
+ProfileRegion::~ProfileRegion()
+{
+    if( active_ )
+    {
+        const auto stop = Clock::now();
+        const double elapsed = Seconds( currentNode->start, stop );
+        currentNode->time += elapsed;
+        ++currentNode->numCalls;
+        if( recordingTrace )
+        {
+            TraceEvent event;
+            event.node = currentNode;
+            event.start = Seconds( epoch, currentNode->start );
+            event.duration = elapsed;
+            trace.push_back( event );
+        }
+        currentNode = currentNode->parent;
+    }
+}
+
+ProfileMPICall::ProfileMPICall()
+: active_(profilingEnabled && !inMPICall && OnMainThread())
+{
+    if( active_ )
+    {
+        inMPICall = true;
+        start_ = Clock::now();
+    }
+}
+
+ProfileMPICall::~ProfileMPICall()
+{
+    if( active_ )
+    {
+        currentNode->mpiTime += Seconds( start_, Clock::now() );
+        inMPICall = false;
+    }
+}
+
+ProfileFlopCount::ProfileFlopCount( double flops )
+: active_(profilingEnabled && !inFlopCount && OnMainThread())
+{
+    if( active_ )
+    {
+        inFlopCount = true;
+        currentNode->flops += flops;
+    }
+}
+
+ProfileFlopCount::~ProfileFlopCount()
+{
+    if( active_ )
+        inFlopCount = false;
+}
+
+void PrintProfile( mpi::Comm comm, ostream& os )
+{
+    const SummaryNode summary = Summarize( comm );
+    if( mpi::Rank(comm) != 0 )
+        return;
+
+    std::ostringstream msg;
+    msg << "Profile over " << mpi::Size(comm) << " processes "
+        << "(times in seconds, flops in GFlops, bytes in MB; averages are "
+        << "over processes)\n"
+        << std::left << std::setw(40) << "region" << std::right
+        << std::setw(10) << "calls"
+        << std::setw(13) << "min time"
+        << std::setw(13) << "avg time"
+        << std::setw(13) << "max time"
+        << std::setw(13) << "avg MPI"
+        << std::setw(13) << "avg GFlops"
+        << std::setw(13) << "avg MB" << "\n";
+    PrintSummary( summary, 0, msg );
+    os << msg.str() << std::flush;
+}
+
+void WriteProfileJSON( const string& filename, mpi::Comm comm )
+{
+    const SummaryNode summary = Summarize( comm );
+    if( mpi::Rank(comm) != 0 )
+        return;
+
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file.precision( 10 );
+    file << "{\n"
+         << "  \"numProcesses\": " << mpi::Size(comm) << ",\n"
+         << "  \"regions\": ";
+    WriteJSONChildren( summary, "  ", file );
+    file << "\n}\n";
+}
+
+void WriteProfileTrace( const string& filename, mpi::Comm comm )
+{
+    // The events are ordered by completion, so sort them by start time
+    auto sortedTrace = trace;
+    std::sort
+    ( sortedTrace.begin(), sortedTrace.end(),
+      []( const TraceEvent& a, const TraceEvent& b )
+      { return a.start < b.start; } );
+
+    std::ostringstream os;
+    os.precision( 17 );
+    for( const auto& event : sortedTrace )
+        os << event.node->name << '\t' << event.start << '\t'
+           << event.duration << '\n';
+    const auto strings = GatherStrings( os.str(), comm );
+    if( mpi::Rank(comm) != 0 )
+        return;
+
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file.precision( 15 );
+    file << "{\"traceEvents\": [";
+    bool first = true;
+    for( size_t q=0; q<strings.size(); ++q )
+    {
+        std::istringstream is( strings[q] );
+        string line;
+        while( std::getline( is, line ) )
+        {
+            std::istringstream lineStream( line );
+            string name;
+            double start, duration;
+            std::getline( lineStream, name, '\t' );
+            lineStream >> start >> duration;
+            file << (first ? "\n" : ",\n")
+                 << "  {\"name\": \"" << EscapeJSON(name) << "\", "
+                 << "\"ph\": \"X\", "
+                 << "\"ts\": " << start*1.e6 << ", "
+                 << "\"dur\": " << duration*1.e6 << ", "
+                 << "\"pid\": " << q << ", \"tid\": 0}";
+            first = false;
+        }
+    }
+    file << "\n],\n\"displayTimeUnit\": \"ms\"}\n";
+}
+
+} // namespace El
@@ -182,6 +182,13 @@ void Initialize( int& argc, char**& argv )
     EmptyBlocksizeStack();
     PushBlocksizeStack( 128 );
 
+    // Load any per-routine blocksizes produced by an autotuning run
+    ClearBlocksizeTuning();
+    DisableTunedBlocksizes();
+    const char* tuningFile = std::getenv("EL_BLOCKSIZE_TUNING_FILE");
+    if( tuningFile != nullptr )
+        LoadBlocksizeTuning( tuningFile );
+
     // Build the default grid
     Grid::InitializeDefault();
     Grid::InitializeTrivial();
@@ -228,6 +235,8 @@ void Finalize()
 
 
         EmptyBlocksizeStack();
+        ClearRedistPlans();
+        ClearMemoryPool();
 
 #ifdef EL_HAVE_QD
         FinalizeQD();
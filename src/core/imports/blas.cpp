@@ -32,9 +32,13 @@ using El::dcomplex;
 #include "./blas/Trsv.hpp"
 
 // Level 3
+#include "./blas/BlockedGemm.hpp"
 #include "./blas/Gemm.hpp"
 #include "./blas/Symm.hpp"
 #include "./blas/Syrk.hpp"
 #include "./blas/Syr2k.hpp"
 #include "./blas/Trmm.hpp"
 #include "./blas/Trsm.hpp"
+
+// Threading
+#include "./blas/Threads.hpp"
@@ -0,0 +1,377 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// A packed, cache-blocked GEMM in the style of Goto and van de Geijn's
+// "Anatomy of high-performance matrix multiplication" for the datatypes which
+// do not have a vendor BLAS (DoubleDouble, QuadDouble, and Quad). The three
+// outer loops partition C and op(A) op(B) into macro-tiles of size
+// MC x KC x NC whose packed copies of op(A) and op(B) are meant to respectively
+// live in the L2 and L3 caches, while an MR x NR register micro-kernel,
+// whose dimensions are fixed at compile-time for each datatype, accumulates
+// rank-KC updates into a small block of C.
+
+namespace El {
+namespace blas {
+namespace blocked_gemm {
+
+template<typename T>
+struct Blocking
+{
+    static const bool enabled = false;
+    static const BlasInt MR = 1;
+    static const BlasInt NR = 1;
+    static const BlasInt MC = 1;
+    static const BlasInt KC = 1;
+    static const BlasInt NC = 1;
+};
+
+// Each DoubleDouble FMA costs roughly twenty double-precision flops, so the
+// register tile is kept at 4 x 4 (32 doubles) and the packed panel of A at
+// MC x KC = 64 x 256 (256 KB).
+#ifdef EL_HAVE_QD
+template<>
+struct Blocking<DoubleDouble>
+{
+    static const bool enabled = true;
+    static const BlasInt MR = 4;
+    static const BlasInt NR = 4;
+    static const BlasInt MC = 64;
+    static const BlasInt KC = 256;
+    static const BlasInt NC = 2048;
+};
+template<>
+struct Blocking<QuadDouble>
+{
+    static const bool enabled = true;
+    static const BlasInt MR = 2;
+    static const BlasInt NR = 4;
+    static const BlasInt MC = 32;
+    static const BlasInt KC = 256;
+    static const BlasInt NC = 1024;
+};
+template<>
+struct Blocking<Complex<DoubleDouble>>
+{
+    static const bool enabled = true;
+    static const BlasInt MR = 2;
+    static const BlasInt NR = 2;
+    static const BlasInt MC = 32;
+    static const BlasInt KC = 256;
+    static const BlasInt NC = 1024;
+};
+template<>
+struct Blocking<Complex<QuadDouble>>
+{
+    static const bool enabled = true;
+    static const BlasInt MR = 2;
+    static const BlasInt NR = 2;
+    static const BlasInt MC = 16;
+    static const BlasInt KC = 256;
+    static const BlasInt NC = 512;
+};
+#endif
+#ifdef EL_HAVE_QUAD
+template<>
+struct Blocking<Quad>
+{
+    static const bool enabled = true;
+    static const BlasInt MR = 4;
+    static const BlasInt NR = 4;
+    static const BlasInt MC = 64;
+    static const BlasInt KC = 256;
+    static const BlasInt NC = 2048;
+};
+template<>
+struct Blocking<Complex<Quad>>
+{
+    static const bool enabled = true;
+    static const BlasInt MR = 2;
+    static const BlasInt NR = 2;
+    static const BlasInt MC = 32;
+    static const BlasInt KC = 256;
+    static const BlasInt NC = 1024;
+};
+#endif
+
+template<typename T>
+struct IsBlocked
+{ static const bool value = Blocking<T>::enabled; };
+
+// The products below this many flops are handled by the unblocked loops since
+// the cost of packing would not be amortized
+const double minBlockedFlops = 32.*32.*32.;
+
+// Entry (i,l) of op(M) is M[i*rowStride+l*colStride], conjugated if 'conjugate'
+template<typename T>
+struct OpView
+{
+    const T* buffer;
+    BlasInt rowStride;
+    BlasInt colStride;
+    bool conjugate;
+
+    OpView( char trans, const T* M, BlasInt MLDim )
+    : buffer(M),
+      rowStride( std::toupper(trans)=='N' ? 1 : MLDim ),
+      colStride( std::toupper(trans)=='N' ? MLDim : 1 ),
+      conjugate( std::toupper(trans)=='C' )
+    { }
+
+    void Get( BlasInt i, BlasInt l, T& alpha ) const
+    {
+        const T& beta = buffer[i*rowStride+l*colStride];
+        if( conjugate )
+            Conj( beta, alpha );
+        else
+            alpha = beta;
+    }
+};
+
+// Pack the mc x kc block of op(A) starting at (i0,l0) into row panels of
+// height MR, stored such that each column of a panel is contiguous. The
+// trailing panel is padded with zeros.
+template<typename T>
+void PackA
+( const OpView<T>& A, BlasInt i0, BlasInt l0, BlasInt mc, BlasInt kc,
+  T* APack )
+{
+    const BlasInt MR = Blocking<T>::MR;
+    for( BlasInt ir=0; ir<mc; ir+=MR )
+    {
+        const BlasInt mr = Min(MR,mc-ir);
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            for( BlasInt i=0; i<mr; ++i )
+                A.Get( i0+ir+i, l0+l, APack[i] );
+            for( BlasInt i=mr; i<MR; ++i )
+                APack[i] = 0;
+            APack += MR;
+        }
+    }
+}
+
+// Pack the kc x nc block of op(B) starting at (l0,j0) into column panels of
+// width NR, stored such that each row of a panel is contiguous. The trailing
+// panel is padded with zeros.
+template<typename T>
+void PackB
+( const OpView<T>& B, BlasInt l0, BlasInt j0, BlasInt kc, BlasInt nc,
+  T* BPack )
+{
+    const BlasInt NR = Blocking<T>::NR;
+    const BlasInt numPanels = (nc+NR-1) / NR;
+    EL_PARALLEL_FOR
+    for( BlasInt panel=0; panel<numPanels; ++panel )
+    {
+        const BlasInt jr = panel*NR;
+        const BlasInt nr = Min(NR,nc-jr);
+        T* BPanel = &BPack[jr*kc];
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            for( BlasInt j=0; j<nr; ++j )
+                B.Get( l0+l, j0+jr+j, BPanel[j] );
+            for( BlasInt j=nr; j<NR; ++j )
+                BPanel[j] = 0;
+            BPanel += NR;
+        }
+    }
+}
+
+// C(0:mr,0:nr) += alpha A B, where A is a packed MR x kc panel and B is a
+// packed kc x NR panel. The fixed dimensions allow the compiler to fully
+// unroll the rank-one updates and keep the accumulators in registers.
+template<typename T,BlasInt MR,BlasInt NR>
+void MicroKernel
+( BlasInt kc, const T& alpha,
+  const T* A,
+  const T* B,
+        T* C, BlasInt CLDim,
+  BlasInt mr, BlasInt nr )
+{
+    T AB[MR*NR];
+    for( BlasInt t=0; t<MR*NR; ++t )
+        AB[t] = 0;
+
+    for( BlasInt l=0; l<kc; ++l )
+    {
+        for( BlasInt j=0; j<NR; ++j )
+        {
+            const T& beta = B[j];
+            for( BlasInt i=0; i<MR; ++i )
+                AB[i+j*MR] += A[i]*beta;
+        }
+        A += MR;
+        B += NR;
+    }
+
+    if( alpha == T(1) )
+    {
+        for( BlasInt j=0; j<nr; ++j )
+            for( BlasInt i=0; i<mr; ++i )
+                C[i+j*CLDim] += AB[i+j*MR];
+    }
+    else
+    {
+        for( BlasInt j=0; j<nr; ++j )
+            for( BlasInt i=0; i<mr; ++i )
+                C[i+j*CLDim] += alpha*AB[i+j*MR];
+    }
+}
+
+// C += alpha op(A) op(B), where C has already been scaled by beta
+template<typename T>
+void Accumulate
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+        T* C, BlasInt CLDim )
+{
+    const BlasInt MR = Blocking<T>::MR;
+    const BlasInt NR = Blocking<T>::NR;
+    const BlasInt MC = Blocking<T>::MC;
+    const BlasInt KC = Blocking<T>::KC;
+    const BlasInt NC = Blocking<T>::NC;
+    const OpView<T> AView( transA, A, ALDim );
+    const OpView<T> BView( transB, B, BLDim );
+
+    const BlasInt numMBlocks = (m+MC-1) / MC;
+    vector<T> BPack( Min(k,KC)*(((Min(n,NC)+NR-1)/NR)*NR) );
+    for( BlasInt jc=0; jc<n; jc+=NC )
+    {
+        const BlasInt nc = Min(NC,n-jc);
+        for( BlasInt pc=0; pc<k; pc+=KC )
+        {
+            const BlasInt kc = Min(KC,k-pc);
+            PackB( BView, pc, jc, kc, nc, BPack.data() );
+
+            // Each thread packs and owns a distinct MC x KC block of op(A)
+            // and hence updates a distinct MC x NC block of C
+            EL_PARALLEL_FOR
+            for( BlasInt icBlock=0; icBlock<numMBlocks; ++icBlock )
+            {
+                const BlasInt ic = icBlock*MC;
+                const BlasInt mc = Min(MC,m-ic);
+                vector<T> APack( ((mc+MR-1)/MR)*MR*kc );
+                PackA( AView, ic, pc, mc, kc, APack.data() );
+                for( BlasInt jr=0; jr<nc; jr+=NR )
+                {
+                    const BlasInt nr = Min(NR,nc-jr);
+                    for( BlasInt ir=0; ir<mc; ir+=MR )
+                    {
+                        const BlasInt mr = Min(MR,mc-ir);
+                        MicroKernel<T,Blocking<T>::MR,Blocking<T>::NR>
+                        ( kc, alpha,
+                          &APack[ir*kc], &BPack[jr*kc],
+                          &C[(ic+ir)+(jc+jr)*CLDim], CLDim, mr, nr );
+                    }
+                }
+            }
+        }
+    }
+}
+
+template<typename T,typename=EnableIf<IsBlocked<T>>>
+bool UseBlocked( BlasInt m, BlasInt n, BlasInt k )
+{
+    return double(m)*double(n)*double(k) >= minBlockedFlops &&
+           m >= Blocking<T>::MR && n >= Blocking<T>::NR;
+}
+
+template<typename T,typename=DisableIf<IsBlocked<T>>,typename=void>
+bool UseBlocked( BlasInt, BlasInt, BlasInt )
+{ return false; }
+
+} // namespace blocked_gemm
+
+template<typename T>
+void BlockedGemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    if( beta == T(0) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                C[i+j*CLDim] = 0;
+    }
+    else if( beta != T(1) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                C[i+j*CLDim] *= beta;
+    }
+    if( m == 0 || n == 0 || k == 0 )
+        return;
+    blocked_gemm::Accumulate
+    ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, C, CLDim );
+}
+
+#ifdef EL_HAVE_QD
+template void BlockedGemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* B, BlasInt BLDim,
+  const DoubleDouble& beta,
+        DoubleDouble* C, BlasInt CLDim );
+template void BlockedGemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const QuadDouble& alpha,
+  const QuadDouble* A, BlasInt ALDim,
+  const QuadDouble* B, BlasInt BLDim,
+  const QuadDouble& beta,
+        QuadDouble* C, BlasInt CLDim );
+template void BlockedGemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const Complex<DoubleDouble>& alpha,
+  const Complex<DoubleDouble>* A, BlasInt ALDim,
+  const Complex<DoubleDouble>* B, BlasInt BLDim,
+  const Complex<DoubleDouble>& beta,
+        Complex<DoubleDouble>* C, BlasInt CLDim );
+template void BlockedGemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const Complex<QuadDouble>& alpha,
+  const Complex<QuadDouble>* A, BlasInt ALDim,
+  const Complex<QuadDouble>* B, BlasInt BLDim,
+  const Complex<QuadDouble>& beta,
+        Complex<QuadDouble>* C, BlasInt CLDim );
+#endif
+#ifdef EL_HAVE_QUAD
+template void BlockedGemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const Quad& alpha,
+  const Quad* A, BlasInt ALDim,
+  const Quad* B, BlasInt BLDim,
+  const Quad& beta,
+        Quad* C, BlasInt CLDim );
+template void BlockedGemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const Complex<Quad>& alpha,
+  const Complex<Quad>* A, BlasInt ALDim,
+  const Complex<Quad>* B, BlasInt BLDim,
+  const Complex<Quad>& beta,
+        Complex<Quad>* C, BlasInt CLDim );
+#endif
+
+} // namespace blas
+} // namespace El
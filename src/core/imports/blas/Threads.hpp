@@ -0,0 +1,51 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// NOTE: The 64-bit integer builds of OpenBLAS rename their exported symbols,
+//       so only the standard build is queried
+#if defined(EL_HAVE_MKL)
+extern "C" {
+int mkl_get_max_threads();
+void mkl_set_num_threads( int numThreads );
+} // extern "C"
+#elif defined(EL_HAVE_OPENBLAS) && !defined(EL_USE_64BIT_BLAS_INTS)
+# define EL_HAVE_OPENBLAS_THREADS
+extern "C" {
+int openblas_get_num_threads();
+void openblas_set_num_threads( int numThreads );
+} // extern "C"
+#endif
+
+namespace El {
+namespace blas {
+
+int GetNumThreads()
+{
+#if defined(EL_HAVE_MKL)
+    return mkl_get_max_threads();
+#elif defined(EL_HAVE_OPENBLAS_THREADS)
+    return openblas_get_num_threads();
+#else
+    return 1;
+#endif
+}
+
+void SetNumThreads( int numThreads )
+{
+    if( numThreads < 1 )
+        LogicError("Cannot run the BLAS with ",numThreads," threads");
+#if defined(EL_HAVE_MKL)
+    mkl_set_num_threads( numThreads );
+#elif defined(EL_HAVE_OPENBLAS_THREADS)
+    openblas_set_num_threads( numThreads );
+#endif
+}
+
+} // namespace blas
+} // namespace El
@@ -391,6 +391,151 @@ void Translate
     Free( newGroup  );
 }
 
+// Parallel file I/O
+// =================
+
+void FileOpen
+( Comm comm, const std::string& filename, bool write, File& file )
+{
+    EL_DEBUG_CSE
+    const int mode =
+      ( write ? MPI_MODE_CREATE|MPI_MODE_WRONLY : MPI_MODE_RDONLY );
+    const int error =
+      MPI_File_open
+      ( comm.comm, const_cast<char*>(filename.c_str()), mode, MPI_INFO_NULL,
+        &file );
+    if( error != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+    if( write )
+        SafeMpi( MPI_File_set_size( file, 0 ) );
+}
+
+void FileClose( File& file ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_File_close( &file ) );
+}
+
+Offset FileSize( File file ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    Offset size;
+    SafeMpi( MPI_File_get_size( file, &size ) );
+    return size;
+}
+
+void FileReadAt( File file, Offset offset, byte* buf, int numBytes )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    Status status;
+    SafeMpi
+    ( MPI_File_read_at( file, offset, buf, numBytes, MPI_BYTE, &status ) );
+}
+
+void FileWriteAt( File file, Offset offset, const byte* buf, int numBytes )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    Status status;
+    SafeMpi
+    ( MPI_File_write_at
+      ( file, offset, const_cast<byte*>(buf), numBytes, MPI_BYTE, &status ) );
+}
+
+namespace {
+
+// Set the view of the file to the requested submatrix and return the
+// datatypes of an entry and of the submatrix within the local buffer
+void SetSubmatrixView
+( File file, Offset disp, int entrySize, Int height,
+  const vector<Int>& rowInds, const vector<Int>& colInds, Int ldim,
+  Datatype& entryType, Datatype& bufferType )
+{
+    SafeMpi( MPI_Type_contiguous( entrySize, MPI_BYTE, &entryType ) );
+    SafeMpi( MPI_Type_commit( &entryType ) );
+
+    // Each local column is a sequence of runs of consecutive rows
+    vector<int> runLengths, runOffsets;
+    const Int localHeight = rowInds.size();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        if( iLoc > 0 && rowInds[iLoc] == rowInds[iLoc-1]+1 )
+            ++runLengths.back();
+        else
+        {
+            runLengths.push_back( 1 );
+            runOffsets.push_back( rowInds[iLoc] );
+        }
+    }
+    Datatype colType;
+    SafeMpi
+    ( MPI_Type_indexed
+      ( runLengths.size(), runLengths.data(), runOffsets.data(), entryType,
+        &colType ) );
+
+    const Int localWidth = colInds.size();
+    vector<int> colLengths( localWidth, 1 );
+    vector<Aint> colOffsets( localWidth );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        colOffsets[jLoc] = Aint(colInds[jLoc])*height*entrySize;
+    Datatype fileType;
+    SafeMpi
+    ( MPI_Type_create_hindexed
+      ( localWidth, colLengths.data(), colOffsets.data(), colType,
+        &fileType ) );
+    SafeMpi( MPI_Type_commit( &fileType ) );
+    SafeMpi
+    ( MPI_File_set_view
+      ( file, disp, entryType, fileType, const_cast<char*>("native"),
+        MPI_INFO_NULL ) );
+    SafeMpi( MPI_Type_free( &fileType ) );
+    SafeMpi( MPI_Type_free( &colType ) );
+
+    SafeMpi
+    ( MPI_Type_vector
+      ( localWidth, localHeight, ldim, entryType, &bufferType ) );
+    SafeMpi( MPI_Type_commit( &bufferType ) );
+}
+
+} // anonymous namespace
+
+void FileReadSubmatrixAll
+( File file, Offset disp, int entrySize, Int height,
+  const vector<Int>& rowInds, const vector<Int>& colInds,
+  byte* buf, Int ldim ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    Datatype entryType, bufferType;
+    SetSubmatrixView
+    ( file, disp, entrySize, height, rowInds, colInds, ldim,
+      entryType, bufferType );
+    const int count = ( rowInds.size()*colInds.size() > 0 ? 1 : 0 );
+    Status status;
+    SafeMpi( MPI_File_read_all( file, buf, count, bufferType, &status ) );
+    SafeMpi( MPI_Type_free( &bufferType ) );
+    SafeMpi( MPI_Type_free( &entryType ) );
+}
+
+void FileWriteSubmatrixAll
+( File file, Offset disp, int entrySize, Int height,
+  const vector<Int>& rowInds, const vector<Int>& colInds,
+  const byte* buf, Int ldim ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    Datatype entryType, bufferType;
+    SetSubmatrixView
+    ( file, disp, entrySize, height, rowInds, colInds, ldim,
+      entryType, bufferType );
+    const int count = ( rowInds.size()*colInds.size() > 0 ? 1 : 0 );
+    Status status;
+    SafeMpi
+    ( MPI_File_write_all
+      ( file, const_cast<byte*>(buf), count, bufferType, &status ) );
+    SafeMpi( MPI_Type_free( &bufferType ) );
+    SafeMpi( MPI_Type_free( &entryType ) );
+}
+
 // Various utilities
 // =================
 
@@ -398,6 +543,7 @@ void Translate
 void Barrier( Comm comm ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     SafeMpi( MPI_Barrier( comm.comm ) );
 }
 
@@ -427,6 +573,7 @@ template<typename T,
 void Wait( Request<T>& request, Status& status ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     SafeMpi( MPI_Wait( &request.backend, &status ) );
 }
 
@@ -446,6 +593,7 @@ void WaitAll( int numRequests, Request<T>* requests, Status* statuses )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
 #ifndef EL_MPI_REQUEST_IS_NOT_POINTER
     // Both MPICH and OpenMPI define MPI_Request to be a pointer to a structure,
     // which implies that the following code is legal. AFAIK, there are not
@@ -474,6 +622,7 @@ template<typename T,
 void Wait( Request<T>& request, Status& status ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     SafeMpi( MPI_Wait( &request.backend, &status ) );
     if( request.receivingPacked )
     {
@@ -491,6 +640,7 @@ void WaitAll( int numRequests, Request<T>* requests, Status* statuses )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
 #ifndef EL_MPI_REQUEST_IS_NOT_POINTER
     // Both MPICH and OpenMPI define MPI_Request to be a pointer to a structure,
     // which implies that the following code is legal. AFAIK, there are not
@@ -552,6 +702,7 @@ void TaggedSend( const Real* buf, int count, int to, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     SafeMpi
     ( MPI_Send
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, tag, comm.comm ) );
@@ -564,6 +715,7 @@ void TaggedSend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Send
@@ -583,6 +735,7 @@ template<typename T,
 void TaggedSend( const T* buf, int count, int to, int tag, Comm comm )
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     std::vector<byte> packedBuf;
     Serialize( count, buf, packedBuf );
     SafeMpi
@@ -796,6 +949,7 @@ void TaggedRecv( Real* buf, int count, int from, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     Status status;
     SafeMpi
     ( MPI_Recv( buf, count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
@@ -807,6 +961,7 @@ void TaggedRecv( Complex<Real>* buf, int count, int from, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -824,6 +979,7 @@ template<typename T,
 void TaggedRecv( T* buf, int count, int from, int tag, Comm comm )
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     std::vector<byte> packedBuf;
     ReserveSerialized( count, buf, packedBuf );
     Status status;
@@ -923,6 +1079,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     Status status;
     SafeMpi
     ( MPI_Sendrecv
@@ -939,6 +1096,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -964,6 +1122,7 @@ void TaggedSendRecv
         T* rbuf, int rc, int from, int rtag, Comm comm )
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     Status status;
     std::vector<byte> packedSend, packedRecv;
     Serialize( sc, sbuf, packedSend );
@@ -1004,6 +1163,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     Status status;
     SafeMpi
     ( MPI_Sendrecv_replace
@@ -1019,6 +1179,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -1041,6 +1202,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     std::vector<byte> packedBuf;
     ReserveSerialized( count, buf, packedBuf );
     Serialize( count, buf, packedBuf );
@@ -1063,6 +1225,7 @@ void Broadcast( Real* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     if( Size(comm) == 1 || count == 0 )
         return;
     SafeMpi( MPI_Bcast( buf, count, TypeMap<Real>(), root, comm.comm ) );
@@ -1074,6 +1237,7 @@ void Broadcast( Complex<Real>* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     if( Size(comm) == 1 )
         return;
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -1090,6 +1254,7 @@ void Broadcast( T* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     if( Size(comm) == 1 || count == 0 )
         return;
     std::vector<byte> packedBuf;
@@ -1175,6 +1340,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     SafeMpi
     ( MPI_Gather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1189,6 +1355,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Gather
@@ -1213,6 +1380,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalRecv = rc*commSize;
@@ -1316,6 +1484,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     SafeMpi
     ( MPI_Gatherv
       ( const_cast<Real*>(sbuf),
@@ -1338,6 +1507,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
 #ifdef EL_AVOID_COMPLEX_MPI
     const int commRank = Rank( comm );
     const int commSize = Size( comm );
@@ -1382,6 +1552,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     int totalRecv=0;
@@ -1416,6 +1587,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -1440,6 +1612,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -1474,6 +1647,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     const int commSize = mpi::Size(comm);
     const int totalRecv = rc*commSize;
 
@@ -1496,6 +1670,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1533,6 +1708,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1585,6 +1761,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     const int commSize = mpi::Size(comm);
     const int totalRecv = rcs[commSize-1]+rds[commSize-1];
 
@@ -1605,6 +1782,91 @@ EL_NO_RELEASE_EXCEPT
     Deserialize( totalRecv, packedRecv, rbuf );
 }
 
+namespace {
+
+// The entries buf[i*rowStride+j*colStride*ldim] for 0 <= i < height and
+// 0 <= j < width
+template<typename T>
+Datatype StridedMatrixType
+( int height, int width, int rowStride, int colStride, int ldim )
+{
+    Datatype colType, stridedColType, matrixType;
+    SafeMpi
+    ( MPI_Type_vector( height, 1, rowStride, TypeMap<T>(), &colType ) );
+    SafeMpi
+    ( MPI_Type_create_resized
+      ( colType, 0, Aint(colStride)*ldim*sizeof(T), &stridedColType ) );
+    SafeMpi( MPI_Type_contiguous( width, stridedColType, &matrixType ) );
+    SafeMpi( MPI_Type_commit( &matrixType ) );
+    SafeMpi( MPI_Type_free( &stridedColType ) );
+    SafeMpi( MPI_Type_free( &colType ) );
+    return matrixType;
+}
+
+} // anonymous namespace
+
+template<typename T,
+         typename/*=EnableIf<IsPacked<T>>*/>
+void StridedAllGather
+( const T* sbuf, int sHeight, int sWidth, int sLDim,
+        T* rbuf, int rLDim, int rRowStride, int rColStride,
+  const int* rHeights, const int* rWidths,
+  const int* rRowOffs, const int* rColOffs, Comm comm )
+{
+    EL_DEBUG_CSE
+    ProfileMPICall profile;
+    const int commSize = Size( comm );
+
+    // The same (possibly empty) matrix is sent to every process, and each
+    // process's contribution is received directly into its strided location
+    Datatype sendType = StridedMatrixType<T>( sHeight, sWidth, 1, 1, sLDim );
+    const int sendCount = ( sHeight*sWidth > 0 ? 1 : 0 );
+    vector<int> sendCounts(commSize,sendCount), sendDispls(commSize,0);
+    vector<Datatype> sendTypes(commSize,sendType);
+    vector<int> recvCounts(commSize), recvDispls(commSize);
+    vector<Datatype> recvTypes(commSize);
+    for( int q=0; q<commSize; ++q )
+    {
+        recvTypes[q] =
+          StridedMatrixType<T>
+          ( rHeights[q], rWidths[q], rRowStride, rColStride, rLDim );
+        recvCounts[q] = ( rHeights[q]*rWidths[q] > 0 ? 1 : 0 );
+        // MPI_Alltoallw only accepts int byte displacements
+        const Aint recvDispl =
+          (Aint(rRowOffs[q])+Aint(rColOffs[q])*rLDim)*Aint(sizeof(T));
+        if( recvDispl > Aint(limits::Max<int>()) )
+            RuntimeError
+            ("StridedAllGather displacement of ",recvDispl,
+             " bytes does not fit in an int");
+        recvDispls[q] = int(recvDispl);
+    }
+
+    SafeMpi
+    ( MPI_Alltoallw
+      ( const_cast<T*>(sbuf),
+        sendCounts.data(), sendDispls.data(), sendTypes.data(),
+        rbuf,
+        recvCounts.data(), recvDispls.data(), recvTypes.data(),
+        comm.comm ) );
+
+    for( int q=0; q<commSize; ++q )
+        SafeMpi( MPI_Type_free( &recvTypes[q] ) );
+    SafeMpi( MPI_Type_free( &sendType ) );
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void StridedAllGather
+( const T* sbuf, int sHeight, int sWidth, int sLDim,
+        T* rbuf, int rLDim, int rRowStride, int rColStride,
+  const int* rHeights, const int* rWidths,
+  const int* rRowOffs, const int* rColOffs, Comm comm )
+{
+    EL_DEBUG_CSE
+    LogicError("StridedAllGather requires a packed datatype");
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void Scatter
@@ -1613,6 +1875,7 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     SafeMpi
     ( MPI_Scatter
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1627,6 +1890,7 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Scatter
@@ -1651,6 +1915,7 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalSend = sc*commSize;
@@ -1673,6 +1938,7 @@ void Scatter( Real* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1696,6 +1962,7 @@ void Scatter( Complex<Real>* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1734,6 +2001,7 @@ void Scatter( T* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalSend = sc*commSize;
@@ -1760,6 +2028,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     SafeMpi
     ( MPI_Alltoall
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1774,6 +2043,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Alltoall
@@ -1800,6 +2070,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     const int commSize = mpi::Size( comm );
     const int totalSend = sc*commSize;
     const int totalRecv = rc*commSize;
@@ -1822,6 +2093,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     SafeMpi
     ( MPI_Alltoallv
       ( const_cast<Real*>(sbuf),
@@ -1843,6 +2115,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
 #ifdef EL_AVOID_COMPLEX_MPI
     int p;
     MPI_Comm_size( comm.comm, &p );
@@ -1884,6 +2157,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     const int commSize = mpi::Size( comm );
     const int totalSend = scs[commSize-1]+sds[commSize-1];
     const int totalRecv = rcs[commSize-1]+rds[commSize-1];
@@ -1928,6 +2202,7 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     if( count == 0 )
         return;
 
@@ -1946,6 +2221,7 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     if( count == 0 )
         return;
 
@@ -1984,6 +2260,7 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     if( count == 0 )
         return;
 
@@ -2032,6 +2309,7 @@ void Reduce( Real* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -2057,6 +2335,7 @@ void Reduce( Complex<Real>* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     if( Size(comm) == 1 )
         return;
     if( count != 0 )
@@ -2119,6 +2398,7 @@ void Reduce( T* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     if( count == 0 )
         return;
 
@@ -2151,6 +2431,7 @@ void AllReduce( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     if( count != 0 )
     {
         MPI_Op opC = NativeOp<Real>( op );
@@ -2168,6 +2449,7 @@ void AllReduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2205,6 +2487,7 @@ void AllReduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     if( count == 0 )
         return;
 
@@ -2241,6 +2524,7 @@ void AllReduce( Real* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -2256,6 +2540,7 @@ void AllReduce( Complex<Real>* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -2291,6 +2576,7 @@ void AllReduce( T* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     if( count == 0 )
         return;
 
@@ -2317,6 +2603,7 @@ void ReduceScatter( Real* sbuf, Real* rbuf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     if( rc == 0 )
         return;
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
@@ -2343,6 +2630,7 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     if( rc == 0 )
         return;
 
@@ -2377,6 +2665,7 @@ void ReduceScatter( T* sbuf, T* rbuf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     if( rc == 0 )
         return;
     const int commSize = mpi::Size(comm);
@@ -2424,6 +2713,7 @@ void ReduceScatter( Real* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     if( rc == 0 || Size(comm) == 1 )
         return;
 
@@ -2451,6 +2741,7 @@ void ReduceScatter( Complex<Real>* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     if( rc == 0 || Size(comm) == 1 )
         return;
 
@@ -2486,6 +2777,7 @@ void ReduceScatter( T* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     if( rc == 0 )
         return;
     const int commSize = mpi::Size(comm);
@@ -2524,6 +2816,7 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
     ( MPI_Reduce_scatter
@@ -2539,6 +2832,7 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
 #ifdef EL_AVOID_COMPLEX_MPI
     if( op == SUM )
     {
@@ -2580,6 +2874,7 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileMPICall profile;
     const int commRank = mpi::Rank(comm);
     const int commSize = mpi::Size(comm);
     int totalSend=0;
@@ -2944,6 +3239,11 @@ EL_NO_RELEASE_EXCEPT
   ( const T* sbuf, int sc, \
           T* rbuf, const int* rcs, const int* rds, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void StridedAllGather \
+  ( const T* sbuf, int sHeight, int sWidth, int sLDim, \
+          T* rbuf, int rLDim, int rRowStride, int rColStride, \
+    const int* rHeights, const int* rWidths, \
+    const int* rRowOffs, const int* rColOffs, Comm comm ); \
   template void Scatter \
   ( const T* sbuf, int sc, \
           T* rbuf, int rc, int root, Comm comm ) \
@@ -30,11 +30,59 @@ int pmrrr
   int* ZSupp      // support of eigenvectors [length 2n]
 );
 
+typedef struct {
+  int nthreads;
+  double min_relgap;
+  int balance;
+  int max_nz;
+} pmrrr_params_t;
+
+typedef struct {
+  int nthreads;
+  int num_clusters;
+  int num_clustered;
+  double time_vals;
+  double time_vecs;
+  double time_refine;
+} pmrrr_stats_t;
+
+// A variant of pmrrr which accepts tuning parameters and returns statistics
+int pmrrr_ctrl
+( const char* jobz, const char* range, const int* n, double* d, double* e,
+  const double* vl, const double* vu, const int* il, const int* iu,
+  int* tryrac, MPI_Comm comm, int* nz, int* offset, double* w,
+  double* Z, const int* ldz, int* ZSupp,
+  const pmrrr_params_t* params, pmrrr_stats_t* stats );
+
 } // extern "C"
 
 namespace El {
 namespace herm_tridiag_eig {
 
+namespace {
+
+pmrrr_params_t Params( const Ctrl& ctrl )
+{
+    pmrrr_params_t params;
+    params.nthreads = ctrl.numThreads;
+    params.min_relgap = ctrl.minRelGap;
+    params.balance = ctrl.balance;
+    params.max_nz = ctrl.maxLocalEigenvectors;
+    return params;
+}
+
+void SetStats( const pmrrr_stats_t& stats, Info& info )
+{
+    info.numThreads = stats.nthreads;
+    info.numClusters = stats.num_clusters;
+    info.numLocalClustered = stats.num_clustered;
+    info.eigenvalueTime = stats.time_vals;
+    info.eigenvectorTime = stats.time_vecs;
+    info.refineTime = stats.time_refine;
+}
+
+} // anonymous namespace
+
 // Return upper bounds on the number of (local) eigenvalues in the given range,
 // (lowerBound,upperBound]
 Estimate EigEstimate
@@ -62,7 +110,8 @@ Estimate EigEstimate
 }
 
 // Compute all of the eigenvalues
-Info Eig( int n, double* d, double* e, double* w, mpi::Comm comm )
+Info Eig
+( int n, double* d, double* e, double* w, mpi::Comm comm, const Ctrl& ctrl )
 {
     EL_DEBUG_CSE
     Info info;
@@ -70,15 +119,18 @@ Info Eig( int n, double* d, double* e, double* w, mpi::Comm comm )
     char range='A';
     double vl, vu;
     int il, iu;
-    int highAccuracy=0; 
+    int highAccuracy=ctrl.highAccuracy;
     int nz, offset;
     int ldz=1;
     vector<int> ZSupport(2*n);
-    int retval = pmrrr
+    const pmrrr_params_t params = Params( ctrl );
+    pmrrr_stats_t stats;
+    int retval = pmrrr_ctrl
     ( &jobz, &range, &n, d, e, &vl, &vu, &il, &iu, &highAccuracy, comm.comm,
-      &nz, &offset, w, 0, &ldz, ZSupport.data() );
+      &nz, &offset, w, 0, &ldz, ZSupport.data(), &params, &stats );
     if( retval != 0 )
         RuntimeError("pmrrr returned ",retval);
+    SetStats( stats, info );
 
     info.numLocalEigenvalues=nz;
     info.firstLocalEigenvalue=offset;
@@ -88,7 +140,8 @@ Info Eig( int n, double* d, double* e, double* w, mpi::Comm comm )
 
 // Compute all of the eigenpairs
 Info Eig
-( int n, double* d, double* e, double* w, double* Z, int ldz, mpi::Comm comm )
+( int n, double* d, double* e, double* w, double* Z, int ldz, mpi::Comm comm,
+  const Ctrl& ctrl )
 {
     EL_DEBUG_CSE
     Info info;
@@ -96,14 +149,17 @@ Info Eig
     char range='A';
     double vl, vu;
     int il, iu;
-    int highAccuracy=0; 
+    int highAccuracy=ctrl.highAccuracy;
     int nz, offset;
     vector<int> ZSupport(2*n);
-    int retval = pmrrr
+    const pmrrr_params_t params = Params( ctrl );
+    pmrrr_stats_t stats;
+    int retval = pmrrr_ctrl
     ( &jobz, &range, &n, d, e, &vl, &vu, &il, &iu, &highAccuracy, comm.comm,
-      &nz, &offset, w, Z, &ldz, ZSupport.data() );
+      &nz, &offset, w, Z, &ldz, ZSupport.data(), &params, &stats );
     if( retval != 0 )
         RuntimeError("pmrrr returned ",retval);
+    SetStats( stats, info );
 
     info.numLocalEigenvalues=nz;
     info.firstLocalEigenvalue=offset;
@@ -114,22 +170,26 @@ Info Eig
 // Compute all of the eigenvalues in (lowerBound,upperBound]
 Info Eig
 ( int n, double* d, double* e, double* w, mpi::Comm comm, 
-  double lowerBound, double upperBound )
+  double lowerBound, double upperBound, const Ctrl& ctrl )
 {
     EL_DEBUG_CSE
     Info info;
     char jobz='N';
     char range='V';
     int il, iu;
-    int highAccuracy=0; 
+    int highAccuracy=ctrl.highAccuracy;
     int nz, offset;
     int ldz=1;
     vector<int> ZSupport(2*n);
-    int retval = pmrrr
+    const pmrrr_params_t params = Params( ctrl );
+    pmrrr_stats_t stats;
+    int retval = pmrrr_ctrl
     ( &jobz, &range, &n, d, e, &lowerBound, &upperBound, &il, &iu, 
-      &highAccuracy, comm.comm, &nz, &offset, w, 0, &ldz, ZSupport.data() );
+      &highAccuracy, comm.comm, &nz, &offset, w, 0, &ldz, ZSupport.data(),
+      &params, &stats );
     if( retval != 0 )
         RuntimeError("pmrrr returned ",retval);
+    SetStats( stats, info );
 
     info.numLocalEigenvalues=nz;
     info.firstLocalEigenvalue=offset;
@@ -140,21 +200,25 @@ Info Eig
 // Compute all of the eigenpairs with eigenvalues in (lowerBound,upperBound]
 Info Eig
 ( int n, double* d, double* e, double* w, double* Z, int ldz, mpi::Comm comm, 
-  double lowerBound, double upperBound )
+  double lowerBound, double upperBound, const Ctrl& ctrl )
 {
     EL_DEBUG_CSE
     Info info;
     char jobz='V';
     char range='V';
     int il, iu;
-    int highAccuracy=0; 
+    int highAccuracy=ctrl.highAccuracy;
     int nz, offset;
     vector<int> ZSupport(2*n);
-    int retval = pmrrr
+    const pmrrr_params_t params = Params( ctrl );
+    pmrrr_stats_t stats;
+    int retval = pmrrr_ctrl
     ( &jobz, &range, &n, d, e, &lowerBound, &upperBound, &il, &iu, 
-      &highAccuracy, comm.comm, &nz, &offset, w, Z, &ldz, ZSupport.data() );
+      &highAccuracy, comm.comm, &nz, &offset, w, Z, &ldz, ZSupport.data(),
+      &params, &stats );
     if( retval != 0 )
         RuntimeError("pmrrr returned ",retval);
+    SetStats( stats, info );
 
     info.numLocalEigenvalues=nz;
     info.firstLocalEigenvalue=offset;
@@ -165,7 +229,7 @@ Info Eig
 // Compute all of the eigenvalues with indices in [lowerBound,upperBound]
 Info Eig
 ( int n, double* d, double* e, double* w, mpi::Comm comm, 
-  int lowerBound, int upperBound )
+  int lowerBound, int upperBound, const Ctrl& ctrl )
 {
     EL_DEBUG_CSE
     Info info;
@@ -174,15 +238,19 @@ Info Eig
     char jobz='N';
     char range='I';
     double vl, vu;
-    int highAccuracy=0; 
+    int highAccuracy=ctrl.highAccuracy;
     int nz, offset;
     int ldz=1;
     vector<int> ZSupport(2*n);
-    int retval = pmrrr
+    const pmrrr_params_t params = Params( ctrl );
+    pmrrr_stats_t stats;
+    int retval = pmrrr_ctrl
     ( &jobz, &range, &n, d, e, &vl, &vu, &lowerBound, &upperBound, 
-      &highAccuracy, comm.comm, &nz, &offset, w, 0, &ldz, ZSupport.data() );
+      &highAccuracy, comm.comm, &nz, &offset, w, 0, &ldz, ZSupport.data(),
+      &params, &stats );
     if( retval != 0 )
         RuntimeError("pmrrr returned ",retval);
+    SetStats( stats, info );
 
     info.numLocalEigenvalues=nz;
     info.firstLocalEigenvalue=offset;
@@ -194,7 +262,7 @@ Info Eig
 // [lowerBound,upperBound]
 Info Eig
 ( int n, double* d, double* e, double* w, double* Z, int ldz, mpi::Comm comm, 
-  int lowerBound, int upperBound )
+  int lowerBound, int upperBound, const Ctrl& ctrl )
 {
     EL_DEBUG_CSE
     Info info;
@@ -203,14 +271,18 @@ Info Eig
     char jobz='V';
     char range='I';
     double vl, vu;
-    int highAccuracy=0; 
+    int highAccuracy=ctrl.highAccuracy;
     int nz, offset;
     vector<int> ZSupport(2*n);
-    int retval = pmrrr
+    const pmrrr_params_t params = Params( ctrl );
+    pmrrr_stats_t stats;
+    int retval = pmrrr_ctrl
     ( &jobz, &range, &n, d, e, &vl, &vu, &lowerBound, &upperBound, 
-      &highAccuracy, comm.comm, &nz, &offset, w, Z, &ldz, ZSupport.data() );
+      &highAccuracy, comm.comm, &nz, &offset, w, Z, &ldz, ZSupport.data(),
+      &params, &stats );
     if( retval != 0 )
         RuntimeError("pmrrr returned ",retval);
+    SetStats( stats, info );
 
     info.numLocalEigenvalues=nz;
     info.firstLocalEigenvalue=offset;
@@ -13,6 +13,11 @@ namespace {
 // A common Mersenne twister configuration
 std::mt19937 generator;
 
+bool counterBased = false;
+unsigned long long counterBasedSeed = 21;
+std::uint32_t counterBasedStream = 0;
+std::uint32_t counterBasedLocalStream = 0;
+
 #ifdef EL_HAVE_MPC
 gmp_randstate_t gmpRandState;
 #endif
@@ -29,6 +34,14 @@ void InitializeRandom( bool deterministic )
 
     ::generator.seed( seed );
 
+    // Every process must agree upon the counter-based key
+    long counterSecs = secs;
+    if( !deterministic )
+        mpi::Broadcast( counterSecs, 0, mpi::COMM_WORLD );
+    ::counterBasedSeed = counterSecs;
+    ::counterBasedStream = 0;
+    ::counterBasedLocalStream = 0;
+
     srand( seed );
 
 #ifdef EL_HAVE_MPC
@@ -49,6 +62,43 @@ void FinalizeRandom()
 std::mt19937& Generator()
 { return ::generator; }
 
+void SetCounterBasedRandom( bool counterBased )
+{ ::counterBased = counterBased; }
+
+bool CounterBasedRandom()
+{ return ::counterBased; }
+
+void SetCounterBasedSeed( unsigned long long seed )
+{
+    ::counterBasedSeed = seed;
+    ::counterBasedStream = 0;
+    ::counterBasedLocalStream = 0;
+}
+
+unsigned long long CounterBasedSeed()
+{ return ::counterBasedSeed; }
+
+unsigned long long CounterBasedLocalSeed()
+{
+    // Offset the key by a multiple of the 64-bit golden ratio so that
+    // process-local fills differ between processes
+    const unsigned long long rank = mpi::Rank( mpi::COMM_WORLD );
+    return ::counterBasedSeed + (rank+1)*0x9E3779B97F4A7C15ULL;
+}
+
+std::uint32_t NextCounterBasedStream()
+{ return ::counterBasedLocalStream++; }
+
+std::uint32_t NextCounterBasedStream( mpi::Comm comm )
+{
+    // A process which skipped a distributed fill (e.g., because it was not
+    // in the grid of a previous matrix) is brought back into agreement
+    const unsigned stream =
+      mpi::AllReduce( unsigned(::counterBasedStream), mpi::MAX, comm );
+    ::counterBasedStream = stream+1;
+    return stream;
+}
+
 #ifdef EL_HAVE_MPC
 namespace mpfr {
 
@@ -0,0 +1,93 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IO_BINARYDIST_HPP
+#define EL_IO_BINARYDIST_HPP
+
+namespace El {
+namespace binary_dist {
+
+// A BINARY_DIST file consists of the following header followed by the
+// entries of the matrix in column-major order. Since the layout of the data
+// does not depend upon the distribution, any distribution can be read back
+// with one collective read per process, and the recorded distribution allows
+// a matrix with the same distribution and grid to reuse the original
+// alignments and block sizes.
+struct Header
+{
+    Int height, width, entrySize;
+    Int colDist, rowDist, wrap;
+    Int gridHeight, gridWidth, gridOrder;
+    Int blockHeight, blockWidth;
+    Int colAlign, rowAlign, colCut, rowCut, root;
+};
+
+template<typename T>
+Header MakeHeader( const Matrix<T>& A )
+{
+    Header header;
+    header.height = A.Height();
+    header.width = A.Width();
+    header.entrySize = sizeof(T);
+    header.colDist = STAR;
+    header.rowDist = STAR;
+    header.wrap = ELEMENT;
+    header.gridHeight = 1;
+    header.gridWidth = 1;
+    header.gridOrder = COLUMN_MAJOR;
+    header.blockHeight = 1;
+    header.blockWidth = 1;
+    header.colAlign = 0;
+    header.rowAlign = 0;
+    header.colCut = 0;
+    header.rowCut = 0;
+    header.root = 0;
+    return header;
+}
+
+template<typename T>
+Header MakeHeader( const AbstractDistMatrix<T>& A )
+{
+    Header header;
+    header.height = A.Height();
+    header.width = A.Width();
+    header.entrySize = sizeof(T);
+    header.colDist = A.ColDist();
+    header.rowDist = A.RowDist();
+    header.wrap = A.Wrap();
+    header.gridHeight = A.Grid().Height();
+    header.gridWidth = A.Grid().Width();
+    header.gridOrder = A.Grid().Order();
+    header.blockHeight = A.BlockHeight();
+    header.blockWidth = A.BlockWidth();
+    header.colAlign = A.ColAlign();
+    header.rowAlign = A.RowAlign();
+    header.colCut = A.ColCut();
+    header.rowCut = A.RowCut();
+    header.root = A.Root();
+    return header;
+}
+
+template<typename T>
+void CheckHeader( const Header& header, Int numBytes )
+{
+    if( header.entrySize != Int(sizeof(T)) )
+        RuntimeError
+        ("Expected entries of ",sizeof(T)," bytes but found ",
+         header.entrySize);
+    const Int numBytesExp =
+      sizeof(Header) + header.height*header.width*header.entrySize;
+    if( numBytes != numBytesExp )
+        RuntimeError
+        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+}
+
+} // namespace binary_dist
+} // namespace El
+
+#endif // ifndef EL_IO_BINARYDIST_HPP
@@ -0,0 +1,136 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#ifdef EL_HAVE_MMAP
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace El {
+
+template<typename T>
+MappedMatrix<T>::MappedMatrix
+( const string filename, Int height, Int width, bool writable )
+: filename_(filename), writable_(writable), numBytes_(height*width*sizeof(T))
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MMAP
+    const int fd =
+      open( filename.c_str(), writable ? O_RDWR|O_CREAT : O_RDONLY, 0644 );
+    if( fd < 0 )
+        RuntimeError("Could not open ",filename);
+    struct stat fileInfo;
+    if( fstat( fd, &fileInfo ) != 0 )
+    {
+        close( fd );
+        RuntimeError("Could not determine the size of ",filename);
+    }
+    const size_t numBytes = fileInfo.st_size;
+    if( writable && numBytes == 0 )
+    {
+        if( ftruncate( fd, numBytes_ ) != 0 )
+        {
+            close( fd );
+            RuntimeError
+            ("Could not extend ",filename," to ",numBytes_," bytes");
+        }
+    }
+    else if( numBytes != numBytes_ )
+    {
+        close( fd );
+        RuntimeError
+        ("Expected file to be ",numBytes_," bytes but found ",numBytes);
+    }
+    if( numBytes_ > 0 )
+    {
+        const int protection = ( writable ? PROT_READ|PROT_WRITE : PROT_READ );
+        void* map = mmap( nullptr, numBytes_, protection, MAP_SHARED, fd, 0 );
+        if( map == MAP_FAILED )
+        {
+            close( fd );
+            RuntimeError("Could not map ",filename);
+        }
+        map_ = map;
+    }
+    // The mapping remains valid after the file is closed
+    close( fd );
+
+    T* buffer = static_cast<T*>(map_);
+    if( writable )
+        A_.Attach( height, width, buffer, Max(height,1) );
+    else
+        A_.LockedAttach( height, width, buffer, Max(height,1) );
+#else
+    A_.Resize( height, width );
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( file.is_open() )
+        Read( A_, filename, BINARY_FLAT );
+    else if( writable )
+        Zeros( A_, height, width );
+    else
+        RuntimeError("Could not open ",filename);
+#endif
+}
+
+template<typename T>
+MappedMatrix<T>::~MappedMatrix()
+{
+#ifdef EL_HAVE_MMAP
+    if( map_ != nullptr )
+        munmap( map_, numBytes_ );
+#else
+    if( writable_ )
+    {
+        try { Flush(); }
+        catch( std::exception& e ) { ReportException(e); }
+    }
+#endif
+}
+
+template<typename T>
+El::Matrix<T>& MappedMatrix<T>::Matrix()
+{
+    EL_DEBUG_CSE
+    if( !writable_ )
+        LogicError("Read-only mappings only provide locked views");
+    return A_;
+}
+
+template<typename T>
+const El::Matrix<T>& MappedMatrix<T>::LockedMatrix() const
+{ return A_; }
+
+template<typename T>
+void MappedMatrix<T>::Flush()
+{
+    EL_DEBUG_CSE
+    if( !writable_ )
+        return;
+#ifdef EL_HAVE_MMAP
+    if( map_ != nullptr && msync( map_, numBytes_, MS_SYNC ) != 0 )
+        RuntimeError("Could not flush ",filename_);
+#else
+    std::ofstream file( filename_.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename_);
+    file.write( (const char*)A_.LockedBuffer(), numBytes_ );
+#endif
+}
+
+#define PROTO(T) template class MappedMatrix<T>;
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -11,6 +11,7 @@
 #include "./Read/Ascii.hpp"
 #include "./Read/AsciiMatlab.hpp"
 #include "./Read/Binary.hpp"
+#include "./Read/BinaryDist.hpp"
 #include "./Read/BinaryFlat.hpp"
 #include "./Read/MatrixMarket.hpp"
 
@@ -37,6 +38,9 @@ void Read( Matrix<T>& A, const string filename, FileFormat format )
     case BINARY_FLAT:
         read::BinaryFlat( A, A.Height(), A.Width(), filename );
         break;
+    case BINARY_DIST:
+        read::BinaryDist( A, filename );
+        break;
     case MATRIX_MARKET:
         read::MatrixMarket( A, filename );
         break;
@@ -48,13 +52,17 @@ void Read( Matrix<T>& A, const string filename, FileFormat format )
 template<typename T>
 void Read
 ( AbstractDistMatrix<T>& A, const string filename, FileFormat format,
-  bool sequential )
+  bool sequential, bool progress )
 {
     EL_DEBUG_CSE
     if( format == AUTO )
         format = DetectFormat( filename );
 
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
+    if( format == BINARY_DIST && !sequential )
+    {
+        read::BinaryDist( A, filename );
+    }
+    else if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
         {
@@ -94,7 +102,7 @@ void Read
             read::BinaryFlat( A, A.Height(), A.Width(), filename );
             break;
         case MATRIX_MARKET:
-            read::MatrixMarket( A, filename );
+            read::MatrixMarket( A, filename, progress );
             break;
         default:
             LogicError("Format unsupported for reading a DistMatrix");
@@ -120,7 +128,9 @@ void Read( SparseMatrix<T>& A, const string filename, FileFormat format )
 }
 
 template<typename T>
-void Read( DistSparseMatrix<T>& A, const string filename, FileFormat format )
+void Read
+( DistSparseMatrix<T>& A, const string filename, FileFormat format,
+  bool progress )
 {
     EL_DEBUG_CSE
     if( format == AUTO )
@@ -129,7 +139,7 @@ void Read( DistSparseMatrix<T>& A, const string filename, FileFormat format )
     switch( format )
     {
     case MATRIX_MARKET:
-        read::MatrixMarket( A, filename );
+        read::MatrixMarket( A, filename, progress );
         break;
     default:
         LogicError("Format unsupported for reading a DistSparseMatrix");
@@ -141,11 +151,12 @@ void Read( DistSparseMatrix<T>& A, const string filename, FileFormat format )
   ( Matrix<T>& A, const string filename, FileFormat format ); \
   template void Read \
   ( AbstractDistMatrix<T>& A, const string filename, \
-    FileFormat format, bool sequential ); \
+    FileFormat format, bool sequential, bool progress ); \
   template void Read \
   ( SparseMatrix<T>& A, const string filename, FileFormat format ); \
   template void Read \
-  ( DistSparseMatrix<T>& A, const string filename, FileFormat format );
+  ( DistSparseMatrix<T>& A, const string filename, FileFormat format, \
+    bool progress );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -0,0 +1,97 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_READ_BINARYDIST_HPP
+#define EL_READ_BINARYDIST_HPP
+
+#include "../BinaryDist.hpp"
+
+namespace El {
+namespace read {
+
+template<typename T>
+inline void
+BinaryDist( Matrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    binary_dist::Header header;
+    file.read( (char*)&header, sizeof(header) );
+    binary_dist::CheckHeader<T>( header, FileSize(file) );
+
+    const Int height = header.height;
+    const Int width = header.width;
+    A.Resize( height, width );
+    if( A.Height() == A.LDim() )
+        file.read( (char*)A.Buffer(), height*width*sizeof(T) );
+    else
+        for( Int j=0; j<width; ++j )
+            file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
+}
+
+// Every process reads its own local entries with a single collective MPI-IO
+// call. If A has the same distribution and grid as the matrix which was
+// written, and its alignments are not constrained, the original alignments
+// (and block sizes) are reused so that each process reads exactly what it
+// wrote.
+template<typename T>
+inline void
+BinaryDist( AbstractDistMatrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+    mpi::File file;
+    mpi::FileOpen( A.Grid().ViewingComm(), filename, false, file );
+
+    binary_dist::Header header;
+    mpi::FileReadAt( file, 0, (byte*)&header, sizeof(header) );
+    binary_dist::CheckHeader<T>( header, mpi::FileSize(file) );
+
+    const Int height = header.height;
+    const Int width = header.width;
+    const bool sameLayout =
+      header.colDist == A.ColDist() &&
+      header.rowDist == A.RowDist() &&
+      header.wrap == A.Wrap() &&
+      header.gridHeight == A.Grid().Height() &&
+      header.gridWidth == A.Grid().Width() &&
+      header.gridOrder == A.Grid().Order();
+    if( sameLayout && A.Wrap() == ELEMENT )
+    {
+        auto& AElem = static_cast<ElementalMatrix<T>&>(A);
+        AElem.AlignAndResize
+        ( header.colAlign, header.rowAlign, height, width, false, false );
+    }
+    else if( sameLayout )
+    {
+        auto& ABlock = static_cast<BlockMatrix<T>&>(A);
+        ABlock.AlignAndResize
+        ( header.blockHeight, header.blockWidth,
+          header.colAlign, header.rowAlign, header.colCut, header.rowCut,
+          height, width, false, false );
+    }
+    else
+        A.Resize( height, width );
+
+    vector<Int> rowInds( A.LocalHeight() ), colInds( A.LocalWidth() );
+    for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+        rowInds[iLoc] = A.GlobalRow(iLoc);
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        colInds[jLoc] = A.GlobalCol(jLoc);
+    mpi::FileReadSubmatrixAll
+    ( file, sizeof(header), sizeof(T), height, rowInds, colInds,
+      (byte*)A.Buffer(), A.LDim() );
+    mpi::FileClose( file );
+}
+
+} // namespace read
+} // namespace El
+
+#endif // ifndef EL_READ_BINARYDIST_HPP
@@ -11,20 +11,22 @@
 
 namespace El {
 namespace read {
+namespace matrix_market {
 
-template<typename T>
-void MatrixMarket( Matrix<T>& A, const string filename )
+// The banner, dimensions, and location of the data section of a Matrix Market
+// file, which every process of a collective read extracts independently
+struct Header
 {
-    EL_DEBUG_CSE
-    typedef Base<T> Real;
-    std::ifstream file( filename.c_str() );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
+    bool isMatrix, isArray, isComplex, isPattern;
+    bool isSymmetric, isSkewSymmetric, isHermitian;
+    Int height, width, numNonzeros;
+    std::streamoff dataBegin, dataEnd;
+};
 
-    // Read the header
-    // ===============
-    // Attempt to pull in the various header components
-    // ------------------------------------------------
+inline Header ReadHeader( std::ifstream& file )
+{
+    EL_DEBUG_CSE
+    Header header;
     string line, stamp, object, format, field, symmetry;
     if( !std::getline( file, line ) )
         RuntimeError("Could not extract header line");
@@ -42,66 +44,289 @@ void MatrixMarket( Matrix<T>& A, const string filename )
         if( !(lineStream >> symmetry) )
             RuntimeError("Missing Matrix Market symmetry");
     }
-    // Ensure that the header components are individually valid
-    // --------------------------------------------------------
-    const bool isMatrix = ( object == string("matrix") );
-    const bool isArray = ( format == string("array") );
-    const bool isComplex = ( field == string("complex") );
-    const bool isPattern = ( field == string("pattern") );
+    header.isMatrix = ( object == string("matrix") );
+    header.isArray = ( format == string("array") );
+    header.isComplex = ( field == string("complex") );
+    header.isPattern = ( field == string("pattern") );
+    header.isSymmetric = ( symmetry == string("symmetric") );
+    header.isSkewSymmetric = ( symmetry == string("skew-symmetric") );
+    header.isHermitian = ( symmetry == string("hermitian") );
     const bool isGeneral = ( symmetry == string("general") );
-    const bool isSymmetric = ( symmetry == string("symmetric") );
-    const bool isSkewSymmetric = ( symmetry == string("skew-symmetric") );
-    const bool isHermitian = ( symmetry == string("hermitian") );
-    if( !isMatrix && object != string("vector") )
+    if( !header.isMatrix && object != string("vector") )
         RuntimeError("Invalid Matrix Market object: ",object);
-    if( !isArray && format != string("coordinate") )
+    if( !header.isArray && format != string("coordinate") )
         RuntimeError("Invalid Matrix Market format: ",format);
-    if( !isComplex && !isPattern &&
+    if( !header.isComplex && !header.isPattern &&
         field != string("real") &&
         field != string("double") &&
         field != string("integer") )
         RuntimeError("Invalid Matrix Market field: ",field);
-    if( !isGeneral && !isSymmetric && !isSkewSymmetric && !isHermitian )
+    if( !isGeneral && !header.isSymmetric && !header.isSkewSymmetric &&
+        !header.isHermitian )
         RuntimeError("Invalid Matrix Market symmetry: ",symmetry);
-    // Ensure that the components are consistent
-    // -----------------------------------------
-    if( isArray && isPattern )
+    if( header.isArray && header.isPattern )
         RuntimeError("Pattern field requires coordinate format");
-    // NOTE: This constraint is only enforced because of the note located at
-    //       http://people.sc.fsu.edu/~jburkardt/data/mm/mm.html
-    if( isSkewSymmetric && isPattern )
+    if( header.isSkewSymmetric && header.isPattern )
         RuntimeError("Pattern field incompatible with skew-symmetry");
-    if( isHermitian && !isComplex )
+    if( header.isHermitian && !header.isComplex )
         RuntimeError("Hermitian symmetry requires complex data");
 
     // Skip the comment lines
-    // ======================
     while( file.peek() == '%' )
         std::getline( file, line );
 
-    int m, n;
     if( !std::getline( file, line ) )
         RuntimeError("Could not extract the size line");
-    if( isArray )
+    std::stringstream lineStream( line );
+    if( !(lineStream >> header.height) )
+        RuntimeError("Missing height: ",line);
+    if( header.isMatrix )
     {
-        // Read in the matrix dimensions
-        // =============================
-        if( isMatrix )
+        if( !(lineStream >> header.width) )
+            RuntimeError("Missing matrix width: ",line);
+    }
+    else
+        header.width = 1;
+    if( header.isArray )
+        header.numNonzeros = header.height*header.width;
+    else if( !(lineStream >> header.numNonzeros) )
+        RuntimeError("Missing nonzeros entry: ",line);
+
+    header.dataBegin = file.tellg();
+    file.seekg( 0, std::ios::end );
+    header.dataEnd = file.tellg();
+    return header;
+}
+
+// Read the lines of the data section which begin within this process's share
+// of its bytes into a buffer, with each newline replaced by a terminator.
+// Since a line belongs to the process whose range contains its first
+// character, a partial line at the start of the range is skipped, and the
+// last line is completed by reading past the end of the range.
+inline void ReadLocalLines
+( std::ifstream& file, const Header& header, mpi::Comm comm,
+  vector<char>& buffer )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const std::streamoff numBytes = header.dataEnd - header.dataBegin;
+    std::streamoff begin = header.dataBegin + (numBytes*commRank)/commSize;
+    const std::streamoff end =
+      header.dataBegin + (numBytes*(commRank+1))/commSize;
+
+    buffer.resize( 0 );
+    file.clear();
+    if( begin > header.dataBegin )
+    {
+        file.seekg( begin-1 );
+        if( file.get() != '\n' )
         {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing matrix height: ",line);
-            if( !(lineStream >> n) )
-                RuntimeError("Missing matrix width: ",line);
+            file.ignore( std::numeric_limits<std::streamsize>::max(), '\n' );
+            begin =
+              ( file.eof() ? header.dataEnd : std::streamoff(file.tellg()) );
         }
-        else
+    }
+    if( begin >= end )
+        return;
+
+    buffer.resize( end-begin );
+    file.clear();
+    file.seekg( begin );
+    if( !file.read( buffer.data(), end-begin ) )
+        RuntimeError("Could not read bytes ",begin," through ",end);
+    if( buffer.back() != '\n' && end < header.dataEnd )
+    {
+        string line;
+        std::getline( file, line );
+        buffer.insert( buffer.end(), line.begin(), line.end() );
+    }
+    buffer.push_back( '\n' );
+    for( auto& c : buffer )
+        if( c == '\n' )
+            c = '\0';
+}
+
+inline Int ParseIndex( char*& ptr )
+{
+    char* next;
+    const long long index = std::strtoll( ptr, &next, 10 );
+    if( next == ptr )
+        RuntimeError("Could not extract index from: ",ptr);
+    ptr = next;
+    return Int(index);
+}
+
+template<typename Real>
+void ParseReal( char*& ptr, Real& value )
+{
+    while( std::isspace(*ptr) )
+        ++ptr;
+    char* tokenEnd = ptr;
+    while( *tokenEnd != '\0' && !std::isspace(*tokenEnd) )
+        ++tokenEnd;
+    std::stringstream tokenStream( string(ptr,tokenEnd) );
+    if( !(tokenStream >> value) )
+        RuntimeError("Could not extract value from: ",ptr);
+    ptr = tokenEnd;
+}
+
+inline void ParseReal( char*& ptr, float& value )
+{
+    char* next;
+    value = std::strtof( ptr, &next );
+    if( next == ptr )
+        RuntimeError("Could not extract value from: ",ptr);
+    ptr = next;
+}
+
+inline void ParseReal( char*& ptr, double& value )
+{
+    char* next;
+    value = std::strtod( ptr, &next );
+    if( next == ptr )
+        RuntimeError("Could not extract value from: ",ptr);
+    ptr = next;
+}
+
+template<typename T>
+T ParseValue( char*& ptr, const Header& header )
+{
+    typedef Base<T> Real;
+    if( header.isPattern )
+        return T(1);
+    Real realPart;
+    ParseReal( ptr, realPart );
+    if( !header.isComplex )
+        return T(realPart);
+    Real imagPart;
+    ParseReal( ptr, imagPart );
+    T value;
+    SetRealPart( value, realPart );
+    SetImagPart( value, imagPart );
+    return value;
+}
+
+// Call 'process' on each nonblank line of a buffer produced by ReadLocalLines
+template<typename Function>
+void ForEachLine( vector<char>& buffer, Function process )
+{
+    char* ptr = buffer.data();
+    char* bufferEnd = ptr + buffer.size();
+    while( ptr < bufferEnd )
+    {
+        char* lineEnd = ptr + std::strlen(ptr);
+        char* first = ptr;
+        while( std::isspace(*first) )
+            ++first;
+        if( *first != '\0' && *first != '%' )
+            process( first );
+        ptr = lineEnd + 1;
+    }
+}
+
+// Parse the local coordinate-format entries and pass them to 'update'
+template<typename T,typename Function>
+Int ParseCoordinates
+( vector<char>& buffer, const Header& header, Function update )
+{
+    EL_DEBUG_CSE
+    Int numLocalEntries = 0;
+    ForEachLine
+    ( buffer,
+      [&]( char* ptr )
+      {
+          const Int i = ParseIndex( ptr ) - 1;
+          const Int j = ( header.isMatrix ? ParseIndex( ptr ) - 1 : 0 );
+          if( i < 0 || i >= header.height || j < 0 || j >= header.width )
+              RuntimeError
+              ("Entry (",i,",",j,") was out of bounds of a ",
+               header.height," x ",header.width," matrix");
+          update( i, j, ParseValue<T>( ptr, header ) );
+          ++numLocalEntries;
+      } );
+    return numLocalEntries;
+}
+
+// Print the per-process throughput of a collective read
+inline void ReportThroughput
+( mpi::Comm comm, double numBytes, double parseTime, double routeTime )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const double localStats[3] = { numBytes, parseTime, routeTime };
+    vector<double> stats( commRank == 0 ? 3*commSize : 0 );
+    mpi::Gather( localStats, 3, stats.data(), 3, 0, comm );
+    if( commRank == 0 )
+    {
+        double totalBytes = 0, maxTime = 0;
+        for( int q=0; q<commSize; ++q )
         {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing vector height: ",line);
-            n = 1;
+            const double megabytes = stats[3*q]/1.e6;
+            const double time = stats[3*q+1] + stats[3*q+2];
+            Output
+            ("  rank ",q,": parsed ",megabytes," MB in ",stats[3*q+1],
+             " s (",megabytes/stats[3*q+1]," MB/s), routed in ",
+             stats[3*q+2]," s");
+            totalBytes += stats[3*q];
+            maxTime = Max( maxTime, time );
         }
+        Output
+        ("  read ",totalBytes/1.e6," MB in ",maxTime," s (",
+         totalBytes/1.e6/maxTime," MB/s aggregate)");
+    }
+}
+
+// Run the purely local phase of a collective read. Since the entries are
+// routed collectively afterwards, an error on any one process must be raised
+// on all of them rather than leaving the others waiting for it.
+template<typename Function>
+void LocalPhase( mpi::Comm comm, const string& filename, Function phase )
+{
+    EL_DEBUG_CSE
+    bool failed = false;
+    string message;
+    try { phase(); }
+    catch( std::exception& e )
+    {
+        failed = true;
+        message = e.what();
+    }
+    if( mpi::AllReduce( int(failed), mpi::MAX, comm ) )
+    {
+        if( failed )
+            RuntimeError(message);
+        RuntimeError("Another process could not read ",filename);
+    }
+}
 
+} // namespace matrix_market
+
+template<typename T>
+void MatrixMarket( Matrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+    typedef Base<T> Real;
+    std::ifstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    const auto header = matrix_market::ReadHeader( file );
+    const bool isArray = header.isArray;
+    const bool isComplex = header.isComplex;
+    const bool isPattern = header.isPattern;
+    const bool isMatrix = header.isMatrix;
+    const bool isSymmetric = header.isSymmetric;
+    const bool isSkewSymmetric = header.isSkewSymmetric;
+    const bool isHermitian = header.isHermitian;
+    const Int m = header.height;
+    const Int n = header.width;
+    file.clear();
+    file.seekg( header.dataBegin );
+
+    string line;
+    if( isArray )
+    {
         // Resize the matrix
         // =================
         Zeros( A, m, n );
@@ -132,29 +357,6 @@ void MatrixMarket( Matrix<T>& A, const string filename )
     }
     else
     {
-        // Read in the matrix dimensions and number of nonzeros
-        // ====================================================
-        int numNonzero;
-        if( isMatrix )
-        {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing matrix height: ",line);
-            if( !(lineStream >> n) )
-                RuntimeError("Missing matrix width: ",line);
-            if( !(lineStream >> numNonzero) )
-                RuntimeError("Missing nonzeros entry: ",line);
-        }
-        else
-        {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing vector height: ",line);
-            n = 1;
-            if( !(lineStream >> numNonzero) )
-                RuntimeError("Missing nonzeros entry: ",line);
-        }
-
         // Create a matrix of zeros
         // ========================
         Zeros( A, m, n );
@@ -163,7 +365,7 @@ void MatrixMarket( Matrix<T>& A, const string filename )
         // ===========================
         int i, j;
         Real realPart, imagPart;
-        for( Int k=0; k<numNonzero; ++k )
+        for( Int k=0; k<header.numNonzeros; ++k )
         {
             if( !std::getline( file, line ) )
                 RuntimeError("Could not get nonzero ",k);
@@ -216,20 +418,101 @@ void MatrixMarket( Matrix<T>& A, const string filename )
     }
 }
 
+// Every process parses the entries of its own share of the bytes of the file
+// and queues them for their owners. Since an AbstractDistMatrix cannot be
+// symmetrized in place, the strictly lower entries of symmetric, Hermitian,
+// and skew-symmetric matrices are queued along with their reflections.
 template<typename T>
-void MatrixMarket( AbstractDistMatrix<T>& A, const string filename )
+void MatrixMarket
+( AbstractDistMatrix<T>& A, const string filename, bool progress=false )
 {
     EL_DEBUG_CSE
-    // TODO: Use a WriteProxy instead
-    DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A.Grid() );
-    if( A_CIRC_CIRC.CrossRank() == A_CIRC_CIRC.Root() )
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    const auto header = matrix_market::ReadHeader( file );
+    const bool isStructured =
+      header.isSymmetric || header.isHermitian || header.isSkewSymmetric;
+    if( isStructured && header.height != header.width )
+        LogicError("Cannot make non-square matrix symmetric");
+    mpi::Comm comm = A.Grid().ViewingComm();
+
+    Zeros( A, header.height, header.width );
+
+    // I'm not certain of what the MM standard is for complex skew-symmetry,
+    // so I'll default to assuming no conjugation
+    auto queueUpdate = [&]( Int i, Int j, const T& value )
+      {
+        if( !isStructured )
+            A.QueueUpdate( i, j, value );
+        else if( i == j )
+            A.QueueUpdate
+            ( i, j, header.isHermitian ? T(RealPart(value)) : value );
+        else if( i > j )
+        {
+            A.QueueUpdate( i, j, value );
+            if( header.isHermitian )
+                A.QueueUpdate( j, i, Conj(value) );
+            else if( header.isSkewSymmetric )
+                A.QueueUpdate( j, i, -value );
+            else
+                A.QueueUpdate( j, i, value );
+        }
+      };
+
+    Timer timer;
+    timer.Start();
+    vector<char> buffer;
+    vector<T> values;
+    Int numLocalEntries = 0;
+    matrix_market::LocalPhase
+    ( comm, filename,
+      [&]()
+      {
+        matrix_market::ReadLocalLines( file, header, comm, buffer );
+        if( header.isArray )
+        {
+            matrix_market::ForEachLine
+            ( buffer,
+              [&]( char* ptr )
+              { values.push_back
+                ( matrix_market::ParseValue<T>( ptr, header ) ); } );
+            numLocalEntries = values.size();
+        }
+        else
+        {
+            A.Reserve( header.numNonzeros/mpi::Size(comm) );
+            numLocalEntries =
+              matrix_market::ParseCoordinates<T>( buffer, header, queueUpdate );
+        }
+      } );
+    if( header.isArray )
     {
-        MatrixMarket( A_CIRC_CIRC.Matrix(), filename );
-        A_CIRC_CIRC.Resize
-        ( A_CIRC_CIRC.Matrix().Height(), A_CIRC_CIRC.Matrix().Width() );
+        // The entries are stored in column-major order, one per line, so
+        // their indices follow from the number of lines on earlier processes
+        if( mpi::AllReduce( numLocalEntries, comm ) > header.numNonzeros )
+            RuntimeError("Too many entries in ",filename);
+        const Int offset = mpi::Scan( numLocalEntries, comm ) - numLocalEntries;
+        A.Reserve( numLocalEntries );
+        for( Int k=0; k<numLocalEntries; ++k )
+        {
+            const Int index = offset + k;
+            queueUpdate
+            ( index % header.height, index / header.height, values[k] );
+        }
+        SwapClear( values );
     }
-    A_CIRC_CIRC.MakeSizeConsistent();
-    Copy( A_CIRC_CIRC, A );
+    const double numBytes = buffer.size();
+    SwapClear( buffer );
+    const double parseTime = timer.Stop();
+
+    timer.Start();
+    A.ProcessQueues();
+    const double routeTime = timer.Stop();
+    if( mpi::AllReduce( numLocalEntries, comm ) != header.numNonzeros )
+        RuntimeError("Expected ",header.numNonzeros," entries in ",filename);
+    if( progress )
+        matrix_market::ReportThroughput( comm, numBytes, parseTime, routeTime );
 }
 
 template<typename T>
@@ -240,97 +523,24 @@ void MatrixMarket( SparseMatrix<T>& A, const string filename )
     std::ifstream file( filename.c_str() );
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
-
-    // Read the header
-    // ===============
-    // Attempt to pull in the various header components
-    // ------------------------------------------------
-    string line, stamp, object, format, field, symmetry;
-    if( !std::getline( file, line ) )
-        RuntimeError("Could not extract header line");
-    {
-        std::stringstream lineStream( line );
-        lineStream >> stamp;
-        if( stamp != string("%%MatrixMarket") )
-            RuntimeError("Invalid Matrix Market stamp: ",stamp);
-        if( !(lineStream >> object) )
-            RuntimeError("Missing Matrix Market object");
-        if( !(lineStream >> format) )
-            RuntimeError("Missing Matrix Market format");
-        if( !(lineStream >> field) )
-            RuntimeError("Missing Matrix Market field");
-        if( !(lineStream >> symmetry) )
-            RuntimeError("Missing Matrix Market symmetry");
-    }
-    // Ensure that the header components are individually valid
-    // --------------------------------------------------------
-    const bool isMatrix = ( object == string("matrix") );
-    const bool isArray = ( format == string("array") );
-    const bool isComplex = ( field == string("complex") );
-    const bool isPattern = ( field == string("pattern") );
-    const bool isGeneral = ( symmetry == string("general") );
-    const bool isSymmetric = ( symmetry == string("symmetric") );
-    const bool isSkewSymmetric = ( symmetry == string("skew-symmetric") );
-    const bool isHermitian = ( symmetry == string("hermitian") );
-    if( !isMatrix && object != string("vector") )
-        RuntimeError("Invalid Matrix Market object: ",object);
-    if( !isArray && format != string("coordinate") )
-        RuntimeError("Invalid Matrix Market format: ",format);
-    if( !isComplex && !isPattern &&
-        field != string("real") &&
-        field != string("double") &&
-        field != string("integer") )
-        RuntimeError("Invalid Matrix Market field: ",field);
-    if( !isGeneral && !isSymmetric && !isSkewSymmetric && !isHermitian )
-        RuntimeError("Invalid Matrix Market symmetry: ",symmetry);
-    // Ensure that the components are consistent
-    // -----------------------------------------
-    if( isArray && isPattern )
-        RuntimeError("Pattern field requires coordinate format");
-    // NOTE: This constraint is only enforced because of the note located at
-    //       http://people.sc.fsu.edu/~jburkardt/data/mm/mm.html
-    if( isSkewSymmetric && isPattern )
-        RuntimeError("Pattern field incompatible with skew-symmetry");
-    if( isHermitian && !isComplex )
-        RuntimeError("Hermitian symmetry requires complex data");
-
-    if( isArray )
+    const auto header = matrix_market::ReadHeader( file );
+    if( header.isArray )
     {
         LogicError
         ("Attempted to load dense MatrixMarket format into SparseMatrix");
     }
-
-    // Skip the comment lines
-    // ======================
-    while( file.peek() == '%' )
-        std::getline( file, line );
-
-    int m, n;
-    if( !std::getline( file, line ) )
-        RuntimeError("Could not extract the size line");
-
-    // Read in the matrix dimensions and number of nonzeros
-    // ====================================================
-    int numNonzero;
-    if( isMatrix )
-    {
-        std::stringstream lineStream( line );
-        if( !(lineStream >> m) )
-            RuntimeError("Missing matrix height: ",line);
-        if( !(lineStream >> n) )
-            RuntimeError("Missing matrix width: ",line);
-        if( !(lineStream >> numNonzero) )
-            RuntimeError("Missing nonzeros entry: ",line);
-    }
-    else
-    {
-        std::stringstream lineStream( line );
-        if( !(lineStream >> m) )
-            RuntimeError("Missing vector height: ",line);
-        n = 1;
-        if( !(lineStream >> numNonzero) )
-            RuntimeError("Missing nonzeros entry: ",line);
-    }
+    const bool isComplex = header.isComplex;
+    const bool isPattern = header.isPattern;
+    const bool isMatrix = header.isMatrix;
+    const bool isSymmetric = header.isSymmetric;
+    const bool isSkewSymmetric = header.isSkewSymmetric;
+    const bool isHermitian = header.isHermitian;
+    const Int m = header.height;
+    const Int n = header.width;
+    const Int numNonzero = header.numNonzeros;
+    file.clear();
+    file.seekg( header.dataBegin );
+    string line;
 
     // Create a matrix of zeros
     // ========================
@@ -403,170 +613,60 @@ void MatrixMarket( SparseMatrix<T>& A, const string filename )
     }
 }
 
+// Every process parses the entries of its own share of the bytes of the file
+// and queues them for the owners of their rows.
 template<typename T>
-void MatrixMarket( DistSparseMatrix<T>& A, const string filename )
+void MatrixMarket
+( DistSparseMatrix<T>& A, const string filename, bool progress=false )
 {
     EL_DEBUG_CSE
-    typedef Base<T> Real;
-    std::ifstream file( filename.c_str() );
+    std::ifstream file( filename.c_str(), std::ios::binary );
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
-
-    // Read the header
-    // ===============
-    // Attempt to pull in the various header components
-    // ------------------------------------------------
-    string line, stamp, object, format, field, symmetry;
-    if( !std::getline( file, line ) )
-        RuntimeError("Could not extract header line");
-    {
-        std::stringstream lineStream( line );
-        lineStream >> stamp;
-        if( stamp != string("%%MatrixMarket") )
-            RuntimeError("Invalid Matrix Market stamp: ",stamp);
-        if( !(lineStream >> object) )
-            RuntimeError("Missing Matrix Market object");
-        if( !(lineStream >> format) )
-            RuntimeError("Missing Matrix Market format");
-        if( !(lineStream >> field) )
-            RuntimeError("Missing Matrix Market field");
-        if( !(lineStream >> symmetry) )
-            RuntimeError("Missing Matrix Market symmetry");
-    }
-    // Ensure that the header components are individually valid
-    // --------------------------------------------------------
-    const bool isMatrix = ( object == string("matrix") );
-    const bool isArray = ( format == string("array") );
-    const bool isComplex = ( field == string("complex") );
-    const bool isPattern = ( field == string("pattern") );
-    const bool isGeneral = ( symmetry == string("general") );
-    const bool isSymmetric = ( symmetry == string("symmetric") );
-    const bool isSkewSymmetric = ( symmetry == string("skew-symmetric") );
-    const bool isHermitian = ( symmetry == string("hermitian") );
-    if( !isMatrix && object != string("vector") )
-        RuntimeError("Invalid Matrix Market object: ",object);
-    if( !isArray && format != string("coordinate") )
-        RuntimeError("Invalid Matrix Market format: ",format);
-    if( !isComplex && !isPattern &&
-        field != string("real") &&
-        field != string("double") &&
-        field != string("integer") )
-        RuntimeError("Invalid Matrix Market field: ",field);
-    if( !isGeneral && !isSymmetric && !isSkewSymmetric && !isHermitian )
-        RuntimeError("Invalid Matrix Market symmetry: ",symmetry);
-    // Ensure that the components are consistent
-    // -----------------------------------------
-    if( isArray && isPattern )
-        RuntimeError("Pattern field requires coordinate format");
-    // NOTE: This constraint is only enforced because of the note located at
-    //       http://people.sc.fsu.edu/~jburkardt/data/mm/mm.html
-    if( isSkewSymmetric && isPattern )
-        RuntimeError("Pattern field incompatible with skew-symmetry");
-    if( isHermitian && !isComplex )
-        RuntimeError("Hermitian symmetry requires complex data");
-
-    if( isArray )
+    const auto header = matrix_market::ReadHeader( file );
+    if( header.isArray )
     {
         LogicError
         ("Attempted to load dense MatrixMarket format into SparseMatrix");
     }
+    mpi::Comm comm = A.Grid().Comm();
+
+    Zeros( A, header.height, header.width );
+
+    Timer timer;
+    timer.Start();
+    vector<char> buffer;
+    Int numLocalEntries = 0;
+    matrix_market::LocalPhase
+    ( comm, filename,
+      [&]()
+      {
+        matrix_market::ReadLocalLines( file, header, comm, buffer );
+        // Assume an even nonzero distribution
+        const Int numLocalEstimate = header.numNonzeros/mpi::Size(comm);
+        A.Reserve( numLocalEstimate, numLocalEstimate );
+        numLocalEntries = matrix_market::ParseCoordinates<T>
+        ( buffer, header,
+          [&]( Int i, Int j, const T& value )
+          { A.QueueUpdate( i, j, value ); } );
+      } );
+    const double numBytes = buffer.size();
+    SwapClear( buffer );
+    const double parseTime = timer.Stop();
+
+    timer.Start();
+    A.ProcessQueues();
+    const double routeTime = timer.Stop();
+    if( mpi::AllReduce( numLocalEntries, comm ) != header.numNonzeros )
+        RuntimeError("Expected ",header.numNonzeros," entries in ",filename);
+    if( progress )
+        matrix_market::ReportThroughput( comm, numBytes, parseTime, routeTime );
 
-    // Skip the comment lines
-    // ======================
-    while( file.peek() == '%' )
-        std::getline( file, line );
-
-    int m, n;
-    if( !std::getline( file, line ) )
-        RuntimeError("Could not extract the size line");
-
-    // Read in the matrix dimensions and number of nonzeros
-    // ====================================================
-    int numNonzero;
-    if( isMatrix )
-    {
-        std::stringstream lineStream( line );
-        if( !(lineStream >> m) )
-            RuntimeError("Missing matrix height: ",line);
-        if( !(lineStream >> n) )
-            RuntimeError("Missing matrix width: ",line);
-        if( !(lineStream >> numNonzero) )
-            RuntimeError("Missing nonzeros entry: ",line);
-    }
-    else
-    {
-        std::stringstream lineStream( line );
-        if( !(lineStream >> m) )
-            RuntimeError("Missing vector height: ",line);
-        n = 1;
-        if( !(lineStream >> numNonzero) )
-            RuntimeError("Missing nonzeros entry: ",line);
-    }
-
-    // Create a matrix of zeros
-    // ========================
-    Zeros( A, m, n );
-
-    // Fill in the local nonzero entries by passively calling QueueUpdate
-    // ==================================================================
-    int i, j;
-    Real realPart, imagPart;
-    T value;
-    const int commSize = A.Grid().Size();
-    A.Reserve( numNonzero/commSize ); // Assume an even nonzero distribution
-    bool passive = true;
-    for( Int k=0; k<numNonzero; ++k )
-    {
-        if( !std::getline( file, line ) )
-            RuntimeError("Could not get nonzero ",k);
-        std::stringstream lineStream( line );
-        if( !(lineStream >> i) )
-            RuntimeError("Could not extract row coordinate of nonzero ",k);
-        --i; // convert from Fortran to C indexing
-        if( isMatrix )
-        {
-            if( !(lineStream >> j) )
-                RuntimeError
-                ("Could not extract col coordinate of nonzero ",k);
-            --j;
-        }
-        else
-            j = 0;
-
-        if( isPattern )
-        {
-            A.QueueUpdate( i, j, T(1), passive );
-        }
-        else
-        {
-            if( isComplex )
-            {
-                if( !(lineStream >> realPart) )
-                    RuntimeError
-                    ("Could not extract real part of entry (",i,",",j,")");
-                if( !(lineStream >> imagPart) )
-                    RuntimeError
-                    ("Could not extract imag part of entry (",i,",",j,")");
-                SetRealPart( value, realPart );
-                SetImagPart( value, imagPart );
-                A.QueueUpdate( i, j, value, passive );
-            }
-            else
-            {
-                if( !(lineStream >> realPart) )
-                    RuntimeError
-                    ("Could not extract real entry (",i,",",j,")");
-                A.QueueUpdate( i, j, T(realPart), passive );
-            }
-        }
-    }
-    A.ProcessLocalQueues();
-
-    if( isSymmetric )
+    if( header.isSymmetric )
     {
         MakeSymmetric( LOWER, A );
     }
-    if( isHermitian )
+    if( header.isHermitian )
     {
         MakeHermitian( LOWER, A );
     }
@@ -574,7 +674,7 @@ void MatrixMarket( DistSparseMatrix<T>& A, const string filename )
     // I'm not certain of what the MM standard is for complex skew-symmetry,
     // so I'll default to assuming no conjugation
     const bool conjugateSkew = false;
-    if( isSkewSymmetric )
+    if( header.isSkewSymmetric )
     {
         MakeSymmetric( LOWER, A, conjugateSkew );
         ScaleTrapezoid( T(-1), UPPER, A, 1 );
@@ -11,6 +11,7 @@
 #include "./Write/Ascii.hpp"
 #include "./Write/AsciiMatlab.hpp"
 #include "./Write/Binary.hpp"
+#include "./Write/BinaryDist.hpp"
 #include "./Write/BinaryFlat.hpp"
 #include "./Write/Image.hpp"
 #include "./Write/MatrixMarket.hpp"
@@ -29,6 +30,7 @@ void Write
     case ASCII_MATLAB:  write::AsciiMatlab( A, basename, title ); break;
     case BINARY:        write::Binary( A, basename );             break;
     case BINARY_FLAT:   write::BinaryFlat( A, basename );         break;
+    case BINARY_DIST:   write::BinaryDist( A, basename );         break;
     case MATRIX_MARKET: write::MatrixMarket( A, basename );       break;
     case BMP:
     case JPG:
@@ -49,7 +51,11 @@ void Write
   string basename, FileFormat format, string title )
 {
     EL_DEBUG_CSE
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
+    if( format == BINARY_DIST )
+    {
+        write::BinaryDist( A, basename );
+    }
+    else if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
             Write( A.LockedMatrix(), basename, format, title );
@@ -0,0 +1,71 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_WRITE_BINARYDIST_HPP
+#define EL_WRITE_BINARYDIST_HPP
+
+#include "../BinaryDist.hpp"
+
+namespace El {
+namespace write {
+
+template<typename T>
+inline void
+BinaryDist( const Matrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    string filename = basename + "." + FileExtension(BINARY_DIST);
+    ofstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    const binary_dist::Header header = binary_dist::MakeHeader( A );
+    file.write( (char*)&header, sizeof(header) );
+    if( A.Height() == A.LDim() )
+        file.write( (char*)A.LockedBuffer(), A.Height()*A.Width()*sizeof(T) );
+    else
+        for( Int j=0; j<A.Width(); ++j )
+            file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
+}
+
+// Every process which owns the first copy of its local entries writes them
+// with a single collective MPI-IO call
+template<typename T>
+inline void
+BinaryDist( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    string filename = basename + "." + FileExtension(BINARY_DIST);
+    mpi::Comm comm = A.Grid().ViewingComm();
+    mpi::File file;
+    mpi::FileOpen( comm, filename, true, file );
+
+    const binary_dist::Header header = binary_dist::MakeHeader( A );
+    if( mpi::Rank(comm) == 0 )
+        mpi::FileWriteAt( file, 0, (const byte*)&header, sizeof(header) );
+
+    vector<Int> rowInds, colInds;
+    if( A.RedundantRank() == 0 && A.CrossRank() == A.Root() )
+    {
+        rowInds.resize( A.LocalHeight() );
+        colInds.resize( A.LocalWidth() );
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            rowInds[iLoc] = A.GlobalRow(iLoc);
+        for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+            colInds[jLoc] = A.GlobalCol(jLoc);
+    }
+    mpi::FileWriteSubmatrixAll
+    ( file, sizeof(header), sizeof(T), A.Height(), rowInds, colInds,
+      (const byte*)A.LockedBuffer(), A.LDim() );
+    mpi::FileClose( file );
+}
+
+} // namespace write
+} // namespace El
+
+#endif // ifndef EL_WRITE_BINARYDIST_HPP
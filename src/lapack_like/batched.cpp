@@ -0,0 +1,459 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "./batched/Interleaved.hpp"
+#include "./batched/Kernels.hpp"
+
+namespace El {
+namespace batched {
+
+template<typename T>
+void Gemm
+( Orientation orientA,
+  Orientation orientB,
+  Int m,
+  Int n,
+  Int numSum,
+  T alpha,
+  const BatchView<T>& A,
+  const BatchView<T>& B,
+  T beta,
+  const BatchView<T>& C,
+  Int batchSize )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      CheckBatch( A, orientA == NORMAL ? m : numSum, "A" );
+      CheckBatch( B, orientB == NORMAL ? numSum : n, "B" );
+      CheckBatch( C, m, "C" );
+    )
+    auto groupKernel =
+      [&]( Int offset, Int numActive )
+      {
+          Interleaved<T> APack( m, numSum ), BPack( numSum, n ), CPack( m, n );
+          Pack( orientA, A, offset, numActive, APack );
+          Pack( orientB, B, offset, numActive, BPack );
+          if( beta != T(0) )
+              Pack( NORMAL, C, offset, numActive, CPack );
+          kernel::Gemm( alpha, APack, BPack, beta, CPack );
+          Unpack( NORMAL, CPack, C, offset, numActive );
+          return Int(-1);
+      };
+    ForEachGroup<T>( batchSize, groupKernel );
+}
+
+template<typename T>
+void Trsm
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  Int m,
+  Int n,
+  T alpha,
+  const BatchView<T>& A,
+  const BatchView<T>& B,
+  Int batchSize )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      CheckBatch( A, side == LEFT ? m : n, "A" );
+      CheckBatch( B, m, "B" );
+    )
+    // Reduce to solving against a packed triangle from the left:
+    //   op(A) X = alpha B           (side=LEFT),
+    //   A^T X^T = alpha B^T         (side=RIGHT, orientation=NORMAL),
+    //   A X^T = alpha B^T           (side=RIGHT, orientation=TRANSPOSE),
+    //   A X^H = conj(alpha) B^H     (side=RIGHT, orientation=ADJOINT).
+    Orientation AOrient, BOrient;
+    T packedAlpha = alpha;
+    if( side == LEFT )
+    {
+        AOrient = orientation;
+        BOrient = NORMAL;
+    }
+    else if( orientation == NORMAL )
+    {
+        AOrient = TRANSPOSE;
+        BOrient = TRANSPOSE;
+    }
+    else if( orientation == TRANSPOSE )
+    {
+        AOrient = NORMAL;
+        BOrient = TRANSPOSE;
+    }
+    else
+    {
+        AOrient = NORMAL;
+        BOrient = ADJOINT;
+        packedAlpha = Conj(alpha);
+    }
+    const UpperOrLower packedUplo =
+      ( AOrient == NORMAL ? uplo : (uplo == LOWER ? UPPER : LOWER) );
+    const Int order = ( side == LEFT ? m : n );
+    const Int BPackHeight = ( BOrient == NORMAL ? m : n );
+    const Int BPackWidth = ( BOrient == NORMAL ? n : m );
+
+    auto groupKernel =
+      [&]( Int offset, Int numActive )
+      {
+          Interleaved<T> APack( order, order ),
+                         BPack( BPackHeight, BPackWidth );
+          Pack( packedUplo, AOrient, A, offset, numActive, APack );
+          Pack( BOrient, B, offset, numActive, BPack );
+          kernel::Scale( packedAlpha, BPack );
+          kernel::TriangularSolve( packedUplo, diag, order, APack, BPack );
+          Unpack( BOrient, BPack, B, offset, numActive );
+          return Int(-1);
+      };
+    ForEachGroup<T>( batchSize, groupKernel );
+}
+
+template<typename Field>
+void Cholesky
+( UpperOrLower uplo,
+  Int n,
+  const BatchView<Field>& A,
+  Int batchSize )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(CheckBatch( A, n, "A" ))
+    // A = U^H U is factored as A^H = L L^H with L = U^H
+    const Orientation orientation = ( uplo == LOWER ? NORMAL : ADJOINT );
+    auto groupKernel =
+      [&]( Int offset, Int numActive )
+      {
+          Interleaved<Field> APack( n, n );
+          Pack( LOWER, orientation, A, offset, numActive, APack );
+          const Int failure = kernel::Cholesky( numActive, APack );
+          Unpack( LOWER, orientation, APack, A, offset, numActive );
+          return ( failure >= 0 ? offset+failure : Int(-1) );
+      };
+    const Int failure = ForEachGroup<Field>( batchSize, groupKernel );
+    if( failure >= 0 )
+    {
+        const string msg = BuildString("Batch member ",failure," was not HPD");
+        throw NonHPDMatrixException( msg.c_str() );
+    }
+}
+
+template<typename Field>
+void LU
+( Int m,
+  Int n,
+  const BatchView<Field>& A,
+  const BatchView<Int>& p,
+  Int batchSize )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(CheckBatch( A, m, "A" ))
+    const Int W = GroupSize<Field>();
+    const Int minDim = Min(m,n);
+    auto groupKernel =
+      [&]( Int offset, Int numActive )
+      {
+          Interleaved<Field> APack( m, n );
+          vector<Int> pivots;
+          Pack( NORMAL, A, offset, numActive, APack );
+          const Int failure = kernel::LU( numActive, APack, pivots );
+          Unpack( NORMAL, APack, A, offset, numActive );
+          for( Int l=0; l<numActive; ++l )
+          {
+              Int* pBuf = p.Member( offset+l );
+              for( Int j=0; j<minDim; ++j )
+                  pBuf[j] = pivots[j*W+l];
+          }
+          return ( failure >= 0 ? offset+failure : Int(-1) );
+      };
+    const Int failure = ForEachGroup<Field>( batchSize, groupKernel );
+    if( failure >= 0 )
+    {
+        const string msg = BuildString("Batch member ",failure," was singular");
+        throw SingularMatrixException( msg.c_str() );
+    }
+}
+
+template<typename Field>
+void QR
+( Int m,
+  Int n,
+  const BatchView<Field>& A,
+  const BatchView<Field>& householderScalars,
+  Int batchSize )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(CheckBatch( A, m, "A" ))
+    const Int W = GroupSize<Field>();
+    const Int minDim = Min(m,n);
+    auto groupKernel =
+      [&]( Int offset, Int numActive )
+      {
+          Interleaved<Field> APack( m, n );
+          vector<Field> tau;
+          Pack( NORMAL, A, offset, numActive, APack );
+          kernel::QR( APack, tau );
+          Unpack( NORMAL, APack, A, offset, numActive );
+          for( Int l=0; l<numActive; ++l )
+          {
+              Field* tBuf = householderScalars.Member( offset+l );
+              for( Int j=0; j<minDim; ++j )
+                  tBuf[j] = tau[j*W+l];
+          }
+          return Int(-1);
+      };
+    ForEachGroup<Field>( batchSize, groupKernel );
+}
+
+namespace cholesky {
+
+template<typename Field>
+void SolveAfter
+( UpperOrLower uplo,
+  Orientation orientation,
+  Int n,
+  Int numRHS,
+  const BatchView<Field>& A,
+  const BatchView<Field>& B,
+  Int batchSize )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      CheckBatch( A, n, "A" );
+      CheckBatch( B, n, "B" );
+    )
+    // Since A is Hermitian, only A^T X = B differs from A X = B, and it is
+    // equivalent to A conj(X) = conj(B)
+    const bool conjugate = ( orientation == TRANSPOSE );
+    const Orientation LOrient = ( uplo == LOWER ? NORMAL : ADJOINT );
+    const Orientation LAdjOrient = ( uplo == LOWER ? ADJOINT : NORMAL );
+    auto groupKernel =
+      [&]( Int offset, Int numActive )
+      {
+          Interleaved<Field> LPack( n, n ), LAdjPack( n, n ),
+                             BPack( n, numRHS );
+          Pack( LOWER, LOrient, A, offset, numActive, LPack );
+          Pack( UPPER, LAdjOrient, A, offset, numActive, LAdjPack );
+          Pack( NORMAL, B, offset, numActive, BPack );
+          if( conjugate )
+              Conjugate( BPack );
+          kernel::TriangularSolve( LOWER, NON_UNIT, n, LPack, BPack );
+          kernel::TriangularSolve( UPPER, NON_UNIT, n, LAdjPack, BPack );
+          if( conjugate )
+              Conjugate( BPack );
+          Unpack( NORMAL, BPack, B, offset, numActive );
+          return Int(-1);
+      };
+    ForEachGroup<Field>( batchSize, groupKernel );
+}
+
+} // namespace cholesky
+
+namespace lu {
+
+template<typename Field>
+void SolveAfter
+( Orientation orientation,
+  Int n,
+  Int numRHS,
+  const BatchView<Field>& A,
+  const BatchView<Int>& p,
+  const BatchView<Field>& B,
+  Int batchSize )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      CheckBatch( A, n, "A" );
+      CheckBatch( B, n, "B" );
+    )
+    const Int W = GroupSize<Field>();
+    auto groupKernel =
+      [&]( Int offset, Int numActive )
+      {
+          Interleaved<Field> APack( n, n ), BPack( n, numRHS );
+          Pack( orientation, A, offset, numActive, APack );
+          Pack( NORMAL, B, offset, numActive, BPack );
+
+          vector<Int> pivots( n*W );
+          for( Int l=0; l<W; ++l )
+          {
+              const Int* pBuf =
+                ( l < numActive ? p.Member(offset+l) : nullptr );
+              for( Int j=0; j<n; ++j )
+                  pivots[j*W+l] = ( l < numActive ? pBuf[j] : j );
+          }
+
+          if( orientation == NORMAL )
+          {
+              // P A = L U implies inv(A) B = inv(U) inv(L) P B
+              kernel::ApplyRowSwaps( NORMAL, pivots, BPack );
+              kernel::TriangularSolve( LOWER, UNIT, n, APack, BPack );
+              kernel::TriangularSolve( UPPER, NON_UNIT, n, APack, BPack );
+          }
+          else
+          {
+              // op(A) = op(U) op(L) P implies
+              // inv(op(A)) B = P^T inv(op(L)) inv(op(U)) B
+              kernel::TriangularSolve( LOWER, NON_UNIT, n, APack, BPack );
+              kernel::TriangularSolve( UPPER, UNIT, n, APack, BPack );
+              kernel::ApplyRowSwaps( TRANSPOSE, pivots, BPack );
+          }
+          Unpack( NORMAL, BPack, B, offset, numActive );
+          return Int(-1);
+      };
+    ForEachGroup<Field>( batchSize, groupKernel );
+}
+
+} // namespace lu
+
+namespace qr {
+
+template<typename Field>
+void SolveAfter
+( Orientation orientation,
+  Int m,
+  Int n,
+  Int numRHS,
+  const BatchView<Field>& A,
+  const BatchView<Field>& householderScalars,
+  const BatchView<Field>& B,
+  Int batchSize )
+{
+    EL_DEBUG_CSE
+    if( m < n )
+        LogicError("Batched QR solves require m >= n");
+    EL_DEBUG_ONLY(
+      CheckBatch( A, m, "A" );
+      CheckBatch( B, m, "B" );
+    )
+    const Int W = GroupSize<Field>();
+    // A^T X = B is equivalent to A^H conj(X) = conj(B)
+    const bool conjugate = ( orientation == TRANSPOSE );
+    auto groupKernel =
+      [&]( Int offset, Int numActive )
+      {
+          Interleaved<Field> APack( m, n ), BPack( m, numRHS );
+          Pack( NORMAL, A, offset, numActive, APack );
+          Pack( NORMAL, B, offset, numActive, BPack );
+
+          vector<Field> tau( n*W );
+          for( Int l=0; l<W; ++l )
+          {
+              const Field* tBuf =
+                ( l < numActive ? householderScalars.Member(offset+l)
+                                : nullptr );
+              for( Int j=0; j<n; ++j )
+                  tau[j*W+l] = ( l < numActive ? tBuf[j] : Field(0) );
+          }
+
+          if( orientation == NORMAL )
+          {
+              // X = inv(R) (Q^H B)(0:n,:)
+              kernel::ApplyQ( ADJOINT, APack, tau, BPack );
+              kernel::TriangularSolve( UPPER, NON_UNIT, n, APack, BPack );
+          }
+          else
+          {
+              // X = Q [inv(R^H) B(0:n,:); 0]
+              Interleaved<Field> RAdjPack( n, n );
+              Pack( ADJOINT, A, offset, numActive, RAdjPack );
+              if( conjugate )
+                  Conjugate( BPack );
+              kernel::TriangularSolve( LOWER, NON_UNIT, n, RAdjPack, BPack );
+              for( Int j=0; j<numRHS; ++j )
+                  for( Int i=n; i<m; ++i )
+                  {
+                      Field* b = BPack.Lanes(i,j);
+                      for( Int l=0; l<W; ++l )
+                          b[l] = 0;
+                  }
+              kernel::ApplyQ( NORMAL, APack, tau, BPack );
+              if( conjugate )
+                  Conjugate( BPack );
+          }
+          Unpack( NORMAL, BPack, B, offset, numActive );
+          return Int(-1);
+      };
+    ForEachGroup<Field>( batchSize, groupKernel );
+}
+
+} // namespace qr
+
+#define PROTO(Field) \
+  template void Gemm \
+  ( Orientation orientA, \
+    Orientation orientB, \
+    Int m, \
+    Int n, \
+    Int numSum, \
+    Field alpha, \
+    const BatchView<Field>& A, \
+    const BatchView<Field>& B, \
+    Field beta, \
+    const BatchView<Field>& C, \
+    Int batchSize ); \
+  template void Trsm \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    Orientation orientation, \
+    UnitOrNonUnit diag, \
+    Int m, \
+    Int n, \
+    Field alpha, \
+    const BatchView<Field>& A, \
+    const BatchView<Field>& B, \
+    Int batchSize ); \
+  template void Cholesky \
+  ( UpperOrLower uplo, \
+    Int n, \
+    const BatchView<Field>& A, \
+    Int batchSize ); \
+  template void LU \
+  ( Int m, \
+    Int n, \
+    const BatchView<Field>& A, \
+    const BatchView<Int>& p, \
+    Int batchSize ); \
+  template void QR \
+  ( Int m, \
+    Int n, \
+    const BatchView<Field>& A, \
+    const BatchView<Field>& householderScalars, \
+    Int batchSize ); \
+  template void cholesky::SolveAfter \
+  ( UpperOrLower uplo, \
+    Orientation orientation, \
+    Int n, \
+    Int numRHS, \
+    const BatchView<Field>& A, \
+    const BatchView<Field>& B, \
+    Int batchSize ); \
+  template void lu::SolveAfter \
+  ( Orientation orientation, \
+    Int n, \
+    Int numRHS, \
+    const BatchView<Field>& A, \
+    const BatchView<Int>& p, \
+    const BatchView<Field>& B, \
+    Int batchSize ); \
+  template void qr::SolveAfter \
+  ( Orientation orientation, \
+    Int m, \
+    Int n, \
+    Int numRHS, \
+    const BatchView<Field>& A, \
+    const BatchView<Field>& householderScalars, \
+    const BatchView<Field>& B, \
+    Int batchSize );
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace batched
+} // namespace El
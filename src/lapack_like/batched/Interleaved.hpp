@@ -0,0 +1,251 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BATCHED_INTERLEAVED_HPP
+#define EL_BATCHED_INTERLEAVED_HPP
+
+namespace El {
+namespace batched {
+
+// The number of batch members whose entries are interleaved, chosen so that
+// each lane loop spans a 64-byte cache line (and a full AVX-512 register).
+template<typename T>
+constexpr Int GroupSize() EL_NO_EXCEPT
+{ return sizeof(T) >= 64 ? 1 : Int(64/sizeof(T)); }
+
+// A group of GroupSize<T>() matrices of a common size stored in
+// structure-of-arrays form: Lanes(i,j)[l] is entry (i,j) of the l'th matrix.
+template<typename T>
+class Interleaved
+{
+public:
+    Interleaved( Int height, Int width )
+    : height_(height), width_(width),
+      buffer_(height*width*GroupSize<T>())
+    { }
+
+    Int Height() const EL_NO_EXCEPT { return height_; }
+    Int Width() const EL_NO_EXCEPT { return width_; }
+
+    T* Lanes( Int i, Int j ) EL_NO_EXCEPT
+    { return &buffer_[(i+j*height_)*GroupSize<T>()]; }
+    const T* Lanes( Int i, Int j ) const EL_NO_EXCEPT
+    { return &buffer_[(i+j*height_)*GroupSize<T>()]; }
+
+private:
+    Int height_, width_;
+    vector<T> buffer_;
+};
+
+// Interleave op(A[offset]), ..., op(A[offset+numActive-1]) into P, which
+// must already have the dimensions of op(A[k]). The inactive trailing lanes
+// are filled with the identity so that they can always be safely factored.
+template<typename T>
+void Pack
+( Orientation orientation,
+  const BatchView<T>& A,
+  Int offset,
+  Int numActive,
+  Interleaved<T>& P )
+{
+    const Int W = GroupSize<T>();
+    const Int height = P.Height();
+    const Int width = P.Width();
+    const Int ALDim = A.LDim();
+    for( Int l=0; l<numActive; ++l )
+    {
+        const T* ABuf = A.Member( offset+l );
+        if( orientation == NORMAL )
+        {
+            for( Int j=0; j<width; ++j )
+                for( Int i=0; i<height; ++i )
+                    P.Lanes(i,j)[l] = ABuf[i+j*ALDim];
+        }
+        else if( orientation == TRANSPOSE )
+        {
+            for( Int j=0; j<width; ++j )
+                for( Int i=0; i<height; ++i )
+                    P.Lanes(i,j)[l] = ABuf[j+i*ALDim];
+        }
+        else
+        {
+            for( Int j=0; j<width; ++j )
+                for( Int i=0; i<height; ++i )
+                    P.Lanes(i,j)[l] = Conj(ABuf[j+i*ALDim]);
+        }
+    }
+    for( Int l=numActive; l<W; ++l )
+        for( Int j=0; j<width; ++j )
+            for( Int i=0; i<height; ++i )
+                P.Lanes(i,j)[l] = ( i == j ? T(1) : T(0) );
+}
+
+// As above, but only the 'uplo' triangle of each square op(A[k]) is read
+// (so only the corresponding triangle of A[k] is accessed), and the opposite
+// triangle of P is zeroed.
+template<typename T>
+void Pack
+( UpperOrLower uplo,
+  Orientation orientation,
+  const BatchView<T>& A,
+  Int offset,
+  Int numActive,
+  Interleaved<T>& P )
+{
+    const Int W = GroupSize<T>();
+    const Int n = P.Height();
+    const Int ALDim = A.LDim();
+    for( Int j=0; j<n; ++j )
+    {
+        const Int iBeg = ( uplo == LOWER ? j : 0 );
+        const Int iEnd = ( uplo == LOWER ? n : j+1 );
+        for( Int i=0; i<n; ++i )
+        {
+            T* p = P.Lanes(i,j);
+            if( i < iBeg || i >= iEnd )
+            {
+                for( Int l=0; l<W; ++l )
+                    p[l] = T(0);
+                continue;
+            }
+            for( Int l=0; l<numActive; ++l )
+            {
+                const T* ABuf = A.Member( offset+l );
+                if( orientation == NORMAL )
+                    p[l] = ABuf[i+j*ALDim];
+                else if( orientation == TRANSPOSE )
+                    p[l] = ABuf[j+i*ALDim];
+                else
+                    p[l] = Conj(ABuf[j+i*ALDim]);
+            }
+            for( Int l=numActive; l<W; ++l )
+                p[l] = ( i == j ? T(1) : T(0) );
+        }
+    }
+}
+
+// The inverse of Pack for the active lanes.
+template<typename T>
+void Unpack
+( Orientation orientation,
+  const Interleaved<T>& P,
+  const BatchView<T>& A,
+  Int offset,
+  Int numActive )
+{
+    const Int height = P.Height();
+    const Int width = P.Width();
+    const Int ALDim = A.LDim();
+    for( Int l=0; l<numActive; ++l )
+    {
+        T* ABuf = A.Member( offset+l );
+        if( orientation == NORMAL )
+        {
+            for( Int j=0; j<width; ++j )
+                for( Int i=0; i<height; ++i )
+                    ABuf[i+j*ALDim] = P.Lanes(i,j)[l];
+        }
+        else if( orientation == TRANSPOSE )
+        {
+            for( Int j=0; j<width; ++j )
+                for( Int i=0; i<height; ++i )
+                    ABuf[j+i*ALDim] = P.Lanes(i,j)[l];
+        }
+        else
+        {
+            for( Int j=0; j<width; ++j )
+                for( Int i=0; i<height; ++i )
+                    ABuf[j+i*ALDim] = Conj(P.Lanes(i,j)[l]);
+        }
+    }
+}
+
+// The inverse of the triangular Pack for the active lanes.
+template<typename T>
+void Unpack
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Interleaved<T>& P,
+  const BatchView<T>& A,
+  Int offset,
+  Int numActive )
+{
+    const Int n = P.Height();
+    const Int ALDim = A.LDim();
+    for( Int l=0; l<numActive; ++l )
+    {
+        T* ABuf = A.Member( offset+l );
+        for( Int j=0; j<n; ++j )
+        {
+            const Int iBeg = ( uplo == LOWER ? j : 0 );
+            const Int iEnd = ( uplo == LOWER ? n : j+1 );
+            for( Int i=iBeg; i<iEnd; ++i )
+            {
+                if( orientation == NORMAL )
+                    ABuf[i+j*ALDim] = P.Lanes(i,j)[l];
+                else if( orientation == TRANSPOSE )
+                    ABuf[j+i*ALDim] = P.Lanes(i,j)[l];
+                else
+                    ABuf[j+i*ALDim] = Conj(P.Lanes(i,j)[l]);
+            }
+        }
+    }
+}
+
+template<typename T>
+void Conjugate( Interleaved<T>& P )
+{
+    const Int W = GroupSize<T>();
+    const Int height = P.Height();
+    const Int width = P.Width();
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<height; ++i )
+        {
+            T* p = P.Lanes(i,j);
+            EL_SIMD
+            for( Int l=0; l<W; ++l )
+                p[l] = Conj(p[l]);
+        }
+}
+
+// Apply 'kernel( offset, numActive )' to each group of the batch, in parallel
+// over the groups, and return the index of the first member which a kernel
+// reported as having failed (or -1 if there were no failures). Each kernel
+// should return either -1 or the offending member's index.
+template<typename T,class KernelType>
+Int ForEachGroup( Int batchSize, const KernelType& kernel )
+{
+    const Int W = GroupSize<T>();
+    const Int numGroups = (batchSize+W-1) / W;
+    vector<Int> failures( numGroups, -1 );
+    EL_PARALLEL_FOR
+    for( Int group=0; group<numGroups; ++group )
+    {
+        const Int offset = group*W;
+        failures[group] = kernel( offset, Min(W,batchSize-offset) );
+    }
+    for( Int group=0; group<numGroups; ++group )
+        if( failures[group] >= 0 )
+            return failures[group];
+    return -1;
+}
+
+template<typename T>
+void CheckBatch
+( const BatchView<T>& A, Int height, const char* label )
+{
+    if( A.LDim() < Max(height,Int(1)) )
+        LogicError
+        ("Leading dimension of ",label," was ",A.LDim(),
+         " but its members have height ",height);
+}
+
+} // namespace batched
+} // namespace El
+
+#endif // ifndef EL_BATCHED_INTERLEAVED_HPP
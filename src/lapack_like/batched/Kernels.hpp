@@ -0,0 +1,436 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BATCHED_KERNELS_HPP
+#define EL_BATCHED_KERNELS_HPP
+
+// Unblocked kernels acting upon every lane of an Interleaved group. All of
+// the inner loops run over the lanes so that each scalar operation of the
+// textbook algorithm becomes a single vector operation across the batch.
+
+namespace El {
+namespace batched {
+namespace kernel {
+
+// C := alpha A B + beta C
+template<typename T>
+void Gemm
+( T alpha,
+  const Interleaved<T>& A,
+  const Interleaved<T>& B,
+  T beta,
+        Interleaved<T>& C )
+{
+    const Int W = GroupSize<T>();
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int numSum = A.Width();
+    vector<T> alphaB( W );
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            T* c = C.Lanes(i,j);
+            EL_SIMD
+            for( Int l=0; l<W; ++l )
+                c[l] *= beta;
+        }
+        for( Int p=0; p<numSum; ++p )
+        {
+            const T* b = B.Lanes(p,j);
+            EL_SIMD
+            for( Int l=0; l<W; ++l )
+                alphaB[l] = alpha*b[l];
+            for( Int i=0; i<m; ++i )
+            {
+                const T* a = A.Lanes(i,p);
+                T* c = C.Lanes(i,j);
+                EL_SIMD
+                for( Int l=0; l<W; ++l )
+                    c[l] += a[l]*alphaB[l];
+            }
+        }
+    }
+}
+
+// Overwrite the leading 'order' rows of B with inv(A) B, where only the
+// 'uplo' triangle of the leading order x order submatrix of A is accessed
+template<typename T>
+void TriangularSolve
+( UpperOrLower uplo,
+  UnitOrNonUnit diag,
+  Int order,
+  const Interleaved<T>& A,
+        Interleaved<T>& B )
+{
+    const Int W = GroupSize<T>();
+    const Int n = B.Width();
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int step=0; step<order; ++step )
+        {
+            const Int p = ( uplo == LOWER ? step : order-1-step );
+            T* bp = B.Lanes(p,j);
+            if( diag == NON_UNIT )
+            {
+                const T* app = A.Lanes(p,p);
+                EL_SIMD
+                for( Int l=0; l<W; ++l )
+                    bp[l] /= app[l];
+            }
+            const Int iBeg = ( uplo == LOWER ? p+1 : 0 );
+            const Int iEnd = ( uplo == LOWER ? order : p );
+            for( Int i=iBeg; i<iEnd; ++i )
+            {
+                const T* a = A.Lanes(i,p);
+                T* b = B.Lanes(i,j);
+                EL_SIMD
+                for( Int l=0; l<W; ++l )
+                    b[l] -= a[l]*bp[l];
+            }
+        }
+    }
+}
+
+template<typename T>
+void Scale( T alpha, Interleaved<T>& B )
+{
+    if( alpha == T(1) )
+        return;
+    const Int W = GroupSize<T>();
+    const Int m = B.Height();
+    const Int n = B.Width();
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+        {
+            T* b = B.Lanes(i,j);
+            EL_SIMD
+            for( Int l=0; l<W; ++l )
+                b[l] *= alpha;
+        }
+}
+
+// Overwrite the lower triangle of A with its Cholesky factor, returning the
+// first active lane which was not HPD (or -1). Failed lanes are continued
+// with a unit pivot so that the remaining lanes are unaffected.
+template<typename Field>
+Int Cholesky( Int numActive, Interleaved<Field>& A )
+{
+    typedef Base<Field> Real;
+    const Int W = GroupSize<Field>();
+    const Int n = A.Height();
+    Int firstFailure = -1;
+    vector<Real> deltaInv( W );
+    vector<Field> conjACol( W );
+    for( Int j=0; j<n; ++j )
+    {
+        Field* ajj = A.Lanes(j,j);
+        for( Int l=0; l<W; ++l )
+        {
+            Real delta = RealPart(ajj[l]);
+            if( !(delta > Real(0)) )
+            {
+                if( l < numActive && (firstFailure < 0 || l < firstFailure) )
+                    firstFailure = l;
+                delta = Real(1);
+            }
+            delta = Sqrt(delta);
+            ajj[l] = delta;
+            deltaInv[l] = Real(1) / delta;
+        }
+        for( Int i=j+1; i<n; ++i )
+        {
+            Field* aij = A.Lanes(i,j);
+            EL_SIMD
+            for( Int l=0; l<W; ++l )
+                aij[l] *= deltaInv[l];
+        }
+        for( Int k=j+1; k<n; ++k )
+        {
+            const Field* akj = A.Lanes(k,j);
+            EL_SIMD
+            for( Int l=0; l<W; ++l )
+                conjACol[l] = Conj(akj[l]);
+            for( Int i=k; i<n; ++i )
+            {
+                const Field* aij = A.Lanes(i,j);
+                Field* aik = A.Lanes(i,k);
+                EL_SIMD
+                for( Int l=0; l<W; ++l )
+                    aik[l] -= aij[l]*conjACol[l];
+            }
+        }
+    }
+    return firstFailure;
+}
+
+// Overwrite A with its partially-pivoted LU factorization, storing the
+// swap performed at step j in pivots[j*W+l] and returning the first active
+// lane with an exactly zero pivot (or -1).
+template<typename Field>
+Int LU( Int numActive, Interleaved<Field>& A, vector<Int>& pivots )
+{
+    typedef Base<Field> Real;
+    const Int W = GroupSize<Field>();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    pivots.resize( minDim*W );
+    Int firstFailure = -1;
+    vector<Real> maxAbs( W );
+    vector<Field> pivotInv( W );
+    for( Int j=0; j<minDim; ++j )
+    {
+        // Find the pivot of each lane
+        Int* piv = &pivots[j*W];
+        const Field* ajj = A.Lanes(j,j);
+        for( Int l=0; l<W; ++l )
+        {
+            piv[l] = j;
+            maxAbs[l] = Abs(ajj[l]);
+        }
+        for( Int i=j+1; i<m; ++i )
+        {
+            const Field* aij = A.Lanes(i,j);
+            for( Int l=0; l<W; ++l )
+            {
+                const Real alphaAbs = Abs(aij[l]);
+                if( alphaAbs > maxAbs[l] )
+                {
+                    maxAbs[l] = alphaAbs;
+                    piv[l] = i;
+                }
+            }
+        }
+
+        // Swap the pivot rows into place
+        for( Int k=0; k<n; ++k )
+        {
+            Field* ajk = A.Lanes(j,k);
+            for( Int l=0; l<W; ++l )
+                if( piv[l] != j )
+                    std::swap( ajk[l], A.Lanes(piv[l],k)[l] );
+        }
+
+        for( Int l=0; l<W; ++l )
+        {
+            if( maxAbs[l] == Real(0) )
+            {
+                if( l < numActive && (firstFailure < 0 || l < firstFailure) )
+                    firstFailure = l;
+                pivotInv[l] = Field(0);
+            }
+            else
+                pivotInv[l] = Field(1) / ajj[l];
+        }
+        for( Int i=j+1; i<m; ++i )
+        {
+            Field* aij = A.Lanes(i,j);
+            EL_SIMD
+            for( Int l=0; l<W; ++l )
+                aij[l] *= pivotInv[l];
+        }
+
+        // Rank-one update of the trailing submatrix
+        for( Int k=j+1; k<n; ++k )
+        {
+            const Field* ajk = A.Lanes(j,k);
+            for( Int i=j+1; i<m; ++i )
+            {
+                const Field* aij = A.Lanes(i,j);
+                Field* aik = A.Lanes(i,k);
+                EL_SIMD
+                for( Int l=0; l<W; ++l )
+                    aik[l] -= aij[l]*ajk[l];
+            }
+        }
+    }
+    return firstFailure;
+}
+
+// Apply the row swaps from LU to B, either in the order that they were
+// performed (P B) or in reverse (P^T B)
+template<typename Field>
+void ApplyRowSwaps
+( Orientation orientation,
+  const vector<Int>& pivots,
+  Interleaved<Field>& B )
+{
+    const Int W = GroupSize<Field>();
+    const Int numSwaps = pivots.size() / W;
+    const Int n = B.Width();
+    for( Int step=0; step<numSwaps; ++step )
+    {
+        const Int j = ( orientation == NORMAL ? step : numSwaps-1-step );
+        const Int* piv = &pivots[j*W];
+        for( Int k=0; k<n; ++k )
+        {
+            Field* bjk = B.Lanes(j,k);
+            for( Int l=0; l<W; ++l )
+                if( piv[l] != j )
+                    std::swap( bjk[l], B.Lanes(piv[l],k)[l] );
+        }
+    }
+}
+
+// Overwrite A with R and the Householder vectors of its QR factorization,
+// with the Householder scalars of step j placed in householderScalars[j*W+l]
+template<typename Field>
+void QR( Interleaved<Field>& A, vector<Field>& householderScalars )
+{
+    typedef Base<Field> Real;
+    const Int W = GroupSize<Field>();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    householderScalars.resize( minDim*W );
+    vector<Real> sigma( W );
+    vector<Field> scale( W ), conjTauW( W );
+    for( Int j=0; j<minDim; ++j )
+    {
+        // Form the reflector which annihilates A(j+1:m,j)
+        // ================================================
+        EL_SIMD
+        for( Int l=0; l<W; ++l )
+            sigma[l] = 0;
+        for( Int i=j+1; i<m; ++i )
+        {
+            const Field* aij = A.Lanes(i,j);
+            EL_SIMD
+            for( Int l=0; l<W; ++l )
+                sigma[l] += RealPart(aij[l])*RealPart(aij[l]) +
+                            ImagPart(aij[l])*ImagPart(aij[l]);
+        }
+        Field* ajj = A.Lanes(j,j);
+        Field* tau = &householderScalars[j*W];
+        for( Int l=0; l<W; ++l )
+        {
+            const Field alpha = ajj[l];
+            if( sigma[l] == Real(0) && ImagPart(alpha) == Real(0) )
+            {
+                tau[l] = Field(0);
+                scale[l] = Field(1);
+            }
+            else
+            {
+                const Real alphaRe = RealPart(alpha);
+                const Real alphaIm = ImagPart(alpha);
+                const Real norm =
+                  Sqrt( alphaRe*alphaRe + alphaIm*alphaIm + sigma[l] );
+                const Real beta = ( alphaRe >= Real(0) ? -norm : norm );
+                tau[l] = (beta-alpha) / beta;
+                scale[l] = Field(1) / (alpha-beta);
+                ajj[l] = beta;
+            }
+        }
+        for( Int i=j+1; i<m; ++i )
+        {
+            Field* aij = A.Lanes(i,j);
+            EL_SIMD
+            for( Int l=0; l<W; ++l )
+                aij[l] *= scale[l];
+        }
+
+        // Apply H^H = I - conj(tau) v v^H to the trailing columns
+        // =======================================================
+        for( Int k=j+1; k<n; ++k )
+        {
+            Field* ajk = A.Lanes(j,k);
+            EL_SIMD
+            for( Int l=0; l<W; ++l )
+                conjTauW[l] = ajk[l];
+            for( Int i=j+1; i<m; ++i )
+            {
+                const Field* aij = A.Lanes(i,j);
+                const Field* aik = A.Lanes(i,k);
+                EL_SIMD
+                for( Int l=0; l<W; ++l )
+                    conjTauW[l] += Conj(aij[l])*aik[l];
+            }
+            EL_SIMD
+            for( Int l=0; l<W; ++l )
+            {
+                conjTauW[l] *= Conj(tau[l]);
+                ajk[l] -= conjTauW[l];
+            }
+            for( Int i=j+1; i<m; ++i )
+            {
+                const Field* aij = A.Lanes(i,j);
+                Field* aik = A.Lanes(i,k);
+                EL_SIMD
+                for( Int l=0; l<W; ++l )
+                    aik[l] -= aij[l]*conjTauW[l];
+            }
+        }
+    }
+}
+
+// B := Q^H B (orientation=ADJOINT) or B := Q B (orientation=NORMAL) using
+// the implicit representation of Q produced by QR
+template<typename Field>
+void ApplyQ
+( Orientation orientation,
+  const Interleaved<Field>& A,
+  const vector<Field>& householderScalars,
+        Interleaved<Field>& B )
+{
+    const Int W = GroupSize<Field>();
+    const Int m = A.Height();
+    const Int minDim = householderScalars.size() / W;
+    const Int n = B.Width();
+    vector<Field> w( W );
+    for( Int step=0; step<minDim; ++step )
+    {
+        const Int j = ( orientation == NORMAL ? minDim-1-step : step );
+        const Field* tau = &householderScalars[j*W];
+        for( Int k=0; k<n; ++k )
+        {
+            Field* bjk = B.Lanes(j,k);
+            EL_SIMD
+            for( Int l=0; l<W; ++l )
+                w[l] = bjk[l];
+            for( Int i=j+1; i<m; ++i )
+            {
+                const Field* aij = A.Lanes(i,j);
+                const Field* bik = B.Lanes(i,k);
+                EL_SIMD
+                for( Int l=0; l<W; ++l )
+                    w[l] += Conj(aij[l])*bik[l];
+            }
+            if( orientation == NORMAL )
+            {
+                EL_SIMD
+                for( Int l=0; l<W; ++l )
+                    w[l] *= tau[l];
+            }
+            else
+            {
+                EL_SIMD
+                for( Int l=0; l<W; ++l )
+                    w[l] *= Conj(tau[l]);
+            }
+            EL_SIMD
+            for( Int l=0; l<W; ++l )
+                bjk[l] -= w[l];
+            for( Int i=j+1; i<m; ++i )
+            {
+                const Field* aij = A.Lanes(i,j);
+                Field* bik = B.Lanes(i,k);
+                EL_SIMD
+                for( Int l=0; l<W; ++l )
+                    bik[l] -= aij[l]*w[l];
+            }
+        }
+    }
+}
+
+} // namespace kernel
+} // namespace batched
+} // namespace El
+
+#endif // ifndef EL_BATCHED_KERNELS_HPP
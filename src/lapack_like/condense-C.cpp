@@ -19,6 +19,8 @@ ElError ElHermitianTridiagCtrlDefault_s( ElHermitianTridiagCtrl* ctrl )
     ctrl->approach = EL_HERMITIAN_TRIDIAG_DEFAULT;
     ctrl->order = EL_ROW_MAJOR;
     ElSymvCtrlDefault_s( &ctrl->symvCtrl );
+    ctrl->twoStage = false;
+    ctrl->bandwidth = 0;
     return EL_SUCCESS;
 }
 ElError ElHermitianTridiagCtrlDefault_d( ElHermitianTridiagCtrl* ctrl )
@@ -26,6 +28,8 @@ ElError ElHermitianTridiagCtrlDefault_d( ElHermitianTridiagCtrl* ctrl )
     ctrl->approach = EL_HERMITIAN_TRIDIAG_DEFAULT;
     ctrl->order = EL_ROW_MAJOR;
     ElSymvCtrlDefault_d( &ctrl->symvCtrl );
+    ctrl->twoStage = false;
+    ctrl->bandwidth = 0;
     return EL_SUCCESS;
 }
 ElError ElHermitianTridiagCtrlDefault_c( ElHermitianTridiagCtrl* ctrl )
@@ -33,6 +37,8 @@ ElError ElHermitianTridiagCtrlDefault_c( ElHermitianTridiagCtrl* ctrl )
     ctrl->approach = EL_HERMITIAN_TRIDIAG_DEFAULT;
     ctrl->order = EL_ROW_MAJOR;
     ElSymvCtrlDefault_c( &ctrl->symvCtrl );
+    ctrl->twoStage = false;
+    ctrl->bandwidth = 0;
     return EL_SUCCESS;
 }
 ElError ElHermitianTridiagCtrlDefault_z( ElHermitianTridiagCtrl* ctrl )
@@ -40,6 +46,8 @@ ElError ElHermitianTridiagCtrlDefault_z( ElHermitianTridiagCtrl* ctrl )
     ctrl->approach = EL_HERMITIAN_TRIDIAG_DEFAULT;
     ctrl->order = EL_ROW_MAJOR;
     ElSymvCtrlDefault_z( &ctrl->symvCtrl );
+    ctrl->twoStage = false;
+    ctrl->bandwidth = 0;
     return EL_SUCCESS;
 }
 
@@ -104,6 +112,20 @@ ElError ElHermitianTridiagCtrlDefault_z( ElHermitianTridiagCtrl* ctrl )
   ( ElUpperOrLower uplo, ElDistMatrix_ ## SIG A, ElDistMatrix_ ## SIG t ) \
   { EL_TRY( HermitianTridiag( \
       CReflect(uplo), *CReflect(A), *CReflect(t) ) ) } \
+  /* The packed form has no room for the bulge-chasing reflectors of the
+     two-stage reduction, so it is rejected here rather than deep within
+     the reduction */ \
+  ElError ElHermitianTridiagXDist_ ## SIG \
+  ( ElUpperOrLower uplo, ElDistMatrix_ ## SIG A, ElDistMatrix_ ## SIG t, \
+    ElHermitianTridiagCtrl ctrl ) \
+  { EL_TRY( \
+      if( ctrl.twoStage ) \
+          LogicError \
+          ("ElHermitianTridiagXDist cannot return the reflectors of a " \
+           "two-stage reduction; use ElHermitianTridiagOnlyXDist instead"); \
+      HermitianTridiag( \
+        CReflect(uplo), *CReflect(A), *CReflect(t), \
+        CReflect<F>(ctrl) ) ) } \
   /* Return only the condensed form */ \
   ElError ElHermitianTridiagOnly_ ## SIG \
   ( ElUpperOrLower uplo, ElMatrix_ ## SIG A ) \
@@ -113,6 +135,11 @@ ElError ElHermitianTridiagCtrlDefault_z( ElHermitianTridiagCtrl* ctrl )
   ( ElUpperOrLower uplo, ElDistMatrix_ ## SIG A ) \
   { EL_TRY( herm_tridiag::ExplicitCondensed \
       ( CReflect(uplo), *CReflect(A) ) ) } \
+  ElError ElHermitianTridiagOnlyXDist_ ## SIG \
+  ( ElUpperOrLower uplo, ElDistMatrix_ ## SIG A, \
+    ElHermitianTridiagCtrl ctrl ) \
+  { EL_TRY( herm_tridiag::ExplicitCondensed \
+      ( CReflect(uplo), *CReflect(A), CReflect<F>(ctrl) ) ) } \
   /* ApplyQ after HermitianTridiag */ \
   ElError ElApplyQAfterHermitianTridiag_ ## SIG \
   ( ElLeftOrRight side, ElUpperOrLower uplo, ElOrientation orientation, \
@@ -37,7 +37,7 @@ void LowerBlocked
 
     Matrix<F> X, Y;
 
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Bidiag",m);
     for( Int k=0; k<m; k+=bsize )
     {
         const Int nb = Min(bsize,m-k);
@@ -123,7 +123,8 @@ LowerBlocked
     DistMatrix<F,MC,  STAR> AB1_MC_STAR(g);
     DistMatrix<F,STAR,MR  > A1R_STAR_MR(g);
 
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<F>("Bidiag",m,A.Grid().Height(),A.Grid().Width());
     for( Int k=0; k<m; k+=bsize )
     {
         const Int nb = Min(bsize,m-k);
@@ -35,7 +35,7 @@ void UpperBlocked
 
     Matrix<F> X, Y;
 
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Bidiag",n);
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -118,7 +118,8 @@ UpperBlocked
     DistMatrix<F,MC,STAR> AB1_MC_STAR(grid);
     DistMatrix<F,MR,STAR> A1RTrans_MR_STAR(grid);
 
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<F>("Bidiag",n,A.Grid().Height(),A.Grid().Width());
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
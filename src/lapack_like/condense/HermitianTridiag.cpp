@@ -45,6 +45,7 @@ void Ger2Sub
 #include "./HermitianTridiag/LowerBlockedSquare.hpp"
 #include "./HermitianTridiag/UpperBlocked.hpp"
 #include "./HermitianTridiag/UpperBlockedSquare.hpp"
+#include "./HermitianTridiag/TwoStage.hpp"
 
 #include "./HermitianTridiag/ApplyQ.hpp"
 
@@ -52,9 +53,16 @@ namespace El {
 
 template<typename F>
 void HermitianTridiag
-( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& householderScalars )
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  const HermitianTridiagCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("HermitianTridiag")
+    if( ctrl.twoStage )
+        LogicError
+        ("The two-stage reduction must return its bulge-chasing reflectors");
     if( uplo == LOWER )
         herm_tridiag::LowerBlocked( A, householderScalars );
     else
@@ -69,6 +77,10 @@ void HermitianTridiag
   const HermitianTridiagCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("HermitianTridiag")
+    if( ctrl.twoStage )
+        LogicError
+        ("The two-stage reduction must return its bulge-chasing reflectors");
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     DistMatrixWriteProxy<F,F,STAR,STAR>
@@ -158,14 +170,79 @@ void HermitianTridiag
     }
 }
 
+template<typename F>
+void HermitianTridiag
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  herm_tridiag::BulgeReflectors<F>& bulgeReflectors,
+  const HermitianTridiagCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.twoStage )
+    {
+        EL_PROFILE_REGION("HermitianTridiag")
+        herm_tridiag::TwoStage
+        ( uplo, A, householderScalars, &bulgeReflectors, ctrl.bandwidth );
+    }
+    else
+    {
+        HermitianTridiag( uplo, A, householderScalars, ctrl );
+        bulgeReflectors.bandwidth = 1;
+        bulgeReflectors.V.Empty();
+        bulgeReflectors.householderScalars.Empty();
+        bulgeReflectors.comm = mpi::COMM_SELF;
+    }
+}
+
+template<typename F>
+void HermitianTridiag
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsPre,
+  herm_tridiag::BulgeReflectors<F>& bulgeReflectors,
+  const HermitianTridiagCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.twoStage )
+    {
+        EL_PROFILE_REGION("HermitianTridiag")
+        DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+        DistMatrixWriteProxy<F,F,STAR,STAR>
+          householderScalarsProx( householderScalarsPre );
+        auto& A = AProx.Get();
+        auto& householderScalars = householderScalarsProx.Get();
+        herm_tridiag::TwoStage
+        ( uplo, A, householderScalars, &bulgeReflectors, ctrl.bandwidth );
+    }
+    else
+    {
+        HermitianTridiag( uplo, APre, householderScalarsPre, ctrl );
+        bulgeReflectors.bandwidth = 1;
+        bulgeReflectors.V.Empty();
+        bulgeReflectors.householderScalars.Empty();
+        bulgeReflectors.comm = mpi::COMM_SELF;
+    }
+}
+
 namespace herm_tridiag {
 
 template<typename F>
-void ExplicitCondensed( UpperOrLower uplo, Matrix<F>& A )
+void ExplicitCondensed
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  const HermitianTridiagCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
     Matrix<F> householderScalars;
-    HermitianTridiag( uplo, A, householderScalars );
+    if( ctrl.twoStage )
+    {
+        // The bulge-chasing reflectors are not needed
+        EL_PROFILE_REGION("HermitianTridiag")
+        TwoStage<F>( uplo, A, householderScalars, nullptr, ctrl.bandwidth );
+    }
+    else
+        HermitianTridiag( uplo, A, householderScalars, ctrl );
     if( uplo == UPPER )
         MakeTrapezoidal( LOWER, A, 1 );
     else
@@ -175,12 +252,21 @@ void ExplicitCondensed( UpperOrLower uplo, Matrix<F>& A )
 template<typename F>
 void ExplicitCondensed
 ( UpperOrLower uplo,
-  AbstractDistMatrix<F>& A, 
+  AbstractDistMatrix<F>& APre,
   const HermitianTridiagCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
     DistMatrix<F,STAR,STAR> householderScalars(A.Grid());
-    HermitianTridiag( uplo, A, householderScalars, ctrl );
+    if( ctrl.twoStage )
+    {
+        // The bulge-chasing reflectors are not needed
+        EL_PROFILE_REGION("HermitianTridiag")
+        TwoStage<F>( uplo, A, householderScalars, nullptr, ctrl.bandwidth );
+    }
+    else
+        HermitianTridiag( uplo, A, householderScalars, ctrl );
     if( uplo == UPPER )
         MakeTrapezoidal( LOWER, A, 1 );
     else
@@ -193,14 +279,29 @@ void ExplicitCondensed
   template void HermitianTridiag \
   ( UpperOrLower uplo, \
     Matrix<F>& A, \
-    Matrix<F>& householderScalars ); \
+    Matrix<F>& householderScalars, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
+  template void HermitianTridiag \
+  ( UpperOrLower uplo, \
+    AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalars, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
+  template void HermitianTridiag \
+  ( UpperOrLower uplo, \
+    Matrix<F>& A, \
+    Matrix<F>& householderScalars, \
+    herm_tridiag::BulgeReflectors<F>& bulgeReflectors, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
   template void HermitianTridiag \
   ( UpperOrLower uplo, \
     AbstractDistMatrix<F>& A, \
     AbstractDistMatrix<F>& householderScalars, \
+    herm_tridiag::BulgeReflectors<F>& bulgeReflectors, \
     const HermitianTridiagCtrl<F>& ctrl ); \
   template void herm_tridiag::ExplicitCondensed \
-  ( UpperOrLower uplo, Matrix<F>& A ); \
+  ( UpperOrLower uplo, \
+    Matrix<F>& A, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
   template void herm_tridiag::ExplicitCondensed \
   ( UpperOrLower uplo, \
     AbstractDistMatrix<F>& A, \
@@ -218,6 +319,22 @@ void ExplicitCondensed
     Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& householderScalars, \
+          AbstractDistMatrix<F>& B ); \
+  template void herm_tridiag::ApplyQ \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    Orientation orientation, \
+    const Matrix<F>& A, \
+    const Matrix<F>& householderScalars, \
+    const herm_tridiag::BulgeReflectors<F>& bulgeReflectors, \
+          Matrix<F>& B ); \
+  template void herm_tridiag::ApplyQ \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    Orientation orientation, \
+    const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& householderScalars, \
+    const herm_tridiag::BulgeReflectors<F>& bulgeReflectors, \
           AbstractDistMatrix<F>& B );
 
 #define EL_NO_INT_PROTO
@@ -22,6 +22,7 @@ void ApplyQ
         Matrix<F>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("HermitianTridiagApplyQ")
     const bool normal = (orientation==NORMAL);
     const bool onLeft = (side==LEFT);
     const ForwardOrBackward direction = 
@@ -44,6 +45,7 @@ void ApplyQ
         AbstractDistMatrix<F>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("HermitianTridiagApplyQ")
     const bool normal = (orientation==NORMAL);
     const bool onLeft = (side==LEFT);
     const ForwardOrBackward direction = 
@@ -55,6 +57,94 @@ void ApplyQ
       A, householderScalars, B );
 }
 
+// The orthogonal factor of the two-stage reduction is Q = Q1 Q2, where Q1 is
+// the product of the band-reduction reflectors, which are stored as those
+// of the one-stage reduction but with an offset of the bandwidth, and Q2 is
+// that of the bulge-chasing reflectors
+template<typename F>
+void ApplyQ
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<F>& A,
+  const Matrix<F>& householderScalars,
+  const BulgeReflectors<F>& bulgeReflectors,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int bandwidth = bulgeReflectors.bandwidth;
+    if( bandwidth == 1 && bulgeReflectors.V.Width() == 0 &&
+        mpi::Size(bulgeReflectors.comm) == 1 )
+    {
+        ApplyQ( side, uplo, orientation, A, householderScalars, B );
+        return;
+    }
+    if( uplo == UPPER )
+    {
+        Matrix<F> AAdj;
+        Adjoint( A, AAdj );
+        ApplyQ
+        ( side, LOWER, orientation, AAdj, householderScalars, bulgeReflectors,
+          B );
+        return;
+    }
+
+    EL_PROFILE_REGION("HermitianTridiagApplyQ")
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? CONJUGATED : UNCONJUGATED );
+    if( normal == onLeft )
+        ApplyBulgeReflectors( side, orientation, bulgeReflectors, B );
+    ApplyPackedReflectors
+    ( side, LOWER, VERTICAL, direction, conjugation, -bandwidth,
+      A, householderScalars, B );
+    if( normal != onLeft )
+        ApplyBulgeReflectors( side, orientation, bulgeReflectors, B );
+}
+
+template<typename F>
+void ApplyQ
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& householderScalars,
+  const BulgeReflectors<F>& bulgeReflectors,
+        AbstractDistMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int bandwidth = bulgeReflectors.bandwidth;
+    if( bandwidth == 1 && bulgeReflectors.V.Width() == 0 &&
+        mpi::Size(bulgeReflectors.comm) == 1 )
+    {
+        ApplyQ( side, uplo, orientation, A, householderScalars, B );
+        return;
+    }
+    if( uplo == UPPER )
+    {
+        DistMatrix<F> AAdj( A.Grid() );
+        Adjoint( A, AAdj );
+        ApplyQ
+        ( side, LOWER, orientation, AAdj, householderScalars, bulgeReflectors,
+          B );
+        return;
+    }
+
+    EL_PROFILE_REGION("HermitianTridiagApplyQ")
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? CONJUGATED : UNCONJUGATED );
+    if( normal == onLeft )
+        ApplyBulgeReflectors( side, orientation, bulgeReflectors, B );
+    ApplyPackedReflectors
+    ( side, LOWER, VERTICAL, direction, conjugation, -bandwidth,
+      A, householderScalars, B );
+    if( normal != onLeft )
+        ApplyBulgeReflectors( side, orientation, bulgeReflectors, B );
+}
+
 } // namespace herm_tridiag
 } // namespace El
 
@@ -0,0 +1,586 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+#define EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+
+namespace El {
+namespace herm_tridiag {
+
+// Two-stage reduction to tridiagonal form
+// =======================================
+// The first stage reduces A to a band of width b by computing, for each panel
+// of b columns, the QR factorization of the portion of the panel below the
+// band and applying its reflectors to both sides of the trailing matrix in
+// compact WY form with Hemm, Gemm, and Her2k. The reflectors are stored in the
+// same manner as those of the one-stage reduction, but with their implicit
+// unit entries on the b'th subdiagonal.
+//
+// The second stage chases the band down to tridiagonal form with Householder
+// reflectors of length at most b. Each sweep annihilates one column of the
+// band and then, step by step, the first column of the bulge created by the
+// previous step; since every step only touches O(b^2) entries of a compact
+// band, several consecutive sweeps are advanced together as a wavefront so
+// that the band is reused while it is in cache.
+//
+// Only the lower-triangular storage is handled directly, as the two-stage
+// reduction of the upper triangle of A is that of the lower triangle of A^H.
+//
+// See Bischof, Lang, and Sun, "A framework for symmetric band reduction",
+// ACM Trans. Math. Softw., 26(4), 2000, and Haidar, Ltaief, and Dongarra,
+// "Parallel reduction to condensed forms for symmetric eigenvalue problems
+// using aggregated fine-grained and memory-aware kernels", SC11.
+
+inline Int TwoStageBandwidth( Int n, Int bandwidth )
+{
+    const Int b = ( bandwidth > 0 ? bandwidth : Blocksize() );
+    return Max( Min(b,n-1), Int(1) );
+}
+
+// The number of reflectors in the j'th bulge-chasing sweep of an n x n
+// matrix with bandwidth b; the s'th reflector acts upon the indices beginning
+// at j+1+s*b
+inline Int NumBulgeSteps( Int n, Int b, Int j )
+{ return ( b == 1 ? 1 : Max( (n-2-j+b-1)/b, Int(1) ) ); }
+
+// The sweeps are grouped into blocks of b consecutive sweeps which are
+// assigned to the processes in a round-robin manner. Return the number of
+// reflectors stored by the given process along with the offset of the first
+// reflector of each sweep within its storage (or -1 if the sweep belongs to
+// another process).
+inline Int LocalBulgeSweepOffsets
+( Int n, Int b, int commRank, int commSize, vector<Int>& sweepOffsets )
+{
+    sweepOffsets.resize( Max(n-1,Int(0)) );
+    Int numLocalReflectors = 0;
+    for( Int j=0; j<n-1; ++j )
+    {
+        if( (j/b) % commSize == commRank )
+        {
+            sweepOffsets[j] = numLocalReflectors;
+            numLocalReflectors += NumBulgeSteps( n, b, j );
+        }
+        else
+            sweepOffsets[j] = -1;
+    }
+    return numLocalReflectors;
+}
+
+template<typename F>
+void LowerBandReduction( Matrix<F>& A, Matrix<F>& householderScalars, Int b )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    householderScalars.Resize( Max(n-b,Int(0)), 1 );
+
+    Matrix<F> panelScalars, V, SInv, Y, Z;
+    Matrix<Base<F>> signature;
+    for( Int k=0; k<n-b; k+=b )
+    {
+        const Int nb = Min(b,n-b-k);
+        const Range<Int> indPan( k, k+b ), indB( k+b, n );
+
+        auto APan = A( indB, indPan );
+        auto A22 = A( indB, indB );
+
+        // Undo the normalization of the diagonal of R so that the panel is
+        // annihilated by its reflectors alone
+        QR( APan, panelScalars, signature );
+        auto R = APan( IR(0,nb), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, signature, R );
+        auto householderScalars1 = householderScalars( IR(k,k+nb), ALL );
+        householderScalars1 = panelScalars;
+
+        V = APan( ALL, IR(0,nb) );
+        MakeTrapezoidal( LOWER, V );
+        FillDiagonal( V, F(1) );
+
+        // The product of the adjoints of the reflectors is I - V inv(SInv) V^H
+        Herk( UPPER, ADJOINT, Base<F>(1), V, SInv );
+        for( Int j=0; j<nb; ++j )
+            SInv(j,j) = F(1) / Conj(panelScalars(j));
+
+        // Y := A22 V inv(SInv)
+        Zeros( Y, A22.Height(), nb );
+        Hemm( LEFT, LOWER, F(1), A22, V, F(0), Y );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), SInv, Y );
+
+        // Y := Y - V (inv(SInv)^H V^H Y) / 2
+        Gemm( ADJOINT, NORMAL, F(1), V, Y, Z );
+        Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), SInv, Z );
+        Gemm( NORMAL, NORMAL, F(-1)/F(2), V, Z, F(1), Y );
+
+        // A22 := A22 - V Y^H - Y V^H
+        Her2k( LOWER, NORMAL, F(-1), V, Y, Base<F>(1), A22 );
+    }
+}
+
+template<typename F>
+void LowerBandReduction
+( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& householderScalars, Int b )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Grid& g = A.Grid();
+    householderScalars.Resize( Max(n-b,Int(0)), 1 );
+
+    DistMatrix<F> V(g), Y(g);
+    DistMatrix<F,VC,STAR> V_VC_STAR(g), Y_VC_STAR(g);
+    DistMatrix<F,STAR,STAR> panelScalars(g), SInv(g), Z(g);
+    DistMatrix<Base<F>,STAR,STAR> signature(g);
+    for( Int k=0; k<n-b; k+=b )
+    {
+        const Int nb = Min(b,n-b-k);
+        const Range<Int> indPan( k, k+b ), indB( k+b, n );
+
+        auto APan = A( indB, indPan );
+        auto A22 = A( indB, indB );
+
+        // Undo the normalization of the diagonal of R so that the panel is
+        // annihilated by its reflectors alone
+        QR( APan, panelScalars, signature );
+        auto R = APan( IR(0,nb), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, signature, R );
+        auto householderScalars1 = householderScalars( IR(k,k+nb), ALL );
+        householderScalars1 = panelScalars;
+
+        V.AlignWith( A22 );
+        V = APan( ALL, IR(0,nb) );
+        MakeTrapezoidal( LOWER, V );
+        FillDiagonal( V, F(1) );
+
+        // The product of the adjoints of the reflectors is I - V inv(SInv) V^H
+        V_VC_STAR = V;
+        Zeros( SInv, nb, nb );
+        Herk
+        ( UPPER, ADJOINT,
+          Base<F>(1), V_VC_STAR.LockedMatrix(),
+          Base<F>(0), SInv.Matrix() );
+        El::AllReduce( SInv, V_VC_STAR.ColComm() );
+        for( Int j=0; j<nb; ++j )
+            SInv.SetLocal( j, j, F(1)/Conj(panelScalars.GetLocal(j,0)) );
+
+        // Y := A22 V inv(SInv)
+        Y.AlignWith( A22 );
+        Zeros( Y, A22.Height(), nb );
+        Hemm( LEFT, LOWER, F(1), A22, V, F(0), Y );
+        Y_VC_STAR.AlignWith( V_VC_STAR );
+        Y_VC_STAR = Y;
+        LocalTrsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), SInv, Y_VC_STAR );
+
+        // Y := Y - V (inv(SInv)^H V^H Y) / 2
+        Zeros( Z, nb, nb );
+        Gemm
+        ( ADJOINT, NORMAL,
+          F(1), V_VC_STAR.LockedMatrix(), Y_VC_STAR.LockedMatrix(),
+          F(0), Z.Matrix() );
+        El::AllReduce( Z, V_VC_STAR.ColComm() );
+        LocalTrsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), SInv, Z );
+        LocalGemm( NORMAL, NORMAL, F(-1)/F(2), V_VC_STAR, Z, F(1), Y_VC_STAR );
+
+        // A22 := A22 - V Y^H - Y V^H
+        Her2k( LOWER, NORMAL, F(-1), V_VC_STAR, Y_VC_STAR, Base<F>(1), A22 );
+    }
+}
+
+// Reduce a Hermitian band matrix, whose lower triangle is stored in the
+// compact form W(i-j,j) = A(i,j), to tridiagonal form. W must have at least
+// 3b rows so that entry (i,j) of each window of interest is located at
+// W.Buffer()[i+j*(W.LDim()-1)], with the (unreferenced) upper triangle of each
+// diagonal block overlapping the unused bottom rows. Only the reflectors of
+// the blocks of sweeps assigned to this process of bulgeReflectors->comm are
+// stored.
+template<typename F>
+void ChaseBulges( Matrix<F>& W, Int b, BulgeReflectors<F>* bulgeReflectors )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( W.Height() < 3*b )
+          LogicError("The band storage must have at least 3b rows");
+    )
+    const Int n = W.Width();
+    F* WBuf = W.Buffer();
+    const Int ldim = W.LDim()-1;
+
+    vector<Int> sweepOffsets;
+    if( bulgeReflectors != nullptr )
+    {
+        const mpi::Comm comm = bulgeReflectors->comm;
+        const Int numLocalReflectors =
+          LocalBulgeSweepOffsets
+          ( n, b, mpi::Rank(comm), mpi::Size(comm), sweepOffsets );
+        bulgeReflectors->bandwidth = b;
+        Zeros( bulgeReflectors->V, b, numLocalReflectors );
+        Zeros( bulgeReflectors->householderScalars, numLocalReflectors, 1 );
+    }
+
+    Matrix<F> x, v, z, ALeft, ADiag, ABelow;
+    auto step = [&]( Int j, Int s )
+    {
+        const Int r = j+1+s*b;
+        const Int col = ( s==0 ? j : r-b );
+        const Int L = Min(b,n-r);
+
+        // Annihilate all but the first of the entries [r,r+L) of column 'col'
+        F& chi = WBuf[r+col*ldim];
+        x.Attach( L-1, 1, &WBuf[(r+1)+col*ldim], ldim );
+        const F tau = LeftReflector( chi, x );
+        v.Resize( L, 1 );
+        v(0) = F(1);
+        for( Int i=1; i<L; ++i )
+        {
+            v(i) = x(i-1);
+            x(i-1) = F(0);
+        }
+        if( bulgeReflectors != nullptr && sweepOffsets[j] >= 0 )
+        {
+            const Int k = sweepOffsets[j] + s;
+            for( Int i=0; i<L; ++i )
+                bulgeReflectors->V(i,k) = v(i);
+            bulgeReflectors->householderScalars(k) = tau;
+        }
+
+        // Apply the reflector from the left to the rest of the bulge
+        if( r > col+1 )
+        {
+            ALeft.Attach( L, r-(col+1), &WBuf[r+(col+1)*ldim], ldim );
+            Gemv( ADJOINT, F(1), ALeft, v, z );
+            Ger( -tau, v, z, ALeft );
+        }
+
+        // Apply the reflector from both sides to the diagonal block
+        ADiag.Attach( L, L, &WBuf[r+r*ldim], ldim );
+        Zeros( z, L, 1 );
+        Hemv( LOWER, Conj(tau), ADiag, v, F(0), z );
+        const F alpha = -Conj(tau)*Dot( z, v )/F(2);
+        Axpy( alpha, v, z );
+        Her2( LOWER, F(-1), v, z, ADiag );
+
+        // Apply the reflector from the right to the block below, which
+        // creates the next bulge
+        const Int belowEnd = Min(n,r+L+b);
+        if( belowEnd > r+L )
+        {
+            ABelow.Attach( belowEnd-(r+L), L, &WBuf[(r+L)+r*ldim], ldim );
+            Gemv( NORMAL, F(1), ABelow, v, z );
+            Ger( -Conj(tau), z, v, ABelow );
+        }
+    };
+
+    // The indices touched by step s of sweep j lie within
+    // [j+1+(s-1)b,j+1+(s+2)b), so step s of sweep j+g may proceed as soon as
+    // step s+3 of sweep j has completed
+    const Int waveSize = 8;
+    const Int waveLag = 4;
+    for( Int j0=0; j0<n-1; j0+=waveSize )
+    {
+        const Int numSweeps = Min(waveSize,n-1-j0);
+        const Int numWaveSteps =
+          NumBulgeSteps(n,b,j0) + waveLag*(numSweeps-1);
+        for( Int t=0; t<numWaveSteps; ++t )
+        {
+            for( Int g=0; g<numSweeps; ++g )
+            {
+                const Int s = t - waveLag*g;
+                if( s >= 0 && s < NumBulgeSteps(n,b,j0+g) )
+                    step( j0+g, s );
+            }
+        }
+    }
+}
+
+// Apply the bulge-chasing reflectors from the specified side of B, where,
+// as each step of the chase replaced A with H A H^H, their product is
+// Q2 = H_0^H H_1^H ... H_{k-1}^H.
+//
+// Within a block of (at most b) consecutive sweeps, the reflector of step s
+// of a sweep only overlaps those of steps s and s+1 of the preceding sweeps,
+// so applying the steps from last to first, and the sweeps of each step from
+// first to last, preserves the relative order of all overlapping reflectors.
+// The reflectors of each step of a block then form a staircase whose product
+// is applied in compact WY form (and the reverse order is used for the
+// reverse product). Every process of bulgeReflectors.comm must participate,
+// as each block of reflectors is broadcast from the process storing it.
+template<typename F>
+void ApplyBulgeReflectors
+( LeftOrRight side,
+  Orientation orientation,
+  const BulgeReflectors<F>& bulgeReflectors,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const bool onLeft = ( side == LEFT );
+    const bool normal = ( orientation == NORMAL );
+    const bool forward = ( onLeft != normal );
+    const Int n = ( onLeft ? B.Height() : B.Width() );
+    const Int b = bulgeReflectors.bandwidth;
+    const mpi::Comm comm = bulgeReflectors.comm;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    vector<Int> sweepOffsets;
+    LocalBulgeSweepOffsets( n, b, commRank, commSize, sweepOffsets );
+    EL_DEBUG_ONLY(
+      vector<Int> checkOffsets;
+      const Int numLocalReflectors =
+        LocalBulgeSweepOffsets( n, b, commRank, commSize, checkOffsets );
+      if( bulgeReflectors.V.Width() != numLocalReflectors )
+          LogicError
+          ("Expected ",numLocalReflectors," bulge reflectors but there were ",
+           bulgeReflectors.V.Width());
+    )
+
+    // If the product of the reflectors of a step, in the order that they are
+    // applied, is I - V inv(SInv) V^H when the diagonal of SInv is the
+    // inverse of their scalars, then it is the adjoint of I - V inv(SInv) V^H
+    // when the diagonal is the inverse of their conjugates
+    const bool adjoint = ( onLeft == forward );
+    const Orientation SInvOrient = ( adjoint ? ADJOINT : NORMAL );
+
+    const Int numBlocks = ( n > 1 ? (n-2)/b+1 : 0 );
+    vector<Int> blockOffsets;
+    Matrix<F> VBlock, blockScalars, V, SInv, Z;
+    for( Int blockIter=0; blockIter<numBlocks; ++blockIter )
+    {
+        const Int block = ( forward ? blockIter : numBlocks-1-blockIter );
+        const Int jBeg = block*b;
+        const Int jEnd = Min(jBeg+b,n-1);
+        const int owner = block % commSize;
+
+        blockOffsets.resize( jEnd-jBeg );
+        Int numBlockReflectors = 0;
+        for( Int j=jBeg; j<jEnd; ++j )
+        {
+            blockOffsets[j-jBeg] = numBlockReflectors;
+            numBlockReflectors += NumBulgeSteps( n, b, j );
+        }
+        if( commRank == owner )
+        {
+            const Range<Int>
+              ind( sweepOffsets[jBeg], sweepOffsets[jBeg]+numBlockReflectors );
+            VBlock = bulgeReflectors.V( ALL, ind );
+            blockScalars = bulgeReflectors.householderScalars( ind, ALL );
+        }
+        else
+        {
+            VBlock.Resize( b, numBlockReflectors );
+            blockScalars.Resize( numBlockReflectors, 1 );
+        }
+        Broadcast( VBlock, comm, owner );
+        Broadcast( blockScalars, comm, owner );
+
+        const Int numSteps = NumBulgeSteps( n, b, jBeg );
+        for( Int sIter=0; sIter<numSteps; ++sIter )
+        {
+            const Int s = ( forward ? numSteps-1-sIter : sIter );
+
+            // Sweep jBeg+c acts upon the indices beginning at r+c
+            Int numSweeps = 0;
+            while( jBeg+numSweeps < jEnd &&
+                   NumBulgeSteps(n,b,jBeg+numSweeps) > s )
+                ++numSweeps;
+            const Int r = jBeg+1+s*b;
+            const Int height = Min(b+numSweeps-1,n-r);
+            Zeros( V, height, numSweeps );
+            for( Int c=0; c<numSweeps; ++c )
+            {
+                const Int k = blockOffsets[c] + s;
+                const Int L = Min(b,n-(r+c));
+                for( Int i=0; i<L; ++i )
+                    V(c+i,c) = VBlock(i,k);
+            }
+            Herk( UPPER, ADJOINT, Base<F>(1), V, SInv );
+            for( Int c=0; c<numSweeps; ++c )
+            {
+                const F tau = blockScalars(blockOffsets[c]+s);
+                const F gamma = ( normal ? Conj(tau) : tau );
+                SInv(c,c) = F(1) / ( adjoint ? Conj(gamma) : gamma );
+            }
+
+            if( onLeft )
+            {
+                auto BR = B( IR(r,r+height), ALL );
+                Gemm( ADJOINT, NORMAL, F(1), V, BR, Z );
+                Trsm( LEFT, UPPER, SInvOrient, NON_UNIT, F(1), SInv, Z );
+                Gemm( NORMAL, NORMAL, F(-1), V, Z, F(1), BR );
+            }
+            else
+            {
+                auto BR = B( ALL, IR(r,r+height) );
+                Gemm( NORMAL, NORMAL, F(1), BR, V, Z );
+                Trsm( RIGHT, UPPER, SInvOrient, NON_UNIT, F(1), SInv, Z );
+                Gemm( NORMAL, ADJOINT, F(-1), Z, V, F(1), BR );
+            }
+        }
+    }
+}
+
+template<typename F>
+void ApplyBulgeReflectors
+( LeftOrRight side,
+  Orientation orientation,
+  const BulgeReflectors<F>& bulgeReflectors,
+        AbstractDistMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    // Each process applies every reflector to the entire rows (or columns)
+    // of its portion of B
+    if( side == LEFT )
+    {
+        DistMatrix<F,STAR,VR> B_STAR_VR( B );
+        ApplyBulgeReflectors
+        ( side, orientation, bulgeReflectors, B_STAR_VR.Matrix() );
+        Copy( B_STAR_VR, B );
+    }
+    else
+    {
+        DistMatrix<F,VC,STAR> B_VC_STAR( B );
+        ApplyBulgeReflectors
+        ( side, orientation, bulgeReflectors, B_VC_STAR.Matrix() );
+        Copy( B_VC_STAR, B );
+    }
+}
+
+template<typename F>
+void LowerTwoStage
+( Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  BulgeReflectors<F>* bulgeReflectors,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int b = TwoStageBandwidth( n, bandwidth );
+    LowerBandReduction( A, householderScalars, b );
+    if( bulgeReflectors != nullptr )
+        bulgeReflectors->comm = mpi::COMM_SELF;
+
+    Matrix<F> W;
+    Zeros( W, 3*b, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=j; i<Min(n,j+b+1); ++i )
+            W(i-j,j) = A(i,j);
+
+    ChaseBulges( W, b, bulgeReflectors );
+
+    // Overwrite the band with the tridiagonal matrix
+    for( Int j=0; j<n; ++j )
+    {
+        A(j,j) = W(0,j);
+        for( Int i=j+1; i<Min(n,j+b+1); ++i )
+            A(i,j) = ( i==j+1 ? W(1,j) : F(0) );
+    }
+}
+
+template<typename F>
+void LowerTwoStage
+( DistMatrix<F>& A,
+  DistMatrix<F,STAR,STAR>& householderScalars,
+  BulgeReflectors<F>* bulgeReflectors,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int b = TwoStageBandwidth( n, bandwidth );
+    LowerBandReduction( A, householderScalars, b );
+
+    // Each process chases the bulges out of its own copy of the band, which
+    // only requires O(n b) words of communication, but only stores the
+    // reflectors of its blocks of sweeps
+    if( bulgeReflectors != nullptr )
+        bulgeReflectors->comm = A.DistComm();
+    Matrix<F> band;
+    Zeros( band, b+1, n );
+    const Int localWidth = A.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        const Int iLocBeg = A.LocalRowOffset(j);
+        const Int iLocEnd = A.LocalRowOffset(Min(n,j+b+1));
+        for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+            band(A.GlobalRow(iLoc)-j,j) = A.GetLocal(iLoc,jLoc);
+    }
+    El::AllReduce( band, A.DistComm() );
+
+    Matrix<F> W;
+    Zeros( W, 3*b, n );
+    auto WBand = W( IR(0,b+1), ALL );
+    WBand = band;
+
+    ChaseBulges( W, b, bulgeReflectors );
+
+    // Overwrite the band with the tridiagonal matrix
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        const Int iLocBeg = A.LocalRowOffset(j);
+        const Int iLocEnd = A.LocalRowOffset(Min(n,j+b+1));
+        for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            A.SetLocal( iLoc, jLoc, i-j <= 1 ? W(i-j,j) : F(0) );
+        }
+    }
+}
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  BulgeReflectors<F>* bulgeReflectors,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    if( uplo == LOWER )
+    {
+        LowerTwoStage( A, householderScalars, bulgeReflectors, bandwidth );
+    }
+    else
+    {
+        Matrix<F> AAdj;
+        Adjoint( A, AAdj );
+        LowerTwoStage( AAdj, householderScalars, bulgeReflectors, bandwidth );
+        Adjoint( AAdj, A );
+    }
+}
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  DistMatrix<F>& A,
+  DistMatrix<F,STAR,STAR>& householderScalars,
+  BulgeReflectors<F>* bulgeReflectors,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    if( uplo == LOWER )
+    {
+        LowerTwoStage( A, householderScalars, bulgeReflectors, bandwidth );
+    }
+    else
+    {
+        DistMatrix<F> AAdj( A.Grid() );
+        Adjoint( A, AAdj );
+        LowerTwoStage( AAdj, householderScalars, bulgeReflectors, bandwidth );
+        Adjoint( AAdj, A );
+    }
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
@@ -23,7 +23,7 @@ void UpperBlocked( Matrix<F>& A, Matrix<F>& householderScalars )
 
     Matrix<F> UB1, V01, VB1, G11;
 
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Hessenberg",n);
     for( Int k=0; k<n-1; k+=bsize )
     {
         const Int nb = Min(bsize,n-1-k);
@@ -90,7 +90,8 @@ void UpperBlocked
     DistMatrix<F,MR,STAR> UB1_MR_STAR(g), V21_MR_STAR(g);
     DistMatrix<F,STAR,STAR> G11_STAR_STAR(g);
 
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<F>("Hessenberg",n,A.Grid().Height(),A.Grid().Width());
     for( Int k=0; k<n-1; k+=bsize )
     {
         const Int nb = Min(bsize,n-1-k);
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 
+#include "./LookAhead.hpp"
 #include "./Cholesky/LowerVariant3.hpp"
 #include "./Cholesky/UpperVariant3.hpp"
 #include "./Cholesky/ReverseLowerVariant3.hpp"
@@ -100,6 +101,13 @@ void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack )
     {
         cholesky::ScaLAPACKHelper( uplo, A );
     }
+    else if( LookAheadDepth() > 0 )
+    {
+        if( uplo == LOWER )
+            cholesky::LowerVariant3LookAhead( A, LookAheadDepth() );
+        else
+            cholesky::UpperVariant3LookAhead( A, LookAheadDepth() );
+    }
     else
     {
         if( uplo == LOWER )
@@ -49,7 +49,7 @@ void LowerVariant3Blocked( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Cholesky",n);
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -87,7 +87,8 @@ void LowerVariant3Blocked( AbstractDistMatrix<F>& APre )
     DistMatrix<F,STAR,MR  > A21Adj_STAR_MR(grid);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<F>("Cholesky",n,A.Grid().Height(),A.Grid().Width());
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -125,6 +126,122 @@ void LowerVariant3Blocked( AbstractDistMatrix<F>& APre )
     }
 }
 
+// Look-ahead version of LowerVariant3Blocked
+// ==========================================
+// Up to 'depth' panels are factored ahead of the trailing updates: the
+// columns of the next panel are brought up to date first, the panel is
+// factored, and the (non-blocking) gathers of the new panel into [MC,* ] and
+// [MR,* ] are started before the remainder of the oldest trailing update is
+// performed.
+template<typename F>
+void LowerVariant3LookAhead( AbstractDistMatrix<F>& APre, Int depth )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Grid& grid = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(grid);
+    DistMatrix<F,VC,  STAR> A21_VC_STAR(grid);
+    DistMatrix<F,VR,  STAR> A21_VR_STAR(grid);
+
+    // A factored panel, L21, whose trailing update has only been applied to
+    // the columns before 'updated'
+    struct Panel
+    {
+        Int begin, end, updated;
+        bool gathered=false;
+        DistMatrix<F,MC,STAR> L21_MC_STAR;
+        DistMatrix<F,MR,STAR> L21_MR_STAR;
+        lookahead::PanelGather<F> gatherMC, gatherMR;
+
+        Panel( const Grid& grid ) : L21_MC_STAR(grid), L21_MR_STAR(grid) { }
+    };
+    std::deque<unique_ptr<Panel>> panels;
+
+    const Int n = A.Height();
+    auto update = [&]( Panel& panel, Int colEnd )
+    {
+        if( !panel.gathered )
+        {
+            panel.gatherMC.Finish();
+            panel.gatherMR.Finish();
+            panel.gathered = true;
+        }
+        const Int c0 = panel.updated;
+        if( c0 >= colEnd )
+            return;
+        const Range<Int> indL0( c0-panel.end, colEnd-panel.end ),
+                         indL1( colEnd-panel.end, END );
+        auto L0_MC_STAR = panel.L21_MC_STAR( indL0, ALL );
+        auto L0_MR_STAR = panel.L21_MR_STAR( indL0, ALL );
+        auto L1_MC_STAR = panel.L21_MC_STAR( indL1, ALL );
+        auto A00 = A( IR(c0,colEnd), IR(c0,colEnd) );
+        auto A10 = A( IR(colEnd,n),  IR(c0,colEnd) );
+        LocalTrrk
+        ( LOWER, ADJOINT, F(-1), L0_MC_STAR, L0_MR_STAR, F(1), A00 );
+        LocalGemm
+        ( NORMAL, ADJOINT, F(-1), L1_MC_STAR, L0_MR_STAR, F(1), A10 );
+        panel.updated = colEnd;
+    };
+
+    const Int bsize =
+      Blocksize<F>("Cholesky",n,A.Grid().Height(),A.Grid().Width());
+    Int k = 0;
+    while( k < n || !panels.empty() )
+    {
+        if( k < n && Int(panels.size()) <= depth )
+        {
+            const Int nb = Min(bsize,n-k);
+            for( auto& panel : panels )
+                update( *panel, k+nb );
+
+            const Range<Int> ind1( k,    k+nb ),
+                             ind2( k+nb, n    );
+
+            auto A11 = A( ind1, ind1 );
+            auto A21 = A( ind2, ind1 );
+            auto A22 = A( ind2, ind2 );
+
+            A11_STAR_STAR = A11;
+            Cholesky( LOWER, A11_STAR_STAR );
+            A11 = A11_STAR_STAR;
+
+            A21_VC_STAR.AlignWith( A22 );
+            A21_VC_STAR = A21;
+            LocalTrsm
+            ( RIGHT, LOWER, ADJOINT, NON_UNIT,
+              F(1), A11_STAR_STAR, A21_VC_STAR );
+            A21_VR_STAR.AlignWith( A22 );
+            A21_VR_STAR = A21_VC_STAR;
+
+            unique_ptr<Panel> panel( new Panel(grid) );
+            panel->begin = k;
+            panel->end = k+nb;
+            panel->updated = k+nb;
+            panel->L21_MC_STAR.AlignWith( A22 );
+            panel->L21_MR_STAR.AlignWith( A22 );
+            panel->gatherMC.Start( A21_VC_STAR, panel->L21_MC_STAR );
+            panel->gatherMR.Start( A21_VR_STAR, panel->L21_MR_STAR );
+            panels.push_back( std::move(panel) );
+            k += nb;
+        }
+        else
+        {
+            auto& panel = *panels.front();
+            update( panel, n );
+            auto A21 = A( IR(panel.end,n), IR(panel.begin,panel.end) );
+            A21 = panel.L21_MC_STAR;
+            panels.pop_front();
+        }
+    }
+}
+
 } // namespace cholesky
 } // namespace El
 
@@ -54,7 +54,7 @@ void UpperVariant3Blocked( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Cholesky",n);
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -91,7 +91,8 @@ void UpperVariant3Blocked( AbstractDistMatrix<F>& APre )
     DistMatrix<F,STAR,MR  > A12_STAR_MR(grid);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<F>("Cholesky",n,A.Grid().Height(),A.Grid().Width());
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -122,6 +123,119 @@ void UpperVariant3Blocked( AbstractDistMatrix<F>& APre )
     }
 }
 
+// Look-ahead version of UpperVariant3Blocked
+// ==========================================
+// See LowerVariant3LookAhead; here the panels are the rows U12, which are
+// gathered into [* ,MC] and [* ,MR].
+template<typename F>
+void UpperVariant3LookAhead( AbstractDistMatrix<F>& APre, Int depth )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Grid& grid = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(grid);
+    DistMatrix<F,STAR,VR  > A12_STAR_VR(grid);
+    DistMatrix<F,STAR,VC  > A12_STAR_VC(grid);
+
+    // A factored panel, U12, whose trailing update has only been applied to
+    // the rows before 'updated'
+    struct Panel
+    {
+        Int begin, end, updated;
+        bool gathered=false;
+        DistMatrix<F,STAR,MC> U12_STAR_MC;
+        DistMatrix<F,STAR,MR> U12_STAR_MR;
+        lookahead::PanelGather<F> gatherMC, gatherMR;
+
+        Panel( const Grid& grid ) : U12_STAR_MC(grid), U12_STAR_MR(grid) { }
+    };
+    std::deque<unique_ptr<Panel>> panels;
+
+    const Int n = A.Height();
+    auto update = [&]( Panel& panel, Int rowEnd )
+    {
+        if( !panel.gathered )
+        {
+            panel.gatherMC.Finish();
+            panel.gatherMR.Finish();
+            panel.gathered = true;
+        }
+        const Int r0 = panel.updated;
+        if( r0 >= rowEnd )
+            return;
+        const Range<Int> indU0( r0-panel.end, rowEnd-panel.end ),
+                         indU1( rowEnd-panel.end, END );
+        auto U0_STAR_MC = panel.U12_STAR_MC( ALL, indU0 );
+        auto U0_STAR_MR = panel.U12_STAR_MR( ALL, indU0 );
+        auto U1_STAR_MR = panel.U12_STAR_MR( ALL, indU1 );
+        auto A00 = A( IR(r0,rowEnd), IR(r0,rowEnd) );
+        auto A01 = A( IR(r0,rowEnd), IR(rowEnd,n)  );
+        LocalTrrk
+        ( UPPER, ADJOINT, F(-1), U0_STAR_MC, U0_STAR_MR, F(1), A00 );
+        LocalGemm
+        ( ADJOINT, NORMAL, F(-1), U0_STAR_MC, U1_STAR_MR, F(1), A01 );
+        panel.updated = rowEnd;
+    };
+
+    const Int bsize =
+      Blocksize<F>("Cholesky",n,A.Grid().Height(),A.Grid().Width());
+    Int k = 0;
+    while( k < n || !panels.empty() )
+    {
+        if( k < n && Int(panels.size()) <= depth )
+        {
+            const Int nb = Min(bsize,n-k);
+            for( auto& panel : panels )
+                update( *panel, k+nb );
+
+            const Range<Int> ind1( k,    k+nb ),
+                             ind2( k+nb, n    );
+
+            auto A11 = A( ind1, ind1 );
+            auto A12 = A( ind1, ind2 );
+            auto A22 = A( ind2, ind2 );
+
+            A11_STAR_STAR = A11;
+            Cholesky( UPPER, A11_STAR_STAR );
+            A11 = A11_STAR_STAR;
+
+            A12_STAR_VR.AlignWith( A22 );
+            A12_STAR_VR = A12;
+            LocalTrsm
+            ( LEFT, UPPER, ADJOINT, NON_UNIT,
+              F(1), A11_STAR_STAR, A12_STAR_VR );
+            A12_STAR_VC.AlignWith( A22 );
+            A12_STAR_VC = A12_STAR_VR;
+
+            unique_ptr<Panel> panel( new Panel(grid) );
+            panel->begin = k;
+            panel->end = k+nb;
+            panel->updated = k+nb;
+            panel->U12_STAR_MC.AlignWith( A22 );
+            panel->U12_STAR_MR.AlignWith( A22 );
+            panel->gatherMC.Start( A12_STAR_VC, panel->U12_STAR_MC );
+            panel->gatherMR.Start( A12_STAR_VR, panel->U12_STAR_MR );
+            panels.push_back( std::move(panel) );
+            k += nb;
+        }
+        else
+        {
+            auto& panel = *panels.front();
+            update( panel, n );
+            auto A12 = A( IR(panel.begin,panel.end), IR(panel.end,n) );
+            A12 = panel.U12_STAR_MR;
+            panels.pop_front();
+        }
+    }
+}
+
 } // namespace cholesky
 } // namespace El
 
@@ -23,14 +23,24 @@
 #ifndef EL_LDL_PROCESS_HPP
 #define EL_LDL_PROCESS_HPP
 
+#include <algorithm>
+#include <exception>
+#include <set>
+
 #include "./ProcessFront.hpp"
 
 namespace El {
 namespace ldl {
 
+// If 'factoredSubtrees' is non-null, then the subtrees rooted at its members
+// are assumed to have already been processed, and only their updates are
+// accumulated into their parents
 template<typename Field>
 void Process
-( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType )
+( const NodeInfo& info,
+  Front<Field>& front,
+  LDLFrontType factorType,
+  const std::set<const NodeInfo*>* factoredSubtrees=nullptr )
 {
     EL_DEBUG_CSE
     const int updateSize = info.lowerStruct.size();
@@ -123,7 +133,11 @@ void Process
         const int numChildren = info.children.size();
         for( Int c=0; c<numChildren; ++c )
         {
-            Process( *info.children[c], *front.children[c], factorType );
+            if( factoredSubtrees == nullptr ||
+                !factoredSubtrees->count(info.children[c].get()) )
+                Process
+                ( *info.children[c], *front.children[c], factorType,
+                  factoredSubtrees );
 
             auto& childU = front.children[c]->workDense;
             const int childUSize = childU.Height();
@@ -146,6 +160,131 @@ void Process
     }
 }
 
+// A rough estimate of the number of flops required to factor each subtree
+inline double SubtreeWork
+( const NodeInfo& info, std::map<const NodeInfo*,double>& work )
+{
+    const double n = info.size;
+    const double m = info.lowerStruct.size();
+    double subtreeWork = n*n*n/3 + n*n*m + n*m*m;
+    for( const auto& child : info.children )
+        subtreeWork += SubtreeWork( *child, work );
+    work[&info] = subtreeWork;
+    return subtreeWork;
+}
+
+// Shared-memory task parallelism
+// ===============================
+// The elimination tree is split into independent subtrees by repeatedly
+// replacing the most expensive subtree with its children until there are
+// several subtrees per thread and none is much more expensive than the
+// average. The subtrees are then factored by OpenMP tasks (whose runtimes
+// balance the load with work stealing) using sequential dense kernels, and
+// the remaining top of the tree is factored by the master thread outside of
+// the parallel region so that its large fronts make use of threaded BLAS.
+//
+// Without EL_HYBRID, or from within an existing parallel region, this is
+// equivalent to Process.
+template<typename Field>
+void ThreadedProcess
+( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HYBRID
+    const int numThreads = omp_get_max_threads();
+    if( numThreads == 1 || omp_in_parallel() || info.children.empty() )
+    {
+        Process( info, front, factorType );
+        return;
+    }
+
+    struct Subtree
+    {
+        const NodeInfo* info;
+        Front<Field>* front;
+        double work;
+    };
+    std::map<const NodeInfo*,double> work;
+    const double totalWork = SubtreeWork( info, work );
+    const Int targetNumSubtrees = 4*numThreads;
+    vector<Subtree> subtrees( 1, Subtree{&info,&front,totalWork} );
+    while( true )
+    {
+        auto heaviest = std::max_element
+          ( subtrees.begin(), subtrees.end(),
+            []( const Subtree& a, const Subtree& b )
+            { return a.work < b.work; } );
+        if( heaviest->info->children.empty() )
+            break;
+        if( Int(subtrees.size()) >= targetNumSubtrees &&
+            heaviest->work <= 2*totalWork/targetNumSubtrees )
+            break;
+
+        const Subtree parent = *heaviest;
+        subtrees.erase( heaviest );
+        const Int numChildren = parent.info->children.size();
+        for( Int c=0; c<numChildren; ++c )
+        {
+            const NodeInfo* childInfo = parent.info->children[c].get();
+            subtrees.push_back
+            ( Subtree{childInfo,parent.front->children[c].get(),
+                      work[childInfo]} );
+        }
+    }
+    if( subtrees.size() == 1 )
+    {
+        Process( info, front, factorType );
+        return;
+    }
+    std::sort
+    ( subtrees.begin(), subtrees.end(),
+      []( const Subtree& a, const Subtree& b ) { return a.work > b.work; } );
+
+    // Each task calls the BLAS with a single thread, and the previous number
+    // of BLAS threads is restored for the top of the tree
+    const int numBlasThreads = blas::GetNumThreads();
+    blas::SetNumThreads( 1 );
+
+    // Exceptions cannot propagate out of a task, so the first is rethrown
+    // after the parallel region
+    std::exception_ptr exception;
+    #pragma omp parallel
+    {
+        #pragma omp single
+        {
+            for( const auto& subtree : subtrees )
+            {
+                #pragma omp task firstprivate(subtree)
+                {
+                    try
+                    {
+                        Process( *subtree.info, *subtree.front, factorType );
+                    }
+                    catch( ... )
+                    {
+                        #pragma omp critical
+                        {
+                            if( !exception )
+                                exception = std::current_exception();
+                        }
+                    }
+                }
+            }
+        }
+    }
+    blas::SetNumThreads( numBlasThreads );
+    if( exception )
+        std::rethrow_exception( exception );
+
+    std::set<const NodeInfo*> factoredSubtrees;
+    for( const auto& subtree : subtrees )
+        factoredSubtrees.insert( subtree.info );
+    Process( info, front, factorType, &factoredSubtrees );
+#else
+    Process( info, front, factorType );
+#endif
+}
+
 template<typename Field>
 void Process
 ( const DistNodeInfo& info, DistFront<Field>& front, LDLFrontType factorType )
@@ -158,7 +297,7 @@ void Process
         const Grid& grid = info.Grid();
         auto& frontDup = *front.duplicate;
 
-        Process( *info.duplicate, frontDup, factorType );
+        ThreadedProcess( *info.duplicate, frontDup, factorType );
 
         // Pull the relevant information up from the duplicate
         front.type = frontDup.type;
@@ -115,7 +115,7 @@ void SparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
     ChangeFrontType( SYMM_2D );
     
     // Perform the initial factorization
-    ldl::Process( *info_, *front_, InitialFactorType(frontType) );
+    ldl::ThreadedProcess( *info_, *front_, InitialFactorType(frontType) );
     factored_ = true;
     
     // Convert the fronts from the initial factorization to the requested form
@@ -0,0 +1,143 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+// The number of entries in the lower-trapezoidal factor of a dense front with
+// 'size' pivots and 'lowerSize' update indices
+inline double FrontEntries( double size, double lowerSize )
+{ return size*(size+1)/2 + size*lowerSize; }
+
+// The (real) flop count of the dense factorization of such a front
+inline double FrontFlops( double size, double lowerSize )
+{ return size*size*size/3 + size*size*lowerSize + size*lowerSize*lowerSize; }
+
+void AccumulateFronts
+( const NodeInfo& node, Int& numFronts, double& numEntries, double& numFlops )
+{
+    for( const auto& child : node.children )
+        AccumulateFronts( *child, numFronts, numEntries, numFlops );
+    const Int lowerSize = node.lowerStruct.size();
+    ++numFronts;
+    numEntries += FrontEntries( node.size, lowerSize );
+    numFlops += FrontFlops( node.size, lowerSize );
+}
+
+} // anonymous namespace
+
+// Relaxed supernode amalgamation
+// ==============================
+// Since nested dissection orders the last child of each node immediately
+// before the node itself, the last child may be merged into its parent while
+// keeping the indices of each front contiguous. The grandchildren are then
+// adopted by the merged front, so that the process may continue with the
+// last of them.
+//
+// As the update indices of a child are a subset of the indices of its parent's
+// front, the merged front has the same lower structure as the parent, and
+// the number of explicit zeros introduced by the merge follows from the front
+// sizes alone.
+//
+// See Ashcraft and Grimes, "The influence of relaxed supernode partitions on
+// the multifrontal method", ACM Trans. Math. Softw., 15(4), 1989.
+AmalgamationInfo Amalgamate
+( Separator& rootSep, NodeInfo& rootInfo, const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    AmalgamationInfo amalgInfo;
+    AccumulateFronts
+    ( rootInfo, amalgInfo.numFrontsBefore,
+      amalgInfo.numEntriesBefore, amalgInfo.numFlopsBefore );
+
+    // The number of explicit zeros stored within each (merged) front
+    std::map<const NodeInfo*,double> numZeros;
+
+    function<void(Separator&,NodeInfo&)> amalgamate =
+      [&]( Separator& sep, NodeInfo& node )
+      {
+        const Int numOrigChildren = node.children.size();
+        for( Int c=0; c<numOrigChildren; ++c )
+            amalgamate( *sep.children[c], *node.children[c] );
+
+        const Int lowerSize = node.lowerStruct.size();
+        double nodeZeros = numZeros[&node];
+        while( !node.children.empty() )
+        {
+            NodeInfo& child = *node.children.back();
+            Separator& childSep = *sep.children.back();
+            if( child.off+child.size != node.off )
+                break;
+            // Fronts without children are factored as sparse leaves using
+            // the symbolic factorization of their original structure, so we
+            // do not allow a merged front to become a leaf
+            if( node.children.size() == 1 && child.children.empty() )
+                break;
+
+            const Int mergedSize = node.size + child.size;
+            const double mergedEntries = FrontEntries( mergedSize, lowerSize );
+            const double mergedZeros =
+              nodeZeros + numZeros[&child] + mergedEntries -
+              FrontEntries( node.size, lowerSize ) -
+              FrontEntries( child.size, child.lowerStruct.size() );
+            if( mergedSize > ctrl.relaxedSize &&
+                mergedZeros > ctrl.fillTolerance*mergedEntries )
+                break;
+
+            // The original connections of the child to our indices are now
+            // within the diagonal block of the merged front
+            const Int nodeEnd = node.off + node.size;
+            vector<Int> childOrigLowerStruct;
+            for( const Int& i : child.origLowerStruct )
+                if( i >= nodeEnd )
+                    childOrigLowerStruct.push_back( i );
+            node.origLowerStruct =
+              Union( node.origLowerStruct, childOrigLowerStruct );
+            node.off = child.off;
+            node.size = mergedSize;
+            nodeZeros = mergedZeros;
+
+            vector<Int> mergedInds( childSep.inds );
+            mergedInds.insert
+            ( mergedInds.end(), sep.inds.begin(), sep.inds.end() );
+            sep.inds = std::move(mergedInds);
+            sep.off = childSep.off;
+
+            // Adopt the grandchildren
+            numZeros.erase( &child );
+            unique_ptr<NodeInfo> childPtr = std::move(node.children.back());
+            unique_ptr<Separator> childSepPtr = std::move(sep.children.back());
+            node.children.pop_back();
+            sep.children.pop_back();
+            const Int numGrandchildren = childPtr->children.size();
+            for( Int c=0; c<numGrandchildren; ++c )
+            {
+                childPtr->children[c]->parent = &node;
+                childSepPtr->children[c]->parent = &sep;
+                node.children.emplace_back
+                ( std::move(childPtr->children[c]) );
+                sep.children.emplace_back
+                ( std::move(childSepPtr->children[c]) );
+            }
+        }
+        numZeros[&node] = nodeZeros;
+      };
+    amalgamate( rootSep, rootInfo );
+
+    AccumulateFronts
+    ( rootInfo, amalgInfo.numFrontsAfter,
+      amalgInfo.numEntriesAfter, amalgInfo.numFlopsAfter );
+    return amalgInfo;
+}
+
+} // namespace ldl
+} // namespace El
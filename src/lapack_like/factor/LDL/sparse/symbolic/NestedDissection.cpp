@@ -387,6 +387,26 @@ NestedDissectionRecursion
     }
 }
 
+inline void
+PrintAmalgamation( const AmalgamationInfo& amalgInfo, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    vector<double> counts(6);
+    counts[0] = amalgInfo.numFrontsBefore;
+    counts[1] = amalgInfo.numFrontsAfter;
+    counts[2] = amalgInfo.numEntriesBefore;
+    counts[3] = amalgInfo.numEntriesAfter;
+    counts[4] = amalgInfo.numFlopsBefore;
+    counts[5] = amalgInfo.numFlopsAfter;
+    mpi::AllReduce( counts.data(), 6, comm );
+    OutputFromRoot
+    (comm,"Relaxed supernodes reduced the number of sequential fronts from ",
+     counts[0]," to ",counts[1],", changing the number of dense factor "
+     "entries from ",counts[2]," to ",counts[3]," (",
+     100*(counts[3]/Max(counts[2],1.)-1),"%) and the number of flops from ",
+     counts[4]," to ",counts[5]," (",100*(counts[5]/Max(counts[4],1.)-1),"%)");
+}
+
 void NestedDissection
 ( const Graph& graph,
         vector<Int>& map,
@@ -402,6 +422,13 @@ void NestedDissection
         perm[s] = s;
 
     NestedDissectionRecursion( graph, perm, sep, info, 0, ctrl );
+    if( ctrl.relaxSupernodes )
+    {
+        Analysis( info );
+        const auto amalgInfo = Amalgamate( sep, info, ctrl );
+        if( ctrl.progress )
+            PrintAmalgamation( amalgInfo, mpi::COMM_SELF );
+    }
 
     // Construct the distributed reordering
     sep.BuildMap( map );
@@ -428,6 +455,29 @@ void NestedDissection
 
     info.SetRootGrid( graph.Grid() );
     NestedDissectionRecursion( graph, perm, sep, info, 0, ctrl );
+    if( ctrl.relaxSupernodes )
+    {
+        // Only the sequential subtrees are amalgamated, and the results are
+        // pulled up into the bottom distributed node
+        DistNodeInfo* node = &info;
+        DistSeparator* nodeSep = &sep;
+        while( node->child != nullptr )
+        {
+            node = node->child.get();
+            nodeSep = nodeSep->child.get();
+        }
+        auto& dupNode = *node->duplicate;
+        auto& dupSep = *nodeSep->duplicate;
+        Analysis( dupNode );
+        const auto amalgInfo = Amalgamate( dupSep, dupNode, ctrl );
+        nodeSep->off = dupSep.off;
+        nodeSep->inds = dupSep.inds;
+        node->size = dupNode.size;
+        node->off = dupNode.off;
+        node->origLowerStruct = dupNode.origLowerStruct;
+        if( ctrl.progress )
+            PrintAmalgamation( amalgInfo, graph.Grid().Comm() );
+    }
 
     // Construct the distributed reordering
     sep.BuildMap( info, map );
@@ -10,6 +10,9 @@
 
 #include "./LU/Local.hpp"
 #include "./LU/Panel.hpp"
+#include "./LU/Tournament.hpp"
+#include "./LookAhead.hpp"
+#include "./LU/LookAhead.hpp"
 #include "./LU/Full.hpp"
 #include "./LU/Mod.hpp"
 #include "./LU/SolveAfter.hpp"
@@ -22,10 +25,11 @@ template<typename F>
 void LU( Matrix<F>& A )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("LU")
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("LU",minDim);
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -47,6 +51,7 @@ template<typename F>
 void LU( AbstractDistMatrix<F>& APre )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("LU")
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
@@ -60,7 +65,8 @@ void LU( AbstractDistMatrix<F>& APre )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<F>("LU",minDim,A.Grid().Height(),A.Grid().Width());
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -105,11 +111,12 @@ template<typename F>
 void LU( Matrix<F>& A, Permutation& P )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("LU")
 
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("LU",minDim);
 
     P.MakeIdentity( m );
     P.ReserveSwaps( minDim );
@@ -148,13 +155,34 @@ void LU
   Permutation& Q )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("LU")
     lu::Full( A, P, Q );
 }
 
+template<typename F>
+void LU( Matrix<F>& A, Permutation& P, const LUCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.pivotType != LU_PARTIAL && ctrl.pivotType != LU_TOURNAMENT )
+        LogicError("Expected either partial or tournament pivoting");
+    LU( A, P );
+}
+
 template<typename F>
 void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
 {
     EL_DEBUG_CSE
+    LU( APre, P, LUCtrl() );
+}
+
+template<typename F>
+void LU
+( AbstractDistMatrix<F>& APre, DistPermutation& P, const LUCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("LU")
+    if( ctrl.pivotType != LU_PARTIAL && ctrl.pivotType != LU_TOURNAMENT )
+        LogicError("Expected either partial or tournament pivoting");
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
@@ -173,10 +201,20 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
     P.MakeIdentity( m );
     P.ReserveSwaps( minDim );
 
+    if( LookAheadDepth() > 0 )
+    {
+        lu::LookAhead( A, P, ctrl );
+        return;
+    }
+
     DistPermutation PB(g);
 
-    vector<F> panelBuf, pivotBuf;
-    const Int bsize = Blocksize();
+    // The panel workspace is Memory-backed (unlike the pivot buffer) so
+    // that the memory pool can attribute its allocations to the panel
+    Matrix<F> panelBuf;
+    vector<F> pivotBuf;
+    const Int bsize =
+      Blocksize<F>("LU",minDim,A.Grid().Height(),A.Grid().Width());
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -189,17 +227,24 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
 
         auto AB  = A( indB, ALL );
 
-        const Int A21Height = A21.Height();
-        const Int A21LocHeight = A21.LocalHeight();
-        const Int panelLDim = nb+A21LocHeight;
-        FastResize( panelBuf, panelLDim*nb );
-        A11_STAR_STAR.Attach
-        ( nb, nb, g, 0, 0, &panelBuf[0], panelLDim, 0 );
-        A21_MC_STAR.Attach
-        ( A21Height, nb, g, A21.ColAlign(), 0, &panelBuf[nb], panelLDim, 0 );
-        A11_STAR_STAR = A11;
-        A21_MC_STAR = A21;
-        lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
+        {
+            EL_ALLOCATION_SITE("LU panel")
+            const Int A21Height = A21.Height();
+            const Int A21LocHeight = A21.LocalHeight();
+            const Int panelLDim = nb+A21LocHeight;
+            panelBuf.Resize( panelLDim*nb, 1 );
+            A11_STAR_STAR.Attach
+            ( nb, nb, g, 0, 0, panelBuf.Buffer(), panelLDim, 0 );
+            A21_MC_STAR.Attach
+            ( A21Height, nb, g, A21.ColAlign(), 0,
+              panelBuf.Buffer()+nb, panelLDim, 0 );
+            A11_STAR_STAR = A11;
+            A21_MC_STAR = A21;
+            if( ctrl.pivotType == LU_TOURNAMENT )
+                lu::TournamentPanel( A11_STAR_STAR, A21_MC_STAR, P, PB, k );
+            else
+                lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
+        }
 
         PB.PermuteRows( AB );
 
@@ -227,6 +272,7 @@ void LU
   DistPermutation& Q )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("LU")
     lu::Full( A, P, Q );
 }
 
@@ -241,6 +287,14 @@ void LU
   ( AbstractDistMatrix<F>& A, \
     DistPermutation& P ); \
   template void LU \
+  ( Matrix<F>& A, \
+    Permutation& P, \
+    const LUCtrl& ctrl ); \
+  template void LU \
+  ( AbstractDistMatrix<F>& A, \
+    DistPermutation& P, \
+    const LUCtrl& ctrl ); \
+  template void LU \
   ( Matrix<F>& A, \
     Permutation& P, \
     Permutation& Q ); \
@@ -0,0 +1,148 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_LOOKAHEAD_HPP
+#define EL_LU_LOOKAHEAD_HPP
+
+namespace El {
+namespace lu {
+
+// Right-looking LU with partial (or tournament) pivoting and a look-ahead of
+// a single panel: the columns of the trailing matrix forming the next panel
+// are updated first so that the next panel can be factored while U12 is
+// gathered into [* ,MR] for the update of the remaining columns.
+//
+// Deeper look-ahead would require several panels to be factored before the
+// row swaps of their predecessors were applied, so the depth is limited to
+// one.
+template<typename F>
+void LookAhead
+( DistMatrix<F>& A, DistPermutation& P, const LUCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+
+    // A factored panel; the local buffers of A11[*,*] and A21[MC,*] are
+    // vertically stacked as required by the panel factorizations
+    struct PanelFactors
+    {
+        vector<F> buf;
+        DistMatrix<F,STAR,STAR> A11_STAR_STAR;
+        DistMatrix<F,MC,  STAR> A21_MC_STAR;
+        DistPermutation PB;
+
+        PanelFactors( const Grid& g )
+        : A11_STAR_STAR(g), A21_MC_STAR(g), PB(g) { }
+    };
+    PanelFactors panel0(g), panel1(g);
+    PanelFactors* cur = &panel0;
+    PanelFactors* next = &panel1;
+    vector<F> pivotBuf;
+
+    auto factor = [&]( PanelFactors& panel, Int k, Int nb )
+    {
+        auto A11 = A( IR(k,k+nb), IR(k,k+nb) );
+        auto A21 = A( IR(k+nb,END), IR(k,k+nb) );
+        const Int panelLDim = nb+A21.LocalHeight();
+        FastResize( panel.buf, panelLDim*nb );
+        panel.A11_STAR_STAR.Attach
+        ( nb, nb, g, 0, 0, &panel.buf[0], panelLDim, 0 );
+        panel.A21_MC_STAR.Attach
+        ( A21.Height(), nb, g, A21.ColAlign(), 0, &panel.buf[nb], panelLDim,
+          0 );
+        panel.A11_STAR_STAR = A11;
+        panel.A21_MC_STAR = A21;
+        if( ctrl.pivotType == LU_TOURNAMENT )
+            TournamentPanel
+            ( panel.A11_STAR_STAR, panel.A21_MC_STAR, P, panel.PB, k );
+        else
+            lu::Panel
+            ( panel.A11_STAR_STAR, panel.A21_MC_STAR, P, panel.PB, k,
+              pivotBuf );
+    };
+
+    // Since the trailing update only combines entries within the same row,
+    // the row swaps of the next panel may be applied after the remainder of
+    // the update has completed
+    auto finalize = [&]( PanelFactors& panel, Int k, Int nb )
+    {
+        auto AB = A( IR(k,END), ALL );
+        panel.PB.PermuteRows( AB );
+        A( IR(k,k+nb), IR(k,k+nb) ) = panel.A11_STAR_STAR;
+        A( IR(k+nb,END), IR(k,k+nb) ) = panel.A21_MC_STAR;
+    };
+
+    DistMatrix<F,STAR,VR> A12_STAR_VR(g);
+    DistMatrix<F,STAR,MR> A12Win_STAR_MR(g), A12Rest_STAR_MR(g);
+    lookahead::PanelGather<F> gatherRest;
+
+    const Int bsize =
+      Blocksize<F>("LU",minDim,A.Grid().Height(),A.Grid().Width());
+    if( minDim > 0 )
+    {
+        factor( *cur, 0, Min(bsize,minDim) );
+        finalize( *cur, 0, Min(bsize,minDim) );
+    }
+    for( Int k=0; k<minDim; k+=bsize )
+    {
+        const Int nb = Min(bsize,minDim-k);
+        const Int nbNext = Min(bsize,minDim-(k+nb));
+        const Int kWin = k+nb;
+        const IR ind1( k, k+nb ), ind2( k+nb, END ),
+                 indWin( kWin, kWin+nbNext ), indRest( kWin+nbNext, END );
+
+        auto A12 = A( ind1, ind2 );
+        auto A22 = A( ind2, ind2 );
+        auto A12Win = A( ind1, indWin );
+        auto A12Rest = A( ind1, indRest );
+        auto A22Win = A( ind2, indWin );
+        auto A22Rest = A( ind2, indRest );
+
+        A12_STAR_VR.AlignWith( A22 );
+        A12_STAR_VR = A12;
+        LocalTrsm
+        ( LEFT, LOWER, NORMAL, UNIT, F(1), cur->A11_STAR_STAR, A12_STAR_VR );
+
+        // Begin gathering the portion of U12 outside of the next panel
+        auto A12Rest_STAR_VR = A12_STAR_VR( ALL, IR(nbNext,END) );
+        A12Rest_STAR_MR.AlignWith( A22Rest );
+        gatherRest.Start( A12Rest_STAR_VR, A12Rest_STAR_MR );
+
+        // Update and factor the next panel
+        auto A12Win_STAR_VR = A12_STAR_VR( ALL, IR(0,nbNext) );
+        A12Win_STAR_MR.AlignWith( A22Win );
+        A12Win_STAR_MR = A12Win_STAR_VR;
+        LocalGemm
+        ( NORMAL, NORMAL,
+          F(-1), cur->A21_MC_STAR, A12Win_STAR_MR, F(1), A22Win );
+        A12Win = A12Win_STAR_MR;
+        if( nbNext > 0 )
+            factor( *next, kWin, nbNext );
+
+        // Update the remainder of the trailing matrix
+        gatherRest.Finish();
+        LocalGemm
+        ( NORMAL, NORMAL,
+          F(-1), cur->A21_MC_STAR, A12Rest_STAR_MR, F(1), A22Rest );
+        A12Rest = A12Rest_STAR_MR;
+
+        if( nbNext > 0 )
+        {
+            finalize( *next, kWin, nbNext );
+            std::swap( cur, next );
+        }
+    }
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_LOOKAHEAD_HPP
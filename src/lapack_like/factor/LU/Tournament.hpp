@@ -0,0 +1,219 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_TOURNAMENT_HPP
+#define EL_LU_TOURNAMENT_HPP
+
+namespace El {
+namespace lu {
+
+// Reorder the rows of 'candidates' (and their indices) so that the first
+// Min(height,width) rows are those chosen as pivots by Gaussian elimination
+// with partial pivoting, and then discard the remaining rows. The candidate
+// rows themselves are left unmodified.
+template<typename F>
+void SelectPivotRows( Matrix<F>& candidates, vector<Int>& indices )
+{
+    EL_DEBUG_CSE
+    const Int m = candidates.Height();
+    const Int n = candidates.Width();
+    const Int minDim = Min(m,n);
+    auto W( candidates );
+    F* WBuf = W.Buffer();
+    const Int WLDim = W.LDim();
+    for( Int k=0; k<minDim; ++k )
+    {
+        const Int iPiv = k + blas::MaxInd( m-k, &WBuf[k+k*WLDim], 1 );
+        if( iPiv != k )
+        {
+            blas::Swap( n, &WBuf[k], WLDim, &WBuf[iPiv], WLDim );
+            blas::Swap
+            ( n, candidates.Buffer(k,0), candidates.LDim(),
+                 candidates.Buffer(iPiv,0), candidates.LDim() );
+            std::swap( indices[k], indices[iPiv] );
+        }
+
+        // A zero pivot column is left for the final factorization to report
+        const F alpha = WBuf[k+k*WLDim];
+        if( alpha == F(0) )
+            continue;
+        blas::Scal( m-(k+1), F(1)/alpha, &WBuf[(k+1)+k*WLDim], 1 );
+        blas::Geru
+        ( m-(k+1), n-(k+1),
+          F(-1), &WBuf[(k+1)+k*WLDim], 1, &WBuf[k+(k+1)*WLDim], WLDim,
+                 &WBuf[(k+1)+(k+1)*WLDim], WLDim );
+    }
+    candidates.Resize( minDim, n );
+    indices.resize( minDim );
+}
+
+// Communication-avoiding LU (CALU) panel factorization
+// ====================================================
+// Rather than performing one MaxLoc reduction and one broadcast per column of
+// the panel, the pivot rows of the entire panel are chosen by a 'tournament':
+// each process selects its n best candidate rows with Gaussian elimination
+// with partial pivoting, and the winners are merged pairwise up a binary tree
+// over the process column, then broadcast. Since every process then has the
+// original contents of the winning rows, and the rows displaced from A are
+// all original rows of A (which is replicated), the row swaps require no
+// further communication, and the panel is factored without pivoting.
+//
+// See Grigori, Demmel, and Xiang, "CALU: A communication optimal LU
+// factorization algorithm", SIAM J. Matrix Anal. Appl., 32(4), 2011.
+//
+// NOTE: It is assumed that the local buffers of A[*,*] and B[MC,*] can be
+//       verticially stacked, so that the top-left local entry of B is
+//       the n'th local entry of A[*,*]'s local buffer.
+template<typename F>
+void TournamentPanel
+( DistMatrix<F,  STAR,STAR>& A,
+  DistMatrix<F,  MC,  STAR>& B,
+  DistPermutation& P,
+  DistPermutation& PB,
+  Int offset )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    const Int BLocHeight = B.LocalHeight();
+    const F* BBuf = B.LockedBuffer();
+    const Int BLDim = B.LDim();
+    mpi::Comm colComm = B.ColComm();
+    const int colRank = mpi::Rank( colComm );
+    const int colSize = mpi::Size( colComm );
+    EL_DEBUG_ONLY(
+      AssertSameGrids( A, B );
+      if( n != B.Width() )
+          LogicError("A and B must be the same width");
+      if( A.Buffer()+n != B.Buffer() )
+          LogicError("Buffers of A and B did not properly align");
+    )
+
+    PB.MakeIdentity( A.Height()+B.Height() );
+    PB.ReserveSwaps( n );
+
+    // Each process offers its local rows of B (and the first process row
+    // also offers the rows of A), where rows of B are indexed after A
+    const Int numLocalA = ( colRank == 0 ? n : 0 );
+    Matrix<F> candidates( numLocalA+BLocHeight, n );
+    vector<Int> indices( numLocalA+BLocHeight );
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<numLocalA; ++i )
+            candidates(i,j) = A.GetLocal(i,j);
+        for( Int iLoc=0; iLoc<BLocHeight; ++iLoc )
+            candidates(numLocalA+iLoc,j) = BBuf[iLoc+j*BLDim];
+    }
+    for( Int i=0; i<numLocalA; ++i )
+        indices[i] = i;
+    for( Int iLoc=0; iLoc<BLocHeight; ++iLoc )
+        indices[numLocalA+iLoc] = n + B.GlobalRow(iLoc);
+    SelectPivotRows( candidates, indices );
+
+    // Play the tournament up a binary tree rooted at process row zero. The
+    // messages are of a fixed size, with the number of candidates stored
+    // before their indices.
+    vector<Int> indexBuf( n+1 );
+    vector<F> rowBuf( n*n );
+    auto pack = [&]()
+      {
+        const Int numCand = candidates.Height();
+        indexBuf[0] = numCand;
+        for( Int i=0; i<numCand; ++i )
+            indexBuf[i+1] = indices[i];
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<numCand; ++i )
+                rowBuf[i+j*n] = candidates(i,j);
+      };
+    for( int step=1; step<colSize; step*=2 )
+    {
+        if( colRank % (2*step) == step )
+        {
+            pack();
+            mpi::Send( indexBuf.data(), n+1, colRank-step, colComm );
+            mpi::Send( rowBuf.data(), n*n, colRank-step, colComm );
+            break;
+        }
+        else if( colRank % (2*step) == 0 && colRank+step < colSize )
+        {
+            mpi::Recv( indexBuf.data(), n+1, colRank+step, colComm );
+            mpi::Recv( rowBuf.data(), n*n, colRank+step, colComm );
+            const Int numOld = candidates.Height();
+            const Int numNew = indexBuf[0];
+            Matrix<F> merged( numOld+numNew, n );
+            indices.resize( numOld+numNew );
+            for( Int j=0; j<n; ++j )
+            {
+                for( Int i=0; i<numOld; ++i )
+                    merged(i,j) = candidates(i,j);
+                for( Int i=0; i<numNew; ++i )
+                    merged(numOld+i,j) = rowBuf[i+j*n];
+            }
+            for( Int i=0; i<numNew; ++i )
+                indices[numOld+i] = indexBuf[i+1];
+            candidates = merged;
+            SelectPivotRows( candidates, indices );
+        }
+    }
+    if( colRank == 0 )
+        pack();
+    mpi::Broadcast( indexBuf.data(), n+1, 0, colComm );
+    mpi::Broadcast( rowBuf.data(), n*n, 0, colComm );
+    EL_DEBUG_ONLY(
+      if( indexBuf[0] != n )
+          LogicError("The tournament produced ",indexBuf[0]," winners");
+    )
+
+    // Convert the winners into a sequence of swaps while tracking which
+    // original row occupies each modified position
+    std::map<Int,Int> originalAt, positionOf;
+    for( Int k=0; k<n; ++k )
+    {
+        const Int winner = indexBuf[k+1];
+        auto posIt = positionOf.find( winner );
+        const Int iPiv = ( posIt == positionOf.end() ? winner : posIt->second );
+        P.Swap( k+offset, iPiv+offset );
+        PB.Swap( k, iPiv );
+        if( iPiv != k )
+        {
+            auto origIt = originalAt.find( k );
+            const Int displaced =
+              ( origIt == originalAt.end() ? k : origIt->second );
+            originalAt[k] = winner;
+            originalAt[iPiv] = displaced;
+            positionOf[winner] = k;
+            positionOf[displaced] = iPiv;
+        }
+    }
+
+    // Every displaced row which landed in B was an original row of A
+    auto AOrig( A.LockedMatrix() );
+    for( const auto& entry : originalAt )
+    {
+        const Int relIndex = entry.first - n;
+        if( relIndex >= 0 && B.IsLocalRow(relIndex) )
+        {
+            const Int iLoc = B.LocalRow(relIndex);
+            for( Int j=0; j<n; ++j )
+                B.SetLocal( iLoc, j, AOrig(entry.second,j) );
+        }
+    }
+    for( Int j=0; j<n; ++j )
+        for( Int k=0; k<n; ++k )
+            A.SetLocal( k, j, rowBuf[k+j*n] );
+
+    // Factor the now-pivoted panel without pivoting
+    Unb( A.Matrix() );
+    Trsm
+    ( RIGHT, UPPER, NORMAL, NON_UNIT,
+      F(1), A.LockedMatrix(), B.Matrix() );
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_TOURNAMENT_HPP
@@ -0,0 +1,193 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_FACTOR_LOOKAHEAD_HPP
+#define EL_FACTOR_LOOKAHEAD_HPP
+
+#include <deque>
+
+namespace El {
+namespace lookahead {
+
+// When Elemental was configured with non-blocking collectives, the panel
+// broadcasts of the look-ahead factorizations are overlapped with the
+// trailing updates; otherwise they are performed eagerly.
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+template<typename F,typename=EnableIf<IsPacked<F>>>
+bool StartBroadcast
+( F* buf, int count, int root, mpi::Comm comm, mpi::Request<F>& request )
+{
+    mpi::IBroadcast( buf, count, root, comm, request );
+    return true;
+}
+
+template<typename F,typename=DisableIf<IsPacked<F>>,typename=void>
+bool StartBroadcast
+( F* buf, int count, int root, mpi::Comm comm, mpi::Request<F>& )
+{
+    mpi::Broadcast( buf, count, root, comm );
+    return false;
+}
+#else
+template<typename F>
+bool StartBroadcast
+( F* buf, int count, int root, mpi::Comm comm, mpi::Request<F>& )
+{
+    mpi::Broadcast( buf, count, root, comm );
+    return false;
+}
+#endif
+
+template<typename F,typename=EnableIf<IsPacked<F>>>
+void FinishBroadcast( mpi::Request<F>& request )
+{ mpi::Wait( request ); }
+
+template<typename F,typename=DisableIf<IsPacked<F>>,typename=void>
+void FinishBroadcast( mpi::Request<F>& )
+{ }
+
+// Gather a [VC,* ] or [VR,* ] (resp. [* ,VC] or [* ,VR]) panel into the
+// aligned [MC,* ] or [MR,* ] (resp. [* ,MC] or [* ,MR]) distribution using
+// one (non-blocking) broadcast rooted at each member of the communicator
+// over which the panel is partially replicated, so that the communication
+// may proceed while the caller updates the trailing matrix.
+//
+// NOTE: The source panel may be modified or destroyed after Start, but the
+//       target must not be accessed until after Finish.
+template<typename F>
+class PanelGather
+{
+public:
+    PanelGather() { }
+    PanelGather( const PanelGather& ) = delete;
+    PanelGather& operator=( const PanelGather& ) = delete;
+
+    void Start( const ElementalMatrix<F>& A, ElementalMatrix<F>& B )
+    {
+        EL_DEBUG_CSE
+        const bool colPanel = ( A.RowDist() == STAR );
+        EL_DEBUG_ONLY(
+          if( colPanel && (B.RowDist() != STAR ||
+              A.PartialColStride() != B.ColStride() ||
+              Mod(A.ColAlign(),B.ColStride()) != B.ColAlign()) )
+              LogicError("Incompatible column panels");
+          if( !colPanel && (A.ColDist() != STAR || B.ColDist() != STAR ||
+              A.PartialRowStride() != B.RowStride() ||
+              Mod(A.RowAlign(),B.RowStride()) != B.RowAlign()) )
+              LogicError("Incompatible row panels");
+        )
+        B.Resize( A.Height(), A.Width() );
+        target_ = &B;
+        colPanel_ = colPanel;
+
+        // The members of the union communicator differ in the rank of the
+        // panel's (col or row) distribution by multiples of 'partialStride'
+        const Int height = A.Height();
+        const Int width = A.Width();
+        mpi::Comm comm =
+          ( colPanel ? A.PartialUnionColComm() : A.PartialUnionRowComm() );
+        const int numRoots = mpi::Size( comm );
+        const int partialRank =
+          ( colPanel ? A.PartialColRank() : A.PartialRowRank() );
+        const int partialStride =
+          ( colPanel ? A.PartialColStride() : A.PartialRowStride() );
+        const int stride = ( colPanel ? A.ColStride() : A.RowStride() );
+        const int align = ( colPanel ? A.ColAlign() : A.RowAlign() );
+
+        shifts_.resize( numRoots );
+        offsets_.resize( numRoots+1 );
+        offsets_[0] = 0;
+        for( int q=0; q<numRoots; ++q )
+        {
+            shifts_[q] = Shift( partialRank+q*partialStride, align, stride );
+            const Int length = Length( colPanel ? height : width,
+                                       shifts_[q], stride );
+            offsets_[q+1] =
+              offsets_[q] + ( colPanel ? length*width : height*length );
+        }
+        stride_ = stride;
+        buffer_.resize( offsets_[numRoots] );
+
+        // Pack our local portion into our slot of the buffer
+        const int myRoot = mpi::Rank( comm );
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        auto& ALoc = A.LockedMatrix();
+        F* packed = &buffer_[offsets_[myRoot]];
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                packed[iLoc+jLoc*localHeight] = ALoc(iLoc,jLoc);
+
+        requests_.resize( numRoots );
+        pending_ = false;
+        for( int q=0; q<numRoots; ++q )
+        {
+            const int count = offsets_[q+1] - offsets_[q];
+            pending_ = StartBroadcast
+              ( &buffer_[offsets_[q]], count, q, comm, requests_[q] ) ||
+              pending_;
+        }
+    }
+
+    void Finish()
+    {
+        EL_DEBUG_CSE
+        if( target_ == nullptr )
+            LogicError("PanelGather::Finish called before Start");
+        if( pending_ )
+            for( auto& request : requests_ )
+                FinishBroadcast( request );
+
+        // Unpack each root's portion into the interleaved target
+        auto& B = *target_;
+        auto& BLoc = B.Matrix();
+        const Int height = B.Height();
+        const Int width = B.Width();
+        const int numRoots = shifts_.size();
+        for( int q=0; q<numRoots; ++q )
+        {
+            const F* packed = &buffer_[offsets_[q]];
+            if( colPanel_ )
+            {
+                const Int length = Length( height, shifts_[q], stride_ );
+                for( Int j=0; j<width; ++j )
+                    for( Int l=0; l<length; ++l )
+                    {
+                        const Int i = shifts_[q] + l*stride_;
+                        BLoc( B.LocalRow(i), j ) = packed[l+j*length];
+                    }
+            }
+            else
+            {
+                const Int length = Length( width, shifts_[q], stride_ );
+                for( Int l=0; l<length; ++l )
+                {
+                    const Int jLoc = B.LocalCol( shifts_[q] + l*stride_ );
+                    for( Int i=0; i<height; ++i )
+                        BLoc( i, jLoc ) = packed[i+l*height];
+                }
+            }
+        }
+        target_ = nullptr;
+        SwapClear( buffer_ );
+    }
+
+private:
+    ElementalMatrix<F>* target_=nullptr;
+    bool colPanel_=true;
+    bool pending_=false;
+    Int stride_=1;
+    vector<Int> shifts_, offsets_;
+    vector<F> buffer_;
+    vector<mpi::Request<F>> requests_;
+};
+
+} // namespace lookahead
+} // namespace El
+
+#endif // ifndef EL_FACTOR_LOOKAHEAD_HPP
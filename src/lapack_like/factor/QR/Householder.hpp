@@ -29,7 +29,7 @@ Householder
     householderScalars.Resize( minDim, 1 );
     signature.Resize( minDim, 1 );
 
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("QR",minDim);
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -43,7 +43,10 @@ Householder
         auto householderScalars1 = householderScalars( ind1, ALL );
         auto sig1 = signature( ind1, ALL );
 
-        PanelHouseholder( AB1, householderScalars1, sig1 );
+        {
+            EL_ALLOCATION_SITE("QR panel")
+            PanelHouseholder( AB1, householderScalars1, sig1 );
+        }
         ApplyQ( LEFT, ADJOINT, AB1, householderScalars1, sig1, AB2 );
     }
 }
@@ -72,7 +75,8 @@ Householder
     householderScalars.Resize( minDim, 1 );
     signature.Resize( minDim, 1 );
 
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<F>("QR",minDim,A.Grid().Height(),A.Grid().Width());
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -86,7 +90,10 @@ Householder
         auto householderScalars1 = householderScalars( ind1, ALL );
         auto sig1 = signature( ind1, ALL );
 
-        PanelHouseholder( AB1, householderScalars1, sig1 );
+        {
+            EL_ALLOCATION_SITE("QR panel")
+            PanelHouseholder( AB1, householderScalars1, sig1 );
+        }
         ApplyQ( LEFT, ADJOINT, AB1, householderScalars1, sig1, AB2 );
     }
 }
@@ -229,8 +229,7 @@ BlackBox
         SafeScaleTrapezoid( maxNormA, normMin, uplo, A );
     }
 
-    // TODO(poulson): Extend interface to support accepting ctrl.tridiagCtrl
-    herm_tridiag::ExplicitCondensed( uplo, A );
+    herm_tridiag::ExplicitCondensed( uplo, A, ctrl.tridiagCtrl );
 
     auto d = GetRealPartOfDiagonal(A);
     auto dSub = GetDiagonal( A, (uplo==LOWER?-1:1) );
@@ -261,6 +260,7 @@ HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("HermitianEig")
     if( A.Height() != A.Width() )
         LogicError("Hermitian matrices must be square");
     if( ctrl.useSDC )
@@ -505,6 +505,7 @@ HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("HermitianEig")
     typedef Base<F> Real;
     if( APre.Height() != APre.Width() )
         LogicError("Hermitian matrices must be square");
@@ -549,16 +550,18 @@ BlackBox
     EL_DEBUG_CSE
     HermitianEigInfo info;
 
-    // TODO(poulson): Extend interface to support ctrl.tridiagCtrl
     Matrix<F> householderScalars;
-    HermitianTridiag( uplo, A, householderScalars );
+    herm_tridiag::BulgeReflectors<F> bulgeReflectors;
+    HermitianTridiag
+    ( uplo, A, householderScalars, bulgeReflectors, ctrl.tridiagCtrl );
 
     auto d = GetRealPartOfDiagonal(A);
     auto dSub = GetDiagonal( A, (uplo==LOWER?-1:1) );
     info.tridiagEigInfo =
       HermitianTridiagEig( d, dSub, w, Q, ctrl.tridiagEigCtrl );
 
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
+    herm_tridiag::ApplyQ
+    ( LEFT, uplo, NORMAL, A, householderScalars, bulgeReflectors, Q );
 
     return info;
 }
@@ -579,9 +582,10 @@ BlackBox
     DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
 
-    // TODO(poulson): Extend interface to support ctrl.tridiagCtrl
     DistMatrix<F,VC,STAR> householderScalars(g);
-    HermitianTridiag( uplo, A, householderScalars );
+    herm_tridiag::BulgeReflectors<F> bulgeReflectors;
+    HermitianTridiag
+    ( uplo, A, householderScalars, bulgeReflectors, ctrl.tridiagCtrl );
 
     auto d = GetRealPartOfDiagonal(A);
     auto dSub = GetDiagonal( A, (uplo==LOWER?-1:1) );
@@ -593,7 +597,8 @@ BlackBox
 
         info.tridiagEigInfo =
           HermitianTridiagEig( d, dSub, w, Q, ctrl.tridiagEigCtrl );
-        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
+        herm_tridiag::ApplyQ
+        ( LEFT, uplo, NORMAL, A, householderScalars, bulgeReflectors, Q );
     }
     else
     {
@@ -602,7 +607,8 @@ BlackBox
 
         info.tridiagEigInfo =
           HermitianTridiagEig( d, dSub, w, Q, ctrl.tridiagEigCtrl );
-        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
+        herm_tridiag::ApplyQ
+        ( LEFT, uplo, NORMAL, A, householderScalars, bulgeReflectors, Q );
     }
 
     return info;
@@ -620,6 +626,7 @@ HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("HermitianEig")
     typedef Base<F> Real;
     const Int n = A.Height();
     auto subset = ctrl.tridiagEigCtrl.subset;
@@ -866,7 +873,9 @@ MRRR
             timer.Start();
     }
     DistMatrix<F,STAR,STAR> householderScalars(g);
-    HermitianTridiag( uplo, A, householderScalars, ctrl.tridiagCtrl );
+    herm_tridiag::BulgeReflectors<F> bulgeReflectors;
+    HermitianTridiag
+    ( uplo, A, householderScalars, bulgeReflectors, ctrl.tridiagCtrl );
     if( ctrl.timeStages )
     {
         mpi::Barrier( A.DistComm() );
@@ -986,7 +995,8 @@ MRRR
             timer.Start();
         }
     }
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
+    herm_tridiag::ApplyQ
+    ( LEFT, uplo, NORMAL, A, householderScalars, bulgeReflectors, Q );
     if( ctrl.timeStages )
     {
         mpi::Barrier( A.DistComm() );
@@ -1009,6 +1019,7 @@ HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("HermitianEig")
     typedef Base<F> Real;
     const Int n = A.Height();
     auto subset = ctrl.tridiagEigCtrl.subset;
@@ -458,6 +458,7 @@ HermitianTridiagEig
   const HermitianTridiagEigCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("HermitianTridiagEig")
     return herm_tridiag_eig::Helper( d, dSub, w, ctrl );
 }
 
@@ -565,6 +566,62 @@ DCHelper
     return info;
 }
 
+// Translate the MRRR control structure into that of the PMRRR wrapper
+Ctrl PMRRRCtrl( const MRRRCtrl& mrrrCtrl, Int maxLocalEigenvectors=0 )
+{
+    Ctrl ctrl;
+    ctrl.numThreads = mrrrCtrl.numThreads;
+#ifdef EL_HYBRID
+    if( ctrl.numThreads <= 0 )
+        ctrl.numThreads = omp_get_max_threads();
+#endif
+    ctrl.minRelGap = mrrrCtrl.minRelGap;
+    ctrl.highAccuracy = mrrrCtrl.highAccuracy;
+    ctrl.balance = mrrrCtrl.balanceClusters;
+    ctrl.maxLocalEigenvectors = maxLocalEigenvectors;
+    return ctrl;
+}
+
+// Combine the local statistics of PMRRR over the processes of 'comm'
+MRRRInfo SummarizeMRRR
+( const Info& info, double redistTime, mpi::Comm comm, bool progress )
+{
+    EL_DEBUG_CSE
+    MRRRInfo mrrrInfo;
+    mrrrInfo.numThreads = info.numThreads;
+    mrrrInfo.numClusters = info.numClusters;
+    mrrrInfo.maxLocalEigenvectors =
+      mpi::AllReduce( Int(info.numLocalEigenvalues), mpi::MAX, comm );
+
+    const double localTimes[4] =
+      { info.eigenvalueTime, info.eigenvectorTime, info.refineTime,
+        redistTime };
+    double maxTimes[4];
+    mpi::AllReduce( localTimes, maxTimes, 4, mpi::MAX, comm );
+    mrrrInfo.eigenvalueTime = maxTimes[0];
+    mrrrInfo.eigenvectorTime = maxTimes[1];
+    mrrrInfo.refineTime = maxTimes[2];
+    mrrrInfo.redistTime = maxTimes[3];
+
+    const double avgEigenvectorTime =
+      mpi::AllReduce( info.eigenvectorTime, comm ) / mpi::Size( comm );
+    if( avgEigenvectorTime > 0 )
+        mrrrInfo.eigenvectorImbalance =
+          mrrrInfo.eigenvectorTime / avgEigenvectorTime;
+
+    if( progress )
+        OutputFromRoot
+        (comm,"MRRR with ",mrrrInfo.numThreads," thread(s) per process: ",
+         mrrrInfo.numClusters," clusters, eigenvalues: ",
+         mrrrInfo.eigenvalueTime," [sec], eigenvectors: ",
+         mrrrInfo.eigenvectorTime," [sec] (imbalance of ",
+         mrrrInfo.eigenvectorImbalance,", at most ",
+         mrrrInfo.maxLocalEigenvectors," per process), refinement: ",
+         mrrrInfo.refineTime," [sec], redistribution: ",
+         mrrrInfo.redistTime," [sec]");
+    return mrrrInfo;
+}
+
 template<typename Real,
          typename=EnableIf<IsBlasScalar<Real>>>
 HermitianTridiagEigInfo
@@ -593,22 +650,25 @@ MRRRHelper
     dSub_STAR_STAR.Resize( n-1, 1, n );
     Copy( dSub, dSub_STAR_STAR );
 
+    const auto pmrrrCtrl = PMRRRCtrl( ctrl.mrrrCtrl );
     vector<double> wVector(n);
     herm_tridiag_eig::Info rangeInfo;
     if( ctrl.subset.rangeSubset )
         rangeInfo = herm_tridiag_eig::Eig
           ( int(n), d_STAR_STAR.Buffer(), dSub_STAR_STAR.Buffer(),
             wVector.data(), w.ColComm(),
-            ctrl.subset.lowerBound, ctrl.subset.upperBound );
+            ctrl.subset.lowerBound, ctrl.subset.upperBound, pmrrrCtrl );
     else if( ctrl.subset.indexSubset )
         rangeInfo = herm_tridiag_eig::Eig
           ( int(n), d_STAR_STAR.Buffer(), dSub_STAR_STAR.Buffer(),
             wVector.data(), w.ColComm(),
-            int(ctrl.subset.lowerIndex), int(ctrl.subset.upperIndex) );
+            int(ctrl.subset.lowerIndex), int(ctrl.subset.upperIndex),
+            pmrrrCtrl );
     else
         rangeInfo = herm_tridiag_eig::Eig
           ( int(n), d_STAR_STAR.Buffer(), dSub_STAR_STAR.Buffer(),
-            wVector.data(), w.ColComm() );
+            wVector.data(), w.ColComm(), pmrrrCtrl );
+    info.mrrrInfo = SummarizeMRRR( rangeInfo, 0, w.ColComm(), ctrl.progress );
     w.Resize( rangeInfo.numGlobalEigenvalues, 1 );
     for( Int iLoc=0; iLoc<w.LocalHeight(); ++iLoc )
         w.SetLocal( iLoc, 0, Real(wVector[iLoc]) );
@@ -694,6 +754,7 @@ MRRRHelper
     DistMatrix<double,STAR,STAR> dSubReal(g);
     RemovePhase( dSub_STAR_STAR, dSubReal );
 
+    const auto pmrrrCtrl = PMRRRCtrl( ctrl.mrrrCtrl );
     herm_tridiag_eig::Info rangeInfo;
     vector<double> wVector(n);
     if( ctrl.subset.rangeSubset )
@@ -701,21 +762,23 @@ MRRRHelper
         rangeInfo = herm_tridiag_eig::Eig
           ( int(n), d_STAR_STAR.Buffer(), dSubReal.Buffer(),
             wVector.data(), w.ColComm(),
-            ctrl.subset.lowerBound, ctrl.subset.upperBound );
+            ctrl.subset.lowerBound, ctrl.subset.upperBound, pmrrrCtrl );
     }
     else if( ctrl.subset.indexSubset )
     {
         rangeInfo = herm_tridiag_eig::Eig
           ( int(n), d_STAR_STAR.Buffer(), dSubReal.Buffer(),
             wVector.data(), w.ColComm(),
-            int(ctrl.subset.lowerIndex), int(ctrl.subset.upperIndex) );
+            int(ctrl.subset.lowerIndex), int(ctrl.subset.upperIndex),
+            pmrrrCtrl );
     }
     else
     {
         rangeInfo = herm_tridiag_eig::Eig
           ( int(n), d_STAR_STAR.Buffer(), dSubReal.Buffer(),
-            wVector.data(), w.ColComm() );
+            wVector.data(), w.ColComm(), pmrrrCtrl );
     }
+    info.mrrrInfo = SummarizeMRRR( rangeInfo, 0, w.ColComm(), ctrl.progress );
     w.Resize( rangeInfo.numGlobalEigenvalues, 1 );
     auto& wLoc = w.Matrix();
     for( Int iLoc=0; iLoc<w.LocalHeight(); ++iLoc )
@@ -782,6 +845,7 @@ HermitianTridiagEig
   const HermitianTridiagEigCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("HermitianTridiagEig")
     return herm_tridiag_eig::Helper( d, dSub, w, ctrl );
 }
 
@@ -982,6 +1046,7 @@ HermitianTridiagEig
   const HermitianTridiagEigCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("HermitianTridiagEig")
     return herm_tridiag_eig::Helper( d, dSub, w, Q, ctrl );
 }
 
@@ -1150,6 +1215,122 @@ DCHelper
     return info;
 }
 
+// Compute the (at most k) requested eigenpairs of the real symmetric
+// tridiagonal matrix with diagonal d and subdiagonal e using PMRRR, storing the
+// eigenvalues in w[VR,* ] and the eigenvectors in Q[* ,VR] (in the same,
+// though not necessarily sorted, order)
+template<typename Real>
+MRRRInfo MRRRPairs
+( Int n, double* d, double* e, Int k,
+  DistMatrix<Real,VR,STAR>& w,
+  DistMatrix<double,STAR,VR>& Q,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = Q.RowComm();
+    const int commSize = mpi::Size( comm );
+    const bool balance = ctrl.mrrrCtrl.balanceClusters;
+    const Int maxLocal = 2*MaxLength( k, commSize );
+    const auto pmrrrCtrl = PMRRRCtrl( ctrl.mrrrCtrl, maxLocal );
+
+    // When balancing, the number of eigenvectors computed by each process
+    // differs from its local width of Q, so they are computed into a
+    // separate buffer
+    Q.Resize( n, k );
+    Matrix<double> Z;
+    double* ZBuf = Q.Buffer();
+    Int ZLDim = Q.LDim();
+    if( balance )
+    {
+        // Each eigenpair is later sent as its index, its eigenvalue, and its
+        // eigenvector. Neither a process's eigenpairs nor its columns of Q
+        // exceed 'maxLocal', so this bound (the same on every process)
+        // guarantees that the send and receive totals fit in an int.
+        if( maxLocal*(n+2) > Int(limits::Max<int>()) )
+            LogicError
+            ("Redistributing ",maxLocal," eigenpairs of length ",n,
+             " per process would overflow the MPI counts");
+        Z.Resize( n, maxLocal );
+        ZBuf = Z.Buffer();
+        ZLDim = Z.LDim();
+    }
+
+    Info rangeInfo;
+    vector<double> wVector(n);
+    if( ctrl.subset.rangeSubset )
+        rangeInfo = Eig
+          ( int(n), d, e, wVector.data(), ZBuf, int(ZLDim), comm,
+            ctrl.subset.lowerBound, ctrl.subset.upperBound, pmrrrCtrl );
+    else if( ctrl.subset.indexSubset )
+        rangeInfo = Eig
+          ( int(n), d, e, wVector.data(), ZBuf, int(ZLDim), comm,
+            int(ctrl.subset.lowerIndex), int(ctrl.subset.upperIndex),
+            pmrrrCtrl );
+    else
+        rangeInfo = Eig
+          ( int(n), d, e, wVector.data(), ZBuf, int(ZLDim), comm,
+            pmrrrCtrl );
+    w.Resize( rangeInfo.numGlobalEigenvalues, 1 );
+    Q.Resize( n, rangeInfo.numGlobalEigenvalues );
+
+    double redistTime = 0;
+    if( balance )
+    {
+        // Send each eigenpair, preceded by its index, to the owner of the
+        // corresponding column of Q[* ,VR]
+        Timer timer;
+        timer.Start();
+        const Int numLocal = rangeInfo.numLocalEigenvalues;
+        const Int first = rangeInfo.firstLocalEigenvalue;
+        const Int packetSize = n+2;
+        vector<Int> sendSizesInt( commSize, 0 );
+        for( Int j=0; j<numLocal; ++j )
+            sendSizesInt[Q.RowOwner(first+j)] += packetSize;
+        vector<int> sendSizes( commSize );
+        for( int q=0; q<commSize; ++q )
+            sendSizes[q] = int(sendSizesInt[q]);
+        vector<int> recvSizes( commSize );
+        mpi::AllToAll( sendSizes.data(), 1, recvSizes.data(), 1, comm );
+        vector<int> sendOffs, recvOffs;
+        const int numSends = Scan( sendSizes, sendOffs );
+        const int numRecvs = Scan( recvSizes, recvOffs );
+
+        vector<double> sendBuf( numSends );
+        auto offs = sendOffs;
+        for( Int j=0; j<numLocal; ++j )
+        {
+            const int owner = Q.RowOwner(first+j);
+            sendBuf[offs[owner]++] = first+j;
+            sendBuf[offs[owner]++] = wVector[j];
+            MemCopy( &sendBuf[offs[owner]], Z.LockedBuffer(0,j), n );
+            offs[owner] += n;
+        }
+        Z.Empty();
+        vector<double> recvBuf( numRecvs );
+        mpi::AllToAll
+        ( sendBuf.data(), sendSizes.data(), sendOffs.data(),
+          recvBuf.data(), recvSizes.data(), recvOffs.data(), comm );
+        SwapClear( sendBuf );
+
+        auto& wLoc = w.Matrix();
+        auto& QLoc = Q.Matrix();
+        for( Int s=0; s<numRecvs; s+=packetSize )
+        {
+            const Int j = Int(recvBuf[s]);
+            wLoc(w.LocalRow(j)) = Real(recvBuf[s+1]);
+            MemCopy( QLoc.Buffer(0,Q.LocalCol(j)), &recvBuf[s+2], n );
+        }
+        redistTime = timer.Stop();
+    }
+    else
+    {
+        for( Int iLoc=0; iLoc<w.LocalHeight(); ++iLoc )
+            w.SetLocal( iLoc, 0, Real(wVector[iLoc]) );
+    }
+
+    return SummarizeMRRR( rangeInfo, redistTime, comm, ctrl.progress );
+}
+
 template<typename Real,
          typename=EnableIf<IsBlasScalar<Real>>>
 HermitianTridiagEigInfo
@@ -1200,31 +1381,12 @@ MRRRHelper
         k = ( n==0 ? 0 : ctrl.subset.upperIndex-ctrl.subset.lowerIndex+1 );
     else
         k = n;
-    Q.Resize( n, k );
-
-    herm_tridiag_eig::Info rangeInfo;
-    vector<double> wVector(n);
-    if( ctrl.subset.rangeSubset )
-        rangeInfo = herm_tridiag_eig::Eig
-          ( int(n), d_STAR_STAR.Buffer(), dSub_STAR_STAR.Buffer(),
-            wVector.data(), Q.Buffer(), Q.LDim(), w.ColComm(),
-            ctrl.subset.lowerBound, ctrl.subset.upperBound );
-    else if( ctrl.subset.indexSubset )
-        rangeInfo = herm_tridiag_eig::Eig
-          ( int(n), d_STAR_STAR.Buffer(), dSub_STAR_STAR.Buffer(),
-            wVector.data(), Q.Buffer(), Q.LDim(), w.ColComm(),
-            int(ctrl.subset.lowerIndex), int(ctrl.subset.upperIndex) );
-    else
-        rangeInfo = herm_tridiag_eig::Eig
-          ( int(n), d_STAR_STAR.Buffer(), dSub_STAR_STAR.Buffer(),
-            wVector.data(), Q.Buffer(), Q.LDim(), w.ColComm() );
-    w.Resize( rangeInfo.numGlobalEigenvalues, 1 );
-    Q.Resize( n, rangeInfo.numGlobalEigenvalues );
-    for( Int iLoc=0; iLoc<w.LocalHeight(); ++iLoc )
-        w.SetLocal( iLoc, 0, Real(wVector[iLoc]) );
+    info.mrrrInfo =
+      MRRRPairs
+      ( n, d_STAR_STAR.Buffer(), dSub_STAR_STAR.Buffer(), k, w, Q, ctrl );
 
     auto sortPairs = TaggedSort( w, ctrl.sort );
-    for( Int j=0; j<n; ++j )
+    for( Int j=0; j<w.Height(); ++j )
         w.Set( j, 0, sortPairs[j].value );
     ApplyTaggedSortToEachRow( sortPairs, Q );
 
@@ -1288,34 +1450,12 @@ MRRRHelper
     else
         k = n;
     DistMatrix<double,STAR,VR> QReal(g);
-    QReal.Resize( n, k );
-
-    herm_tridiag_eig::Info rangeInfo;
-    vector<double> wVector(n);
-    if( ctrl.subset.rangeSubset )
-        rangeInfo = herm_tridiag_eig::Eig
-          ( int(n), d_STAR_STAR.Buffer(), dSubReal.Buffer(),
-            wVector.data(), QReal.Buffer(), QReal.LDim(), w.ColComm(),
-            ctrl.subset.lowerBound, ctrl.subset.upperBound );
-    else if( ctrl.subset.indexSubset )
-        rangeInfo = herm_tridiag_eig::Eig
-          ( int(n), d_STAR_STAR.Buffer(), dSubReal.Buffer(),
-            wVector.data(), QReal.Buffer(), QReal.LDim(), w.ColComm(),
-            int(ctrl.subset.lowerIndex), int(ctrl.subset.upperIndex) );
-    else
-        rangeInfo = herm_tridiag_eig::Eig
-          ( int(n), d_STAR_STAR.Buffer(), dSubReal.Buffer(),
-            wVector.data(), QReal.Buffer(), QReal.LDim(), w.ColComm() );
-
-    w.Resize( rangeInfo.numGlobalEigenvalues, 1 );
-    auto& wLoc = w.Matrix();
-    for( Int iLoc=0; iLoc<w.LocalHeight(); ++iLoc )
-        wLoc(iLoc) = wVector[iLoc];
-
-    QReal.Resize( n, rangeInfo.numGlobalEigenvalues );
+    info.mrrrInfo =
+      MRRRPairs
+      ( n, d_STAR_STAR.Buffer(), dSubReal.Buffer(), k, w, QReal, ctrl );
 
     auto sortPairs = TaggedSort( w, ctrl.sort );
-    for( Int j=0; j<n; ++j )
+    for( Int j=0; j<w.Height(); ++j )
         w.Set( j, 0, sortPairs[j].value );
     ApplyTaggedSortToEachRow( sortPairs, QReal );
 
@@ -1431,6 +1571,7 @@ HermitianTridiagEig
   const HermitianTridiagEigCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("HermitianTridiagEig")
     return herm_tridiag_eig::Helper( d, dSub, w, Q, ctrl );
 }
 
@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./CounterBased.hpp"
+
 namespace El {
 
 template<typename T>
@@ -21,6 +23,9 @@ void Bernoulli( Matrix<T>& A, Int m, Int n, double p )
         ("Invalid choice of parameter p for Bernoulli distribution: ",p);
     A.Resize( m, n );
     const double q = 1-p;
+    const counter_based::BernoulliSampler<T> sampler{q};
+    if( counter_based::Fill( A, sampler ) )
+        return;
     auto doubleCoin = [=]() -> T
     {
         const double alpha = SampleUniform<double>(0,1);
@@ -39,6 +44,9 @@ void Bernoulli( AbstractDistMatrix<T>& A, Int m, Int n, double p )
         ("Invalid choice of parameter p for Bernoulli distribution: ",p);
     A.Resize( m, n );
     const double q = 1-p;
+    const counter_based::BernoulliSampler<T> sampler{q};
+    if( counter_based::Fill( A, sampler ) )
+        return;
     auto doubleCoin = [=]() -> T
     {
         const double alpha = SampleUniform<double>(0,1);
@@ -0,0 +1,249 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_MATRICES_RANDOM_INDEPENDENT_COUNTERBASED_HPP
+#define EL_MATRICES_RANDOM_INDEPENDENT_COUNTERBASED_HPP
+
+namespace El {
+namespace counter_based {
+
+typedef std::array<std::uint32_t,4> Bits;
+
+// Counter-based analogues of SampleBall, SampleNormal, and
+// SampleUniform<double>(0,1) which transform the 128 bits drawn for a
+// single entry
+// ===================================================================
+
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>,
+         typename=DisableIf<IsIntegral<Real>>>
+Real SampleBall( const Bits& bits, const Real& center, const Real& radius )
+{
+    const double alpha = CounterBasedUnit( bits[0], bits[1] );
+    return center + radius*Real(2*alpha-1);
+}
+
+template<typename T,
+         typename=EnableIf<IsIntegral<T>>,
+         typename=void,
+         typename=void>
+T SampleBall( const Bits& bits, const T& center, const T& radius )
+{
+    // Match SampleUniform(center-radius,center+radius)
+    const T a = center-radius;
+    const T b = center+radius;
+    if( b <= a )
+        return a;
+    const std::uint64_t sample = (std::uint64_t(bits[0])<<32) | bits[1];
+    return a + T(sample % std::uint64_t(b-a));
+}
+
+template<typename F,
+         typename=EnableIf<IsComplex<F>>>
+F SampleBall( const Bits& bits, const F& center, const Base<F>& radius )
+{
+    typedef Base<F> Real;
+    const Real r = radius*Real(CounterBasedUnit(bits[0],bits[1]));
+    const Real angle = 2*Pi<Real>()*Real(CounterBasedUnit(bits[2],bits[3]));
+    return center + F(r*Cos(angle),r*Sin(angle));
+}
+
+// Use the Box-Muller transform so that a single draw suffices for both the
+// real and imaginary components
+template<typename F>
+F SampleNormal( const Bits& bits, const F& mean, const Base<F>& stddev )
+{
+    typedef Base<F> Real;
+    Real stddevAdj = stddev;
+    if( IsComplex<F>::value )
+        stddevAdj /= Sqrt(Real(2));
+
+    // Avoid Log(0) by sampling from (0,1]
+    const Real alpha = Real(1-CounterBasedUnit(bits[0],bits[1]));
+    const Real angle = 2*Pi<Real>()*Real(CounterBasedUnit(bits[2],bits[3]));
+    const Real r = stddevAdj*Sqrt(-2*Log(alpha));
+
+    F sample;
+    SetRealPart( sample, RealPart(mean) + r*Cos(angle) );
+    if( IsComplex<F>::value )
+        SetImagPart( sample, ImagPart(mean) + r*Sin(angle) );
+    return sample;
+}
+
+// Function objects for the ensembles. Their call operators are only
+// instantiated for the types supported by Fill.
+// =====================================================================
+
+template<typename T>
+struct BallSampler
+{
+    T center;
+    Base<T> radius;
+
+    T operator()( const Bits& bits ) const
+    { return SampleBall( bits, center, radius ); }
+};
+
+template<typename F>
+struct NormalSampler
+{
+    F mean;
+    Base<F> stddev;
+
+    F operator()( const Bits& bits ) const
+    { return SampleNormal( bits, mean, stddev ); }
+};
+
+template<typename T>
+struct BernoulliSampler
+{
+    double q;
+
+    T operator()( const Bits& bits ) const
+    {
+        const double alpha = CounterBasedUnit( bits[0], bits[1] );
+        if( alpha <= q ) return T(0);
+        else             return T(1);
+    }
+};
+
+template<typename T>
+struct ThreeValuedSampler
+{
+    double p;
+
+    T operator()( const Bits& bits ) const
+    {
+        const double alpha = CounterBasedUnit( bits[0], bits[1] );
+        if( alpha <= p/2 ) return T(-1);
+        else if( alpha <= p ) return T(1);
+        else return T(0);
+    }
+};
+
+// Overwrite each local entry with a sample keyed on its global indices.
+// Every entry is independent, so the columns are distributed over threads
+// and the rows are vectorized.
+template<typename T,class Sampler>
+void FillLocal
+( Matrix<T>& ALoc,
+  const vector<Int>& globalRows,
+  const vector<Int>& globalCols,
+  std::uint64_t seed,
+  std::uint32_t stream,
+  const Sampler& sampler )
+{
+    EL_DEBUG_CSE
+    const Int localHeight = ALoc.Height();
+    const Int localWidth = ALoc.Width();
+    const Int ALDim = ALoc.LDim();
+    const Int* rowBuf = globalRows.data();
+    T* ABuf = ALoc.Buffer();
+    EL_PARALLEL_FOR
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const std::uint64_t j = globalCols[jLoc];
+        T* colBuf = &ABuf[jLoc*ALDim];
+        EL_SIMD
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            colBuf[iLoc] =
+              sampler( Philox4x32( rowBuf[iLoc], j, stream, seed ) );
+    }
+}
+
+// Return false, without modifying A, if counter-based generation is not
+// enabled or is not supported for the datatype
+// ====================================================================
+
+template<typename T,class Sampler,
+         typename=EnableIf<IsStdScalar<Base<T>>>>
+bool Fill( Matrix<T>& A, const Sampler& sampler )
+{
+    EL_DEBUG_CSE
+    if( !CounterBasedRandom() )
+        return false;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    vector<Int> globalRows(m), globalCols(n);
+    for( Int i=0; i<m; ++i )
+        globalRows[i] = i;
+    for( Int j=0; j<n; ++j )
+        globalCols[j] = j;
+    const std::uint64_t seed = CounterBasedLocalSeed();
+    const std::uint32_t stream = NextCounterBasedStream();
+    FillLocal( A, globalRows, globalCols, seed, stream, sampler );
+    return true;
+}
+
+template<typename T,class Sampler,
+         typename=DisableIf<IsStdScalar<Base<T>>>,
+         typename=void>
+bool Fill( Matrix<T>& A, const Sampler& sampler )
+{ return false; }
+
+template<typename T,class Sampler,
+         typename=EnableIf<IsStdScalar<Base<T>>>>
+bool Fill( AbstractDistMatrix<T>& A, const Sampler& sampler )
+{
+    EL_DEBUG_CSE
+    if( !CounterBasedRandom() )
+        return false;
+    // Redundant copies draw identical entries from the agreed upon stream,
+    // so no broadcast is needed
+    const std::uint32_t stream =
+      NextCounterBasedStream( A.Grid().ViewingComm() );
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    vector<Int> globalRows(localHeight), globalCols(localWidth);
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        globalRows[iLoc] = A.GlobalRow(iLoc);
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        globalCols[jLoc] = A.GlobalCol(jLoc);
+    FillLocal
+    ( A.Matrix(), globalRows, globalCols, CounterBasedSeed(), stream,
+      sampler );
+    return true;
+}
+
+template<typename T,class Sampler,
+         typename=DisableIf<IsStdScalar<Base<T>>>,
+         typename=void>
+bool Fill( AbstractDistMatrix<T>& A, const Sampler& sampler )
+{ return false; }
+
+template<typename T,class Sampler,
+         typename=EnableIf<IsStdScalar<Base<T>>>>
+bool Fill( DistMultiVec<T>& X, const Sampler& sampler )
+{
+    EL_DEBUG_CSE
+    if( !CounterBasedRandom() )
+        return false;
+    const std::uint32_t stream = NextCounterBasedStream( X.Grid().Comm() );
+    const Int localHeight = X.LocalHeight();
+    const Int width = X.Width();
+    vector<Int> globalRows(localHeight), globalCols(width);
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        globalRows[iLoc] = X.FirstLocalRow() + iLoc;
+    for( Int j=0; j<width; ++j )
+        globalCols[j] = j;
+    FillLocal
+    ( X.Matrix(), globalRows, globalCols, CounterBasedSeed(), stream,
+      sampler );
+    return true;
+}
+
+template<typename T,class Sampler,
+         typename=DisableIf<IsStdScalar<Base<T>>>,
+         typename=void>
+bool Fill( DistMultiVec<T>& X, const Sampler& sampler )
+{ return false; }
+
+} // namespace counter_based
+} // namespace El
+
+#endif // ifndef EL_MATRICES_RANDOM_INDEPENDENT_COUNTERBASED_HPP
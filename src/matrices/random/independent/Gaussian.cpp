@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./CounterBased.hpp"
+
 namespace El {
 
 // Draw each entry from a normal PDF
@@ -17,6 +19,9 @@ template<typename F>
 void MakeGaussian( Matrix<F>& A, F mean, Base<F> stddev )
 {
     EL_DEBUG_CSE
+    const counter_based::NormalSampler<F> sampler{mean,stddev};
+    if( counter_based::Fill( A, sampler ) )
+        return;
     auto sampleNormal = [=]() { return SampleNormal(mean,stddev); };
     EntrywiseFill( A, function<F()>(sampleNormal) );
 }
@@ -25,6 +30,9 @@ template<typename F>
 void MakeGaussian( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
 {
     EL_DEBUG_CSE
+    const counter_based::NormalSampler<F> sampler{mean,stddev};
+    if( counter_based::Fill( A, sampler ) )
+        return;
     if( A.RedundantRank() == 0 )
         MakeGaussian( A.Matrix(), mean, stddev );
     Broadcast( A, A.RedundantComm(), 0 );
@@ -34,6 +42,9 @@ template<typename F>
 void MakeGaussian( DistMultiVec<F>& A, F mean, Base<F> stddev )
 {
     EL_DEBUG_CSE
+    const counter_based::NormalSampler<F> sampler{mean,stddev};
+    if( counter_based::Fill( A, sampler ) )
+        return;
     auto sampleNormal = [=]() { return SampleNormal(mean,stddev); };
     EntrywiseFill( A, function<F()>(sampleNormal) );
 }
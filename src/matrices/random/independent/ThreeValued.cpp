@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./CounterBased.hpp"
+
 namespace El {
 
 template<typename T>
@@ -17,6 +19,9 @@ void ThreeValued( Matrix<T>& A, Int m, Int n, double p )
 {
     EL_DEBUG_CSE
     A.Resize( m, n );
+    const counter_based::ThreeValuedSampler<T> sampler{p};
+    if( counter_based::Fill( A, sampler ) )
+        return;
     auto tripleCoin = [=]() -> T
     { 
         const double alpha = SampleUniform<double>(0,1);
@@ -32,6 +37,9 @@ void ThreeValued( AbstractDistMatrix<T>& A, Int m, Int n, double p )
 {
     EL_DEBUG_CSE
     A.Resize( m, n );
+    const counter_based::ThreeValuedSampler<T> sampler{p};
+    if( counter_based::Fill( A, sampler ) )
+        return;
     if( A.RedundantRank() == 0 )
         ThreeValued( A.Matrix(), A.LocalHeight(), A.LocalWidth(), p );
     Broadcast( A, A.RedundantComm(), 0 );
@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./CounterBased.hpp"
+
 namespace El {
 
 // Draw each entry from a uniform PDF over a closed ball.
@@ -18,6 +20,9 @@ template<typename T>
 void MakeUniform( Matrix<T>& A, T center, Base<T> radius )
 {
     EL_DEBUG_CSE
+    const counter_based::BallSampler<T> sampler{center,radius};
+    if( counter_based::Fill( A, sampler ) )
+        return;
     auto sampleBall = [=]() { return SampleBall(center,radius); };
     EntrywiseFill( A, function<T()>(sampleBall) );
 }
@@ -34,6 +39,9 @@ template<typename T>
 void MakeUniform( AbstractDistMatrix<T>& A, T center, Base<T> radius )
 {
     EL_DEBUG_CSE
+    const counter_based::BallSampler<T> sampler{center,radius};
+    if( counter_based::Fill( A, sampler ) )
+        return;
     if( A.RedundantRank() == 0 )
         MakeUniform( A.Matrix(), center, radius );
     Broadcast( A, A.RedundantComm(), 0 );
@@ -51,6 +59,9 @@ template<typename T>
 void MakeUniform( DistMultiVec<T>& X, T center, Base<T> radius )
 {
     EL_DEBUG_CSE
+    const counter_based::BallSampler<T> sampler{center,radius};
+    if( counter_based::Fill( X, sampler ) )
+        return;
     const int localHeight = X.LocalHeight();
     const int width = X.Width();
     for( int j=0; j<width; ++j )
@@ -338,12 +338,21 @@ Base<Field> ShortVectorEnumeration
                 ctrl.blocksize = 10;
                 ctrl.recursive = false;
                 ctrl.lllCtrl.recursive = false;
+                ctrl.lllCtrl.segmented = false;
                 if( ctrl.time )
                     timer.Start();
                 BKZ( BNew, U, RNew, ctrl );
                 if( ctrl.time )
                     Output("  Fix-up BKZ: ",timer.Stop()," seconds");
             }
+            // The random transformations differ between processes, so the
+            // parallel enumeration must split the root's tree, and the
+            // resulting coordinates are relative to the root's U
+            if( trial != 0 && ctrl.parallel && mpi::Size(ctrl.comm) > 1 )
+            {
+                Broadcast( BNew, ctrl.comm, 0 );
+                Broadcast( U, ctrl.comm, 0 );
+            }
             RNew = BNew;
             qr::ExplicitTriang( RNew );
 
@@ -357,7 +366,10 @@ Base<Field> ShortVectorEnumeration
             if( ctrl.time )
                 timer.Start();
             Real result =
-              svp::GNREnumeration( dNew, NNew, upperBounds, v, ctrl );
+              ( ctrl.parallel ?
+                svp::ParallelGNREnumeration
+                ( dNew, NNew, upperBounds, v, ctrl ) :
+                svp::GNREnumeration( dNew, NNew, upperBounds, v, ctrl ) );
             if( ctrl.time )
                 Output("  Probabalistic enumeration: ",timer.Stop()," seconds");
             if( result < normUpperBound )
@@ -434,7 +446,10 @@ Base<Field> ShortVectorEnumeration
             Output("Starting FULL_ENUM(",n,")");
         if( ctrl.time )
             timer.Start();
-        Real result = svp::GNREnumeration( d, N, upperBounds, v, ctrl );
+        Real result =
+          ( ctrl.parallel ?
+            svp::ParallelGNREnumeration( d, N, upperBounds, v, ctrl ) :
+            svp::GNREnumeration( d, N, upperBounds, v, ctrl ) );
         if( ctrl.time )
             Output("FULL_ENUM(",n,"): ",timer.Stop()," seconds");
         return result;
@@ -554,12 +569,21 @@ MultiShortVectorEnumeration
                 ctrl.blocksize = 10;
                 ctrl.recursive = false;
                 ctrl.lllCtrl.recursive = false;
+                ctrl.lllCtrl.segmented = false;
                 if( ctrl.time )
                     timer.Start();
                 BKZ( BNew, U, RNew, ctrl );
                 if( ctrl.time )
                     Output("  Fix-up BKZ: ",timer.Stop()," seconds");
             }
+            // The random transformations differ between processes, so the
+            // parallel enumeration must split the root's tree, and the
+            // resulting coordinates are relative to the root's U
+            if( trial != 0 && ctrl.parallel && mpi::Size(ctrl.comm) > 1 )
+            {
+                Broadcast( BNew, ctrl.comm, 0 );
+                Broadcast( U, ctrl.comm, 0 );
+            }
             RNew = BNew;
             qr::ExplicitTriang( RNew );
 
@@ -794,6 +818,33 @@ Base<Field> ShortestVectorEnumeration
     bool satisfiedBound = ( b0Norm <= normUpperBound ? true : false );
     Real targetNorm = Min(normUpperBound,b0Norm);
 
+    if( ctrl.parallel && ctrl.enumType == FULL_ENUM )
+    {
+        // Rather than restarting the enumeration after each improvement,
+        // shrink the radius shared by all of the subtrees
+        const Int minDim = Min(B.Height(),n);
+        auto d = GetRealPartOfDiagonal( R );
+        auto N( R );
+        auto NT = N( IR(0,minDim), ALL );
+        DiagonalSolve( LEFT, NORMAL, d, NT );
+
+        Matrix<Real> upperBounds;
+        Zeros( upperBounds, n, 1 );
+        Fill( upperBounds, targetNorm );
+        Matrix<Field> vCand;
+        const Real result =
+          svp::ParallelGNREnumeration( d, N, upperBounds, vCand, ctrl, true );
+        if( result < targetNorm )
+        {
+            v = vCand;
+            return result;
+        }
+        else if( satisfiedBound )
+            return targetNorm;
+        else
+            return b0Norm;
+    }
+
     while( true )
     {
         Matrix<Field> vCand;
@@ -0,0 +1,494 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#ifdef EL_HYBRID
+# define EL_ENUM_CRITICAL _Pragma("omp critical(El_svp_parallel_enum)")
+#else
+# define EL_ENUM_CRITICAL
+#endif
+
+namespace El {
+
+namespace svp {
+
+// A parallelization of the (generalized) GNR enumeration from GNR.cpp.
+//
+// The enumeration tree is split 'splitDepth' levels beneath its root: the
+// top levels are walked sequentially to produce the list of surviving
+// prefixes (v(splitLevel),...,v(n-1)), each of which roots an independent
+// subtree, along with the single subtree whose prefix is zero. The subtrees
+// are dealt round-robin over the processes of ctrl.comm and then processed
+// by OpenMP tasks, whose runtime balances the (highly irregular) subtree
+// costs with work stealing.
+//
+// When searching for the shortest vector, the best norm found so far is
+// shared between the threads and rescales the bounding profile, so that
+// pruning tightens globally rather than per subtree. Each thread rereads
+// the shared radius every ctrl.syncInterval nodes (and after each of its own
+// improvements). The processes only combine their results at the end.
+
+namespace parallel_enum {
+
+template<typename F>
+struct Subtree
+{
+    // The fixed coordinates v(splitLevel:n-1), or empty for the subtree in
+    // which they are all zero
+    vector<F> prefix;
+    Base<F> partialNorm;
+    Int lastNonzero;
+};
+
+// The traversal state of GNR enumeration (see GNR.cpp for the notation)
+template<typename F>
+struct State
+{
+    Matrix<F> v, centers, partialSums;
+    Matrix<Base<F>> partialNorms;
+    Matrix<Int> sumIndices;
+    vector<SpiralState<F>> spiralStates;
+    Int lastNonzero;
+
+    explicit State( Int n )
+    : spiralStates(n)
+    {
+        Zeros( v, n, 1 );
+        Zeros( centers, n, 1 );
+        Zeros( partialSums, n+1, n );
+        Zeros( partialNorms, n+1, 1 );
+        Zeros( sumIndices, n+1, 1 );
+        for( Int j=0; j<=n; ++j )
+            sumIndices(j) = j-1;
+        lastNonzero = -1;
+    }
+
+    // Begin at level 'start' as if all of the coordinates above it are zero
+    void SeedZeroPrefix( Int start )
+    {
+        spiralStates[start].Initialize( true );
+        v(start) = spiralStates[start].Step();
+        lastNonzero = start;
+    }
+};
+
+template<typename F>
+class SharedBest
+{
+public:
+    typedef Base<F> Real;
+
+    SharedBest( Real radius, Int n )
+    : radius_(radius), found_(false)
+    { Zeros( v_, n, 1 ); }
+
+    Real Radius() const
+    {
+        Real radius;
+        EL_ENUM_CRITICAL
+        radius = radius_;
+        return radius;
+    }
+
+    bool Found() const
+    {
+        bool found;
+        EL_ENUM_CRITICAL
+        found = found_;
+        return found;
+    }
+
+    void Offer( Real norm, const Matrix<F>& v )
+    {
+        EL_ENUM_CRITICAL
+        {
+            if( norm < radius_ )
+            {
+                radius_ = norm;
+                v_ = v;
+                found_ = true;
+            }
+        }
+    }
+
+    const Matrix<F>& Vector() const { return v_; }
+
+private:
+    Real radius_;
+    bool found_;
+    Matrix<F> v_;
+};
+
+// Visit each node at level 'bottom' within the levels [bottom,top) beneath
+// the current state whose partial norms satisfy the bounding profile scaled
+// by 'scale'. The traversal begins by evaluating level k.
+// 'visit(norm,scale)' may update the scale and returns false to end the walk
+// early, and 'sync(scale)' is called every 'syncInterval' nodes for the same
+// purpose.
+template<typename F,class VisitType,class SyncType>
+void Walk
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& NTrans,
+  const Matrix<Base<F>>& upperBounds,
+        Int bottom,
+        Int top,
+        Int k,
+        State<F>& state,
+        Base<F>& scale,
+        Int syncInterval,
+  const VisitType& visit,
+  const SyncType& sync )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = NTrans.Height();
+    F* vBuf = state.v.Buffer();
+    Int numNodes = 0;
+    while( true )
+    {
+        if( ++numNodes == syncInterval )
+        {
+            numNodes = 0;
+            if( !sync( scale ) )
+                return;
+        }
+
+        const F entry = d(k)*(vBuf[k] - state.centers(k));
+        const Real partialNorm = SafeNorm( state.partialNorms(k+1), entry );
+        state.partialNorms(k) = partialNorm;
+        if( partialNorm < upperBounds((n-1)-k)*scale )
+        {
+            if( k == bottom )
+            {
+                if( !visit( partialNorm, scale ) )
+                    return;
+                // The sibling at this level may still satisfy the bound
+                vBuf[k] = state.spiralStates[k].Step();
+            }
+            else
+            {
+                // Move down the tree
+                --k;
+                state.sumIndices(k) =
+                  Max(state.sumIndices(k),state.sumIndices(k+1));
+                      F* s = &state.partialSums(0,k);
+                const F* nBuf = &NTrans(0,k);
+                for( Int i=state.sumIndices(k+1); i>=k+1; --i )
+                    s[i] = s[i+1] + nBuf[i]*vBuf[i];
+                state.centers(k) = -state.partialSums(k+1,k);
+                vBuf[k] = Round(state.centers(k));
+                state.spiralStates[k].Initialize( state.centers(k) );
+            }
+        }
+        else
+        {
+            // Move up the tree
+            ++k;
+            if( k == top )
+                return;
+            state.sumIndices(k) = k;
+            if( k > state.lastNonzero )
+            {
+                // Seed a constrained spiral out from zero
+                state.spiralStates[k].Initialize( true );
+                vBuf[k] = state.spiralStates[k].Step();
+                state.lastNonzero = k;
+            }
+            else
+            {
+                vBuf[k] = state.spiralStates[k].Step();
+            }
+        }
+    }
+}
+
+// Collect the subtrees rooted at level 'splitLevel'. If the walk is cut
+// short because 'maxSubtrees' subtrees were found, 'truncated' is set to
+// true and the returned list is incomplete.
+template<typename F>
+vector<Subtree<F>> Split
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& NTrans,
+  const Matrix<Base<F>>& upperBounds,
+        Int splitLevel,
+        Int maxSubtrees,
+        bool& truncated )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = NTrans.Height();
+    vector<Subtree<F>> subtrees( 1 );
+    subtrees[0].partialNorm = 0;
+    subtrees[0].lastNonzero = -1;
+
+    truncated = false;
+    State<F> state( n );
+    state.SeedZeroPrefix( splitLevel );
+    auto visit =
+      [&]( const Real& partialNorm, Real& )
+      {
+          Subtree<F> subtree;
+          subtree.prefix.resize( n-splitLevel );
+          for( Int j=splitLevel; j<n; ++j )
+              subtree.prefix[j-splitLevel] = state.v(j);
+          subtree.partialNorm = partialNorm;
+          subtree.lastNonzero = state.lastNonzero;
+          subtrees.push_back( subtree );
+          if( Int(subtrees.size()) >= maxSubtrees )
+          {
+              truncated = true;
+              return false;
+          }
+          return true;
+      };
+    auto sync = []( Real& ) { return true; };
+    Real scale = 1;
+    Walk
+    ( d, NTrans, upperBounds, splitLevel, n, splitLevel, state, scale,
+      Int(0), visit, sync );
+    return subtrees;
+}
+
+template<typename F>
+void Search
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& NTrans,
+  const Matrix<Base<F>>& upperBounds,
+        Int splitLevel,
+  const Subtree<F>& subtree,
+        bool findShortest,
+        Int syncInterval,
+        SharedBest<F>& best )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = NTrans.Height();
+    const Real radius = upperBounds(n-1);
+    Real scale = best.Radius() / radius;
+
+    State<F> state( n );
+    Int k;
+    if( subtree.prefix.empty() )
+    {
+        // Mirror the beginning of sequential GNR enumeration
+        k = 0;
+        state.SeedZeroPrefix( 0 );
+    }
+    else
+    {
+        for( Int j=splitLevel; j<n; ++j )
+            state.v(j) = subtree.prefix[j-splitLevel];
+        state.partialNorms(splitLevel) = subtree.partialNorm;
+        state.lastNonzero = subtree.lastNonzero;
+        for( Int j=0; j<=splitLevel; ++j )
+            state.sumIndices(j) = n-1;
+
+        // Move down to the first free level
+        k = splitLevel-1;
+        F* s = &state.partialSums(0,k);
+        const F* nBuf = &NTrans(0,k);
+        for( Int i=n-1; i>=k+1; --i )
+            s[i] = s[i+1] + nBuf[i]*state.v(i);
+        state.centers(k) = -state.partialSums(k+1,k);
+        state.v(k) = Round(state.centers(k));
+        state.spiralStates[k].Initialize( state.centers(k) );
+    }
+
+    auto visit =
+      [&]( const Real& norm, Real& scale )
+      {
+          best.Offer( norm, state.v );
+          if( !findShortest )
+              return false;
+          scale = best.Radius() / radius;
+          return true;
+      };
+    auto sync =
+      [&]( Real& scale )
+      {
+          if( findShortest )
+          {
+              scale = best.Radius() / radius;
+              return true;
+          }
+          return !best.Found();
+      };
+    Walk
+    ( d, NTrans, upperBounds, Int(0), splitLevel, k, state, scale,
+      syncInterval, visit, sync );
+}
+
+} // namespace parallel_enum
+
+template<typename F>
+Base<F> ParallelGNREnumeration
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& N,
+  const Matrix<Base<F>>& upperBounds,
+        Matrix<F>& v,
+  const EnumCtrl<Base<F>>& ctrl,
+        bool findShortest )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = N.Height();
+    const Int n = N.Width();
+    if( n > m )
+        LogicError("Expected height(N) >= width(N)");
+    if( n < 2 )
+        return GNREnumeration( d, N, upperBounds, v, ctrl );
+    const Real radius = upperBounds(n-1);
+
+    const int commSize = mpi::Size( ctrl.comm );
+    const int commRank = mpi::Rank( ctrl.comm );
+#ifdef EL_HYBRID
+    const Int numThreads = ( omp_in_parallel() ? 1 : omp_get_max_threads() );
+#else
+    const Int numThreads = 1;
+#endif
+    const Int numWorkers = numThreads*commSize;
+    const Int syncInterval = Max( ctrl.syncInterval, Int(1) );
+
+    Matrix<F> NTrans;
+    Transpose( N, NTrans );
+
+    // Split the tree at either the requested depth or the shallowest depth
+    // which yields enough subtrees to balance the load
+    Timer timer;
+    if( ctrl.time && commRank == 0 )
+        timer.Start();
+    const Int targetNumSubtrees = ctrl.subtreesPerWorker*numWorkers;
+    const Int maxInt = std::numeric_limits<Int>::max();
+    Int splitLevel;
+    bool truncated = false;
+    vector<parallel_enum::Subtree<F>> subtrees;
+    if( ctrl.splitDepth > 0 )
+    {
+        splitLevel = Max( n-ctrl.splitDepth, Int(1) );
+        subtrees = parallel_enum::Split
+          ( d, NTrans, upperBounds, splitLevel, maxInt, truncated );
+    }
+    else
+    {
+        for( splitLevel=n-1; splitLevel>=1; --splitLevel )
+        {
+            subtrees = parallel_enum::Split
+              ( d, NTrans, upperBounds, splitLevel, targetNumSubtrees,
+                truncated );
+            if( truncated )
+                break;
+        }
+        splitLevel = Max( splitLevel, Int(1) );
+        if( truncated )
+        {
+            // The cap cut the walk short, so redo it in full so that no
+            // subtree is dropped
+            subtrees = parallel_enum::Split
+              ( d, NTrans, upperBounds, splitLevel, maxInt, truncated );
+        }
+    }
+    if( truncated )
+        LogicError("Enumeration tree split was unexpectedly truncated");
+    const Int numSubtrees = subtrees.size();
+    if( ctrl.time && commRank == 0 )
+        Output
+        ("  Split at level ",splitLevel," into ",numSubtrees," subtrees: ",
+         timer.Stop()," seconds");
+    if( ctrl.progress && commRank == 0 )
+        Output
+        ("Parallel enumeration over ",numThreads," threads and ",commSize,
+         " processes with ",numSubtrees," subtrees");
+
+    // Process the local subtrees
+    // ==========================
+    if( ctrl.time && commRank == 0 )
+        timer.Start();
+    parallel_enum::SharedBest<F> best( radius, n );
+#ifdef EL_HYBRID
+    // Exceptions cannot propagate out of a task, so the first is rethrown
+    // after the parallel region
+    std::exception_ptr exception;
+    #pragma omp parallel if( numThreads > 1 )
+    {
+        #pragma omp single
+        {
+            for( Int index=commRank; index<numSubtrees; index+=commSize )
+            {
+                #pragma omp task firstprivate(index)
+                {
+                    try
+                    {
+                        if( findShortest || !best.Found() )
+                            parallel_enum::Search
+                            ( d, NTrans, upperBounds, splitLevel,
+                              subtrees[index], findShortest, syncInterval,
+                              best );
+                    }
+                    catch( ... )
+                    {
+                        #pragma omp critical
+                        {
+                            if( !exception )
+                                exception = std::current_exception();
+                        }
+                    }
+                }
+            }
+        }
+    }
+    if( exception )
+        std::rethrow_exception( exception );
+#else
+    for( Int index=commRank; index<numSubtrees; index+=commSize )
+    {
+        if( !findShortest && best.Found() )
+            break;
+        parallel_enum::Search
+        ( d, NTrans, upperBounds, splitLevel, subtrees[index], findShortest,
+          syncInterval, best );
+    }
+#endif
+    if( ctrl.time && commRank == 0 )
+        Output("  Subtree enumeration: ",timer.Stop()," seconds");
+
+    // Combine the results over the processes
+    // =======================================
+    Real result = ( best.Found() ? best.Radius() : 2*radius+1 );
+    v = best.Vector();
+    if( commSize > 1 )
+    {
+        const Real globalResult = mpi::AllReduce( result, mpi::MIN, ctrl.comm );
+        const int owner =
+          mpi::AllReduce
+          ( result == globalResult ? commRank : commSize, mpi::MIN, ctrl.comm );
+        mpi::Broadcast( v.Buffer(), n, owner, ctrl.comm );
+        result = globalResult;
+    }
+    return result;
+}
+
+} // namespace svp
+
+#define PROTO(F) \
+  template Base<F> svp::ParallelGNREnumeration \
+  ( const Matrix<Base<F>>& d, \
+    const Matrix<F>& N, \
+    const Matrix<Base<F>>& upperBounds, \
+          Matrix<F>& v, \
+    const EnumCtrl<Base<F>>& ctrl, \
+          bool findShortest );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -32,6 +32,10 @@ ElError ElMehrotraCtrlDefault_s( ElMehrotraCtrl_s* ctrl )
     ctrl->forceSameStep = true;
     ElRegSolveCtrlDefault_s( &ctrl->solveCtrl );
     ctrl->resolveReg = true;
+    ctrl->krylovKKT = false;
+    ctrl->krylovForcing = 0.1;
+    ctrl->krylovMaxIts = 2000;
+    ctrl->warmStartFloor = 0;
     ctrl->outerEquil = true;
     ctrl->basisSize = 6;
     ctrl->print = false;
@@ -72,6 +76,10 @@ ElError ElMehrotraCtrlDefault_d( ElMehrotraCtrl_d* ctrl )
     ctrl->forceSameStep = true;
     ElRegSolveCtrlDefault_d( &ctrl->solveCtrl );
     ctrl->resolveReg = true;
+    ctrl->krylovKKT = false;
+    ctrl->krylovForcing = 0.1;
+    ctrl->krylovMaxIts = 2000;
+    ctrl->warmStartFloor = 0;
     ctrl->outerEquil = true;
     ctrl->basisSize = 6;
     ctrl->print = false;
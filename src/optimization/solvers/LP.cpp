@@ -206,6 +206,20 @@ void LP
         LogicError("Unsupported solver");
 }
 
+template<typename Real>
+void LP
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        DirectLPSolution<Matrix<Real>>& solution,
+        lp::direct::SparseKKTAnalysis<Real>& analysis,
+  const lp::direct::Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach == LP_MEHROTRA )
+        lp::direct::Mehrotra( problem, solution, analysis, ctrl.mehrotraCtrl );
+    else
+        LogicError("Unsupported solver");
+}
+
 // This interface is now deprecated.
 template<typename Real>
 void LP
@@ -291,6 +305,20 @@ void LP
         LogicError("Unsupported solver");
 }
 
+template<typename Real>
+void LP
+( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        DirectLPSolution<DistMultiVec<Real>>& solution,
+        lp::direct::DistSparseKKTAnalysis<Real>& analysis,
+  const lp::direct::Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach == LP_MEHROTRA )
+        lp::direct::Mehrotra( problem, solution, analysis, ctrl.mehrotraCtrl );
+    else
+        LogicError("Unsupported solver");
+}
+
 // This interface is now deprecated.
 template<typename Real>
 void LP
@@ -433,6 +461,11 @@ void LP
           DirectLPSolution<Matrix<Real>>& solution, \
     const lp::direct::Ctrl<Real>& ctrl ); \
   template void LP \
+  ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem, \
+          DirectLPSolution<Matrix<Real>>& solution, \
+          lp::direct::SparseKKTAnalysis<Real>& analysis, \
+    const lp::direct::Ctrl<Real>& ctrl ); \
+  template void LP \
   ( const SparseMatrix<Real>& A, \
     const Matrix<Real>& b, \
     const Matrix<Real>& c, \
@@ -460,6 +493,11 @@ void LP
           DirectLPSolution<DistMultiVec<Real>>& solution, \
     const lp::direct::Ctrl<Real>& ctrl ); \
   template void LP \
+  ( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem, \
+          DirectLPSolution<DistMultiVec<Real>>& solution, \
+          lp::direct::DistSparseKKTAnalysis<Real>& analysis, \
+    const lp::direct::Ctrl<Real>& ctrl ); \
+  template void LP \
   ( const DistSparseMatrix<Real>& A, \
     const DistMultiVec<Real>& b, \
     const DistMultiVec<Real>& c, \
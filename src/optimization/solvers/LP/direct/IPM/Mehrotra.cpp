@@ -1356,10 +1356,59 @@ void Mehrotra
     Copy( solution.z, z );
 }
 
+// Discard the symbolic analyses unless they were computed for the same KKT
+// system and constraint matrix sparsity pattern
+template<typename Real>
+void SyncAnalysis
+( const SparseMatrix<Real>& A,
+        KKTSystem system,
+        SparseKKTAnalysis<Real>& analysis )
+{
+    EL_DEBUG_CSE
+    const bool samePattern =
+      analysis.system == system &&
+      analysis.height == A.Height() && analysis.width == A.Width() &&
+      qp::direct::SamePattern( A, analysis.offsets, analysis.targets );
+    if( samePattern )
+        return;
+
+    analysis.system = system;
+    analysis.height = A.Height();
+    analysis.width = A.Width();
+    qp::direct::SavePattern( A, analysis.offsets, analysis.targets );
+    analysis.augmentedAnalyzed = false;
+    analysis.analyzed = false;
+}
+
+template<typename Real>
+void SyncAnalysis
+( const DistSparseMatrix<Real>& A,
+        KKTSystem system,
+        DistSparseKKTAnalysis<Real>& analysis )
+{
+    EL_DEBUG_CSE
+    const bool sameLocalPattern =
+      analysis.system == system &&
+      analysis.height == A.Height() && analysis.width == A.Width() &&
+      qp::direct::SameLocalPattern( A, analysis.offsets, analysis.targets );
+    const int samePattern =
+      mpi::AllReduce( int(sameLocalPattern), mpi::MIN, A.Grid().Comm() );
+    if( samePattern )
+        return;
+
+    analysis.system = system;
+    analysis.height = A.Height();
+    analysis.width = A.Width();
+    qp::direct::SaveLocalPattern( A, analysis.offsets, analysis.targets );
+    analysis.augmentedAnalyzed = false;
+    analysis.analyzed = false;
+}
+
 template<typename Real>
 void EquilibratedMehrotra
 ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
         DirectLPSolution<Matrix<Real>>& solution,
+        SparseKKTAnalysis<Real>& analysis,
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
@@ -1394,26 +1443,53 @@ void EquilibratedMehrotra
         Output("|| c ||_2 = ",cNrm2);
     }
 
-    SparseLDLFactorization<Real> sparseLDLFact;
-    // The initialization involves an augmented KKT system, and so we can
-    // only reuse the factorization metadata if the this IPM is using the
-    // augmented formulation
-    if( ctrl.system == AUGMENTED_KKT )
+    if( ctrl.krylovKKT && ctrl.system != NORMAL_KKT )
+        LogicError("Krylov KKT solves require the NORMAL_KKT system");
+    if( ctrl.krylovKKT )
     {
-        Initialize
-        ( problem, solution, sparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
-          ctrl.solveCtrl );
+        // Avoid factoring an augmented KKT system for the initialization
+        KrylovInitialize
+        ( problem, solution, ctrl.primalInit, ctrl.dualInit,
+          ctrl.standardInitShift, ctrl.solveCtrl.relTol, ctrl.krylovMaxIts,
+          ctrl.solveCtrl.progress );
     }
     else
     {
-        SparseLDLFactorization<Real> augmentedSparseLDLFact;
+        // The initialization involves an augmented KKT system, and so we can
+        // only reuse the factorization metadata if the this IPM is using the
+        // augmented formulation
         Initialize
-        ( problem, solution, augmentedSparseLDLFact,
+        ( problem, solution, analysis.augmentedFact,
           ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
-          ctrl.solveCtrl );
+          ctrl.solveCtrl, analysis.augmentedAnalyzed );
+        if( !ctrl.primalInit || !ctrl.dualInit )
+            analysis.augmentedAnalyzed = true;
+    }
+    qp::direct::WarmStart( solution.x, solution.z, ctrl );
+    // Inexact-Newton forcing: only solve as accurately as the barrier
+    // parameter warrants
+    const Real eps = limits::Epsilon<Real>();
+    auto krylovTol =
+      [&]( const Real& mu )
+      { return Max( ctrl.krylovForcing*Min(mu,Real(1)), 10*eps ); };
+    // A o A is formed once, whereas D^2 and the Jacobi preconditioner are
+    // formed once per iteration and shared by the affine and corrector solves
+    SparseMatrix<Real> ASquared;
+    Matrix<Real> dSquared, diagJ;
+    if( ctrl.krylovKKT )
+    {
+        ASquared = problem.A;
+        function<Real(const Real&)> square =
+          []( const Real& alpha ) { return alpha*alpha; };
+        EntrywiseMap( ASquared, square );
     }
 
+    const bool augmented = ( ctrl.system == AUGMENTED_KKT );
+    SparseLDLFactorization<Real>& sparseLDLFact =
+      ( augmented ? analysis.augmentedFact : analysis.fact );
+    bool& analyzed =
+      ( augmented ? analysis.augmentedAnalyzed : analysis.analyzed );
+
     Matrix<Real> regTmp;
     if( ctrl.system == FULL_KKT )
     {
@@ -1586,13 +1662,12 @@ void EquilibratedMehrotra
                 else
                     Ones( dInner, J.Height(), 1 );
 
-                if( numIts == 0 &&
-                    (ctrl.system != AUGMENTED_KKT ||
-                     (ctrl.primalInit && ctrl.dualInit)) )
+                if( !analyzed )
                 {
                     const bool hermitian = true;
                     const BisectCtrl bisectCtrl;
                     sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                    analyzed = true;
                 }
                 else
                 {
@@ -1627,6 +1702,36 @@ void EquilibratedMehrotra
                 ( solution.x, solution.z, residual.dualConic, d,
                   affineCorrection.x, affineCorrection.y, affineCorrection.z );
         }
+        else if( ctrl.krylovKKT )
+        {
+            NormalKKTJacobi
+            ( ASquared, gammaPerm, deltaPerm, solution.x, solution.z,
+              dSquared, diagJ );
+            NormalKKTRHS
+            ( problem.A, gammaPerm, solution.x, solution.z,
+              residual.dualEquality, residual.primalEquality,
+              residual.dualConic, d );
+            Zeros( affineCorrection.y, m, 1 );
+            try
+            {
+                NormalKKTCG
+                ( problem.A, deltaPerm, dSquared, diagJ, d,
+                  affineCorrection.y, krylovTol(mu), ctrl.krylovMaxIts,
+                  ctrl.solveCtrl.progress );
+            }
+            catch(...)
+            {
+                if( relError <= ctrl.minTol )
+                    break;
+                else
+                    RuntimeError
+                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            }
+            ExpandNormalSolution
+            ( problem.A, gammaPerm, solution.x, solution.z,
+              residual.dualEquality, residual.dualConic,
+              affineCorrection.x, affineCorrection.y, affineCorrection.z );
+        }
         else // ctrl.system == NORMAL_KKT
         {
             // Construct the KKT system
@@ -1645,11 +1750,12 @@ void EquilibratedMehrotra
             // -----------------------
             try
             {
-                if( numIts == 0 )
+                if( !analyzed )
                 {
                     const bool hermitian = true;
                     const BisectCtrl bisectCtrl;
                     sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                    analyzed = true;
                 }
                 else
                 {
@@ -1821,13 +1927,27 @@ void EquilibratedMehrotra
               residual.dualConic, correction.y );
             try
             {
-                // NOTE: regTmp should be all zeros; replace with unregularized
-                reg_ldl::RegularizedSolveAfter
-                ( J, regTmp, sparseLDLFact, correction.y,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress,
-                  ctrl.solveCtrl.time );
+                if( ctrl.krylovKKT )
+                {
+                    // Start from the affine direction
+                    d = correction.y;
+                    correction.y = affineCorrection.y;
+                    NormalKKTCG
+                    ( problem.A, deltaPerm, dSquared, diagJ, d,
+                      correction.y, krylovTol(mu), ctrl.krylovMaxIts,
+                      ctrl.solveCtrl.progress );
+                }
+                else
+                {
+                    // NOTE: regTmp should be all zeros; replace with
+                    // unregularized
+                    reg_ldl::RegularizedSolveAfter
+                    ( J, regTmp, sparseLDLFact, correction.y,
+                      ctrl.solveCtrl.relTol,
+                      ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress,
+                      ctrl.solveCtrl.time );
+                }
             }
             catch(...)
             {
@@ -1878,6 +1998,19 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    SparseKKTAnalysis<Real> analysis;
+    Mehrotra( problem, solution, analysis, ctrl );
+}
+
+template<typename Real>
+void Mehrotra
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        DirectLPSolution<Matrix<Real>>& solution,
+        SparseKKTAnalysis<Real>& analysis,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    SyncAnalysis( problem.A, ctrl.system, analysis );
     if( ctrl.outerEquil )
     {
         DirectLPProblem<SparseMatrix<Real>,Matrix<Real>> equilibratedProblem;
@@ -1886,12 +2019,13 @@ void Mehrotra
         Equilibrate
         ( problem, solution,
           equilibratedProblem, equilibratedSolution, equilibration, ctrl );
-        EquilibratedMehrotra( equilibratedProblem, equilibratedSolution, ctrl );
+        EquilibratedMehrotra
+        ( equilibratedProblem, equilibratedSolution, analysis, ctrl );
         UndoEquilibration( equilibratedSolution, equilibration, solution );
     }
     else
     {
-        EquilibratedMehrotra( problem, solution, ctrl );
+        EquilibratedMehrotra( problem, solution, analysis, ctrl );
     }
     if( ctrl.print )
     {
@@ -1943,6 +2077,7 @@ template<typename Real>
 void EquilibratedMehrotra
 ( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
         DirectLPSolution<DistMultiVec<Real>>& solution,
+        DistSparseKKTAnalysis<Real>& analysis,
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
@@ -1985,29 +2120,56 @@ void EquilibratedMehrotra
         }
     }
 
-    DistSparseLDLFactorization<Real> sparseLDLFact;
-    // The initialization involves an augmented KKT system, and so we can
-    // only reuse the factorization metadata if the this IPM is using the
-    // augmented formulation
+    if( ctrl.krylovKKT && ctrl.system != NORMAL_KKT )
+        LogicError("Krylov KKT solves require the NORMAL_KKT system");
     if( commRank == 0 && ctrl.time )
         timer.Start();
-    if( ctrl.system == AUGMENTED_KKT )
+    if( ctrl.krylovKKT )
     {
-        Initialize
-        ( problem, solution, sparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
-          ctrl.solveCtrl );
+        // Avoid factoring an augmented KKT system for the initialization
+        KrylovInitialize
+        ( problem, solution, ctrl.primalInit, ctrl.dualInit,
+          ctrl.standardInitShift, ctrl.solveCtrl.relTol, ctrl.krylovMaxIts,
+          ctrl.solveCtrl.progress );
     }
     else
     {
-        DistSparseLDLFactorization<Real> augmentedSparseLDLFact;
+        // The initialization involves an augmented KKT system, and so we can
+        // only reuse the factorization metadata if the this IPM is using the
+        // augmented formulation
         Initialize
-        ( problem, solution, augmentedSparseLDLFact,
+        ( problem, solution, analysis.augmentedFact,
           ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
-          ctrl.solveCtrl );
+          ctrl.solveCtrl, analysis.augmentedAnalyzed );
+        if( !ctrl.primalInit || !ctrl.dualInit )
+            analysis.augmentedAnalyzed = true;
     }
+    qp::direct::WarmStart( solution.x, solution.z, ctrl );
     if( commRank == 0 && ctrl.time )
         Output("Init: ",timer.Stop()," secs");
+    // Inexact-Newton forcing: only solve as accurately as the barrier
+    // parameter warrants
+    const Real eps = limits::Epsilon<Real>();
+    auto krylovTol =
+      [&]( const Real& mu )
+      { return Max( ctrl.krylovForcing*Min(mu,Real(1)), 10*eps ); };
+    // A o A is formed once, whereas D^2 and the Jacobi preconditioner are
+    // formed once per iteration and shared by the affine and corrector solves
+    DistSparseMatrix<Real> ASquared(grid);
+    DistMultiVec<Real> dSquared(grid), diagJ(grid);
+    if( ctrl.krylovKKT )
+    {
+        ASquared = problem.A;
+        function<Real(const Real&)> square =
+          []( const Real& alpha ) { return alpha*alpha; };
+        EntrywiseMap( ASquared, square );
+    }
+
+    const bool augmented = ( ctrl.system == AUGMENTED_KKT );
+    DistSparseLDLFactorization<Real>& sparseLDLFact =
+      ( augmented ? analysis.augmentedFact : analysis.fact );
+    bool& analyzed =
+      ( augmented ? analysis.augmentedAnalyzed : analysis.analyzed );
 
     DistMultiVec<Real> regTmp(grid);
     if( ctrl.system == FULL_KKT )
@@ -2206,15 +2368,14 @@ void EquilibratedMehrotra
                 if( commRank == 0 && ctrl.time )
                     Output("Equilibration: ",timer.Stop()," secs");
 
-                if( numIts == 0 &&
-                    (ctrl.system != AUGMENTED_KKT ||
-                     (ctrl.primalInit && ctrl.dualInit)) )
+                if( !analyzed )
                 {
                     if( commRank == 0 && ctrl.time )
                         timer.Start();
                     const bool hermitian = true;
                     const BisectCtrl bisectCtrl;
                     sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                    analyzed = true;
                     if( commRank == 0 && ctrl.time )
                         Output("Analysis: ",timer.Stop()," secs");
                 }
@@ -2259,6 +2420,42 @@ void EquilibratedMehrotra
                 ( solution.x, solution.z, residual.dualConic, d,
                   affineCorrection.x, affineCorrection.y, affineCorrection.z );
         }
+        else if( ctrl.krylovKKT )
+        {
+            NormalKKTJacobi
+            ( ASquared, gammaPerm, deltaPerm, solution.x, solution.z,
+              dSquared, diagJ );
+            NormalKKTRHS
+            ( problem.A, gammaPerm, solution.x, solution.z,
+              residual.dualEquality, residual.primalEquality,
+              residual.dualConic, d );
+            Zeros( affineCorrection.y, m, 1 );
+            try
+            {
+                if( commRank == 0 && ctrl.time )
+                    timer.Start();
+                const Int numCGIts =
+                  NormalKKTCG
+                  ( problem.A, deltaPerm, dSquared, diagJ, d,
+                    affineCorrection.y, krylovTol(mu), ctrl.krylovMaxIts,
+                    ctrl.solveCtrl.progress );
+                if( commRank == 0 && ctrl.time )
+                    Output
+                    ("Affine: ",timer.Stop()," secs (",numCGIts," CG its)");
+            }
+            catch(...)
+            {
+                if( relError <= ctrl.minTol )
+                    break;
+                else
+                    RuntimeError
+                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
+            }
+            ExpandNormalSolution
+            ( problem.A, gammaPerm, solution.x, solution.z,
+              residual.dualEquality, residual.dualConic,
+              affineCorrection.x, affineCorrection.y, affineCorrection.z );
+        }
         else // ctrl.system == NORMAL_KKT
         {
             // Assemble the KKT system
@@ -2290,13 +2487,14 @@ void EquilibratedMehrotra
             // -----------------------
             try
             {
-                if( numIts == 0 )
+                if( !analyzed )
                 {
                     if( commRank == 0 && ctrl.time )
                         timer.Start();
                     const bool hermitian = true;
                     const BisectCtrl bisectCtrl;
                     sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                    analyzed = true;
                     if( commRank == 0 && ctrl.time )
                         Output("Analysis: ",timer.Stop()," secs");
                 }
@@ -2487,12 +2685,25 @@ void EquilibratedMehrotra
             {
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
-                reg_ldl::RegularizedSolveAfter
-                ( J, regTmp, sparseLDLFact, correction.y,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress,
-                  ctrl.solveCtrl.time );
+                if( ctrl.krylovKKT )
+                {
+                    // Start from the affine direction
+                    d = correction.y;
+                    correction.y = affineCorrection.y;
+                    NormalKKTCG
+                    ( problem.A, deltaPerm, dSquared, diagJ, d,
+                      correction.y, krylovTol(mu), ctrl.krylovMaxIts,
+                      ctrl.solveCtrl.progress );
+                }
+                else
+                {
+                    reg_ldl::RegularizedSolveAfter
+                    ( J, regTmp, sparseLDLFact, correction.y,
+                      ctrl.solveCtrl.relTol,
+                      ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress,
+                      ctrl.solveCtrl.time );
+                }
                 if( commRank == 0 && ctrl.time )
                     Output("Corrector: ",timer.Stop()," secs");
             }
@@ -2545,6 +2756,19 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    DistSparseKKTAnalysis<Real> analysis;
+    Mehrotra( problem, solution, analysis, ctrl );
+}
+
+template<typename Real>
+void Mehrotra
+( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        DirectLPSolution<DistMultiVec<Real>>& solution,
+        DistSparseKKTAnalysis<Real>& analysis,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    SyncAnalysis( problem.A, ctrl.system, analysis );
     if( ctrl.outerEquil )
     {
         DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>
@@ -2554,12 +2778,13 @@ void Mehrotra
         Equilibrate
         ( problem, solution,
           equilibratedProblem, equilibratedSolution, equilibration, ctrl );
-        EquilibratedMehrotra( equilibratedProblem, equilibratedSolution, ctrl );
+        EquilibratedMehrotra
+        ( equilibratedProblem, equilibratedSolution, analysis, ctrl );
         UndoEquilibration( equilibratedSolution, equilibration, solution );
     }
     else
     {
-        EquilibratedMehrotra( problem, solution, ctrl );
+        EquilibratedMehrotra( problem, solution, analysis, ctrl );
     }
     if( ctrl.print )
     {
@@ -2642,6 +2867,11 @@ void Mehrotra
           DirectLPSolution<Matrix<Real>>& solution, \
     const MehrotraCtrl<Real>& ctrl ); \
   template void Mehrotra \
+  ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem, \
+          DirectLPSolution<Matrix<Real>>& solution, \
+          SparseKKTAnalysis<Real>& analysis, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
   ( const SparseMatrix<Real>& A, \
     const Matrix<Real>& b, \
     const Matrix<Real>& c, \
@@ -2654,6 +2884,11 @@ void Mehrotra
           DirectLPSolution<DistMultiVec<Real>>& solution, \
     const MehrotraCtrl<Real>& ctrl ); \
   template void Mehrotra \
+  ( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem, \
+          DirectLPSolution<DistMultiVec<Real>>& solution, \
+          DistSparseKKTAnalysis<Real>& analysis, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
   ( const DistSparseMatrix<Real>& A, \
     const DistMultiVec<Real>& b, \
     const DistMultiVec<Real>& c, \
@@ -31,14 +31,31 @@ void Initialize
         DirectLPSolution<Matrix<Real>>& solution,
         SparseLDLFactorization<Real>& sparseLDLFact,
   bool primalInit, bool dualInit, bool standardShift,
-  const RegSolveCtrl<Real>& solveCtrl );
+  const RegSolveCtrl<Real>& solveCtrl,
+  bool reuseAnalysis=false );
 template<typename Real>
 void Initialize
 ( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
         DirectLPSolution<DistMultiVec<Real>>& solution,
         DistSparseLDLFactorization<Real>& sparseLDLFact,
   bool primalInit, bool dualInit, bool standardShift,
-  const RegSolveCtrl<Real>& solveCtrl );
+  const RegSolveCtrl<Real>& solveCtrl,
+  bool reuseAnalysis=false );
+
+// Initialize from the normal equations of the augmented systems above using
+// Conjugate Gradients, so that no factorization is required
+template<typename Real>
+void KrylovInitialize
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        DirectLPSolution<Matrix<Real>>& solution,
+  bool primalInit, bool dualInit, bool standardShift,
+  Real relTol, Int maxIts, bool progress=false );
+template<typename Real>
+void KrylovInitialize
+( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        DirectLPSolution<DistMultiVec<Real>>& solution,
+  bool primalInit, bool dualInit, bool standardShift,
+  Real relTol, Int maxIts, bool progress=false );
 
 // Full system
 // ===========
@@ -239,6 +256,51 @@ void ExpandNormalSolution
   const DistMultiVec<Real>& dy,
         DistMultiVec<Real>& dz );
 
+// Form D^2 and the diagonal of the normal KKT system from A o A
+template<typename Real>
+void NormalKKTJacobi
+( const SparseMatrix<Real>& ASquared,
+        Real gamma,
+        Real delta,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        Matrix<Real>& dSquared,
+        Matrix<Real>& diagJ );
+template<typename Real>
+void NormalKKTJacobi
+( const DistSparseMatrix<Real>& ASquared,
+        Real gamma,
+        Real delta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistMultiVec<Real>& dSquared,
+        DistMultiVec<Real>& diagJ );
+
+// Solve the normal KKT system with Jacobi-preconditioned CG without forming
+// it, starting from the initial guess held in dy
+template<typename Real>
+Int NormalKKTCG
+( const SparseMatrix<Real>& A,
+        Real delta,
+  const Matrix<Real>& dSquared,
+  const Matrix<Real>& diagJ,
+  const Matrix<Real>& d,
+        Matrix<Real>& dy,
+        Real relTol,
+        Int maxIts,
+        bool progress=false );
+template<typename Real>
+Int NormalKKTCG
+( const DistSparseMatrix<Real>& A,
+        Real delta,
+  const DistMultiVec<Real>& dSquared,
+  const DistMultiVec<Real>& diagJ,
+  const DistMultiVec<Real>& d,
+        DistMultiVec<Real>& dy,
+        Real relTol,
+        Int maxIts,
+        bool progress=false );
+
 } // namespace direct
 } // namespace lp
 } // namespace El
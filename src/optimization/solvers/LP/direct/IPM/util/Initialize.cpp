@@ -149,37 +149,8 @@ void Initialize
         solution.z *= -1;
     }
 
-    const Real epsilon = limits::Epsilon<Real>();
-    const Real xNorm = Nrm2( solution.x );
-    const Real zNorm = Nrm2( solution.z );
-    const Real gammaPrimal = Sqrt(epsilon)*Max(xNorm,Real(1));
-    const Real gammaDual   = Sqrt(epsilon)*Max(zNorm,Real(1));
-    if( standardShift )
-    {
-        // alpha_p := min { alpha : x + alpha*e >= 0 }
-        // -------------------------------------------
-        const auto xMinPair = VectorMinLoc( solution.x );
-        const Real alphaPrimal = -xMinPair.value;
-        if( alphaPrimal >= Real(0) && primalInit )
-            RuntimeError("initialized x was non-positive");
-
-        // alpha_d := min { alpha : z + alpha*e >= 0 }
-        // -------------------------------------------
-        const auto zMinPair = VectorMinLoc( solution.z );
-        const Real alphaDual = -zMinPair.value;
-        if( alphaDual >= Real(0) && dualInit )
-            RuntimeError("initialized z was non-positive");
-
-        if( alphaPrimal >= -gammaPrimal )
-            Shift( solution.x, alphaPrimal+1 );
-        if( alphaDual >= -gammaDual )
-            Shift( solution.z, alphaDual+1 );
-    }
-    else
-    {
-        LowerClip( solution.x, gammaPrimal );
-        LowerClip( solution.z, gammaDual   );
-    }
+    qp::direct::ShiftIntoInterior
+    ( solution.x, solution.z, primalInit, dualInit, standardShift );
 }
 
 template<typename Real>
@@ -262,37 +233,8 @@ void Initialize
         solution.z *= -1;
     }
 
-    const Real epsilon = limits::Epsilon<Real>();
-    const Real xNorm = Nrm2( solution.x );
-    const Real zNorm = Nrm2( solution.z );
-    const Real gammaPrimal = Sqrt(epsilon)*Max(xNorm,Real(1));
-    const Real gammaDual   = Sqrt(epsilon)*Max(zNorm,Real(1));
-    if( standardShift )
-    {
-        // alpha_p := min { alpha : x + alpha*e >= 0 }
-        // -------------------------------------------
-        const auto xMinPair = VectorMinLoc( solution.x );
-        const Real alphaPrimal = -xMinPair.value;
-        if( alphaPrimal >= Real(0) && primalInit )
-            RuntimeError("initialized x was non-positive");
-
-        // alpha_d := min { alpha : z + alpha*e >= 0 }
-        // -------------------------------------------
-        const auto zMinPair = VectorMinLoc( solution.z );
-        const Real alphaDual = -zMinPair.value;
-        if( alphaDual >= Real(0) && dualInit )
-            RuntimeError("initialized z was non-positive");
-
-        if( alphaPrimal >= -gammaPrimal )
-            Shift( solution.x, alphaPrimal+1 );
-        if( alphaDual >= -gammaDual )
-            Shift( solution.z, alphaDual+1 );
-    }
-    else
-    {
-        LowerClip( solution.x, gammaPrimal );
-        LowerClip( solution.z, gammaDual   );
-    }
+    qp::direct::ShiftIntoInterior
+    ( solution.x, solution.z, primalInit, dualInit, standardShift );
 }
 
 template<typename Real>
@@ -303,7 +245,8 @@ void Initialize
   bool primalInit,
   bool dualInit,
   bool standardShift,
-  const RegSolveCtrl<Real>& solveCtrl )
+  const RegSolveCtrl<Real>& solveCtrl,
+  bool reuseAnalysis )
 {
     EL_DEBUG_CSE
     const Int n = problem.A.Width();
@@ -312,7 +255,7 @@ void Initialize
     qp::direct::Initialize
     ( Q, problem.A, problem.b, problem.c, solution.x, solution.y, solution.z,
       sparseLDLFact,
-      primalInit, dualInit, standardShift, solveCtrl );
+      primalInit, dualInit, standardShift, solveCtrl, reuseAnalysis );
 }
 
 template<typename Real>
@@ -323,7 +266,8 @@ void Initialize
   bool primalInit,
   bool dualInit,
   bool standardShift,
-  const RegSolveCtrl<Real>& solveCtrl )
+  const RegSolveCtrl<Real>& solveCtrl,
+  bool reuseAnalysis )
 {
     EL_DEBUG_CSE
     const Int n = problem.A.Width();
@@ -332,7 +276,125 @@ void Initialize
     qp::direct::Initialize
     ( Q, problem.A, problem.b, problem.c, solution.x, solution.y, solution.z,
       sparseLDLFact,
-      primalInit, dualInit, standardShift, solveCtrl );
+      primalInit, dualInit, standardShift, solveCtrl, reuseAnalysis );
+}
+
+// The sequential and distributed Krylov initializations only differ in their
+// vector types, and copies of 'b' provide workspace vectors of the right type
+// (and, if relevant, on the right grid)
+template<typename Real,class SparseMatrixType,class VectorType>
+void KrylovInitializeHelper
+( const DirectLPProblem<SparseMatrixType,VectorType>& problem,
+        DirectLPSolution<VectorType>& solution,
+  bool primalInit,
+  bool dualInit,
+  bool standardShift,
+  Real relTol,
+  Int maxIts,
+  bool progress )
+{
+    EL_DEBUG_CSE
+    const Int m = problem.A.Height();
+    const Int n = problem.A.Width();
+    if( primalInit )
+        if( solution.x.Height() != n || solution.x.Width() != 1 )
+            LogicError("x was of the wrong size");
+    if( dualInit )
+    {
+        if( solution.y.Height() != m || solution.y.Width() != 1 )
+            LogicError("y was of the wrong size");
+        if( solution.z.Height() != n || solution.z.Width() != 1 )
+            LogicError("z was of the wrong size");
+    }
+    if( primalInit && dualInit )
+    {
+        // TODO(poulson): Perform a consistency check
+        return;
+    }
+
+    // Eliminating the identity block from the augmented systems yields
+    // systems with A A^T, which are regularized as in the sparse-direct
+    // initialization
+    const Real eps = limits::Epsilon<Real>();
+    const Real delta = Pow(eps,Real(0.25));
+
+    SparseMatrixType ASquared( problem.A );
+    function<Real(const Real&)> square =
+      []( const Real& alpha ) { return alpha*alpha; };
+    EntrywiseMap( ASquared, square );
+    VectorType ones( problem.b ), dSquared( problem.b ), diagJ( problem.b ),
+      rhs( problem.b ), w( problem.b );
+    Ones( ones, n, 1 );
+    NormalKKTJacobi( ASquared, Real(0), delta, ones, ones, dSquared, diagJ );
+
+    if( !primalInit )
+    {
+        // Minimize || x ||^2, s.t. A x = b  by solving
+        //
+        //    (A A^T + delta^2 I) w = b
+        //
+        // and setting x := A^T w.
+        Zeros( w, m, 1 );
+        NormalKKTCG
+        ( problem.A, delta, dSquared, diagJ, problem.b, w,
+          relTol, maxIts, progress );
+        Zeros( solution.x, n, 1 );
+        Multiply( TRANSPOSE, Real(1), problem.A, w, Real(0), solution.x );
+    }
+    if( !dualInit )
+    {
+        // Minimize || z ||^2, s.t. A^T y - z + c = 0 by solving
+        //
+        //    (A A^T + delta^2 I) y = -A c
+        //
+        // and setting z := A^T y + c.
+        Zeros( rhs, m, 1 );
+        Multiply( NORMAL, Real(-1), problem.A, problem.c, Real(0), rhs );
+        Zeros( solution.y, m, 1 );
+        NormalKKTCG
+        ( problem.A, delta, dSquared, diagJ, rhs, solution.y,
+          relTol, maxIts, progress );
+        solution.z = problem.c;
+        Multiply
+        ( TRANSPOSE, Real(1), problem.A, solution.y, Real(1), solution.z );
+    }
+
+    qp::direct::ShiftIntoInterior
+    ( solution.x, solution.z, primalInit, dualInit, standardShift );
+}
+
+template<typename Real>
+void KrylovInitialize
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        DirectLPSolution<Matrix<Real>>& solution,
+  bool primalInit,
+  bool dualInit,
+  bool standardShift,
+  Real relTol,
+  Int maxIts,
+  bool progress )
+{
+    EL_DEBUG_CSE
+    KrylovInitializeHelper
+    ( problem, solution, primalInit, dualInit, standardShift,
+      relTol, maxIts, progress );
+}
+
+template<typename Real>
+void KrylovInitialize
+( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        DirectLPSolution<DistMultiVec<Real>>& solution,
+  bool primalInit,
+  bool dualInit,
+  bool standardShift,
+  Real relTol,
+  Int maxIts,
+  bool progress )
+{
+    EL_DEBUG_CSE
+    KrylovInitializeHelper
+    ( problem, solution, primalInit, dualInit, standardShift,
+      relTol, maxIts, progress );
 }
 
 #define PROTO(Real) \
@@ -355,7 +417,8 @@ void Initialize
     bool primalInit, \
     bool dualInit, \
     bool standardShift, \
-    const RegSolveCtrl<Real>& solveCtrl ); \
+    const RegSolveCtrl<Real>& solveCtrl, \
+    bool reuseAnalysis ); \
   template void Initialize \
   ( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem, \
           DirectLPSolution<DistMultiVec<Real>>& solution, \
@@ -363,7 +426,26 @@ void Initialize
     bool primalInit, \
     bool dualInit, \
     bool standardShift, \
-    const RegSolveCtrl<Real>& solveCtrl );
+    const RegSolveCtrl<Real>& solveCtrl, \
+    bool reuseAnalysis ); \
+  template void KrylovInitialize \
+  ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem, \
+          DirectLPSolution<Matrix<Real>>& solution, \
+    bool primalInit, \
+    bool dualInit, \
+    bool standardShift, \
+    Real relTol, \
+    Int maxIts, \
+    bool progress ); \
+  template void KrylovInitialize \
+  ( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem, \
+          DirectLPSolution<DistMultiVec<Real>>& solution, \
+    bool primalInit, \
+    bool dualInit, \
+    bool standardShift, \
+    Real relTol, \
+    Int maxIts, \
+    bool progress );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -600,6 +600,146 @@ void ExpandNormalSolution
     dz += rc;
 }
 
+// Rather than forming A D^2 A^T + delta^2 I and factoring it, solve
+//
+//   (A D^2 A^T + delta^2 I) dy = d
+//
+// using Conjugate Gradients with products against A and A^T and a Jacobi
+// preconditioner, whose diagonal is (A o A) D^2 e + delta^2 e, where 'o'
+// denotes the Hadamard product. Only the nonzeros of A (and a squared copy of
+// them, which is formed once per solve of the LP) are stored, and D^2 and the
+// preconditioner are formed once per IPM iteration and shared by the affine
+// and corrector solves.
+
+template<typename Real>
+void NormalKKTJacobi
+( const SparseMatrix<Real>& ASquared,
+        Real gamma,
+        Real delta,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        Matrix<Real>& dSquared,
+        Matrix<Real>& diagJ )
+{
+    EL_DEBUG_CSE
+    const Int m = ASquared.Height();
+    const Int n = ASquared.Width();
+
+    // dSquared := 1 ./ ( (z ./ x) .+ gamma^2 )
+    // ========================================
+    dSquared.Resize( n, 1 );
+    for( Int i=0; i<n; ++i )
+        dSquared(i) = 1/(z(i)/x(i) + gamma*gamma);
+
+    // diagJ := (A o A) D^2 e + delta^2 e
+    // ==================================
+    Zeros( diagJ, m, 1 );
+    Multiply( NORMAL, Real(1), ASquared, dSquared, Real(0), diagJ );
+    Shift( diagJ, delta*delta );
+    for( Int i=0; i<m; ++i )
+        if( diagJ(i) == Real(0) )
+            diagJ(i) = Real(1);
+}
+
+template<typename Real>
+void NormalKKTJacobi
+( const DistSparseMatrix<Real>& ASquared,
+        Real gamma,
+        Real delta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistMultiVec<Real>& dSquared,
+        DistMultiVec<Real>& diagJ )
+{
+    EL_DEBUG_CSE
+    const Int m = ASquared.Height();
+    const Int n = ASquared.Width();
+    auto& xLoc = x.LockedMatrix();
+    auto& zLoc = z.LockedMatrix();
+
+    // dSquared := 1 ./ ( (z ./ x) .+ gamma^2 )
+    // ========================================
+    dSquared.SetGrid( ASquared.Grid() );
+    dSquared.Resize( n, 1 );
+    auto& dSquaredLoc = dSquared.Matrix();
+    const Int nLocal = dSquared.LocalHeight();
+    for( Int iLoc=0; iLoc<nLocal; ++iLoc )
+        dSquaredLoc(iLoc) = 1/(zLoc(iLoc)/xLoc(iLoc) + gamma*gamma);
+
+    // diagJ := (A o A) D^2 e + delta^2 e
+    // ==================================
+    diagJ.SetGrid( ASquared.Grid() );
+    Zeros( diagJ, m, 1 );
+    Multiply( NORMAL, Real(1), ASquared, dSquared, Real(0), diagJ );
+    Shift( diagJ, delta*delta );
+    auto& diagJLoc = diagJ.Matrix();
+    const Int mLocal = diagJ.LocalHeight();
+    for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+        if( diagJLoc(iLoc) == Real(0) )
+            diagJLoc(iLoc) = Real(1);
+}
+
+template<typename Real>
+Int NormalKKTCG
+( const SparseMatrix<Real>& A,
+        Real delta,
+  const Matrix<Real>& dSquared,
+  const Matrix<Real>& diagJ,
+  const Matrix<Real>& d,
+        Matrix<Real>& dy,
+        Real relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    Matrix<Real> t;
+    auto applyJ =
+      [&]( Real alpha, const Matrix<Real>& v, Real beta, Matrix<Real>& y )
+      {
+          Zeros( t, n, 1 );
+          Multiply( TRANSPOSE, Real(1), A, v, Real(0), t );
+          DiagonalScale( LEFT, NORMAL, dSquared, t );
+          Multiply( NORMAL, alpha, A, t, beta, y );
+          Axpy( alpha*delta*delta, v, y );
+      };
+    auto precond =
+      [&]( Matrix<Real>& b )
+      { DiagonalSolve( LEFT, NORMAL, diagJ, b ); };
+    return CG( applyJ, precond, d, dy, relTol, maxIts, progress );
+}
+
+template<typename Real>
+Int NormalKKTCG
+( const DistSparseMatrix<Real>& A,
+        Real delta,
+  const DistMultiVec<Real>& dSquared,
+  const DistMultiVec<Real>& diagJ,
+  const DistMultiVec<Real>& d,
+        DistMultiVec<Real>& dy,
+        Real relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    DistMultiVec<Real> t(A.Grid());
+    auto applyJ =
+      [&]( Real alpha, const DistMultiVec<Real>& v,
+           Real beta,        DistMultiVec<Real>& y )
+      {
+          Zeros( t, n, 1 );
+          Multiply( TRANSPOSE, Real(1), A, v, Real(0), t );
+          DiagonalScale( LEFT, NORMAL, dSquared, t );
+          Multiply( NORMAL, alpha, A, t, beta, y );
+          Axpy( alpha*delta*delta, v, y );
+      };
+    auto precond =
+      [&]( DistMultiVec<Real>& b )
+      { DiagonalSolve( LEFT, NORMAL, diagJ, b ); };
+    return CG( applyJ, precond, d, dy, relTol, maxIts, progress );
+}
+
 #define PROTO(Real) \
   template void NormalKKT \
   ( const Matrix<Real>& A, \
@@ -700,7 +840,43 @@ void ExpandNormalSolution
     const DistMultiVec<Real>& rmu, \
           DistMultiVec<Real>& dx, \
     const DistMultiVec<Real>& dy, \
-          DistMultiVec<Real>& dz );
+          DistMultiVec<Real>& dz ); \
+  template void NormalKKTJacobi \
+  ( const SparseMatrix<Real>& ASquared, \
+          Real gamma, \
+          Real delta, \
+    const Matrix<Real>& x, \
+    const Matrix<Real>& z, \
+          Matrix<Real>& dSquared, \
+          Matrix<Real>& diagJ ); \
+  template void NormalKKTJacobi \
+  ( const DistSparseMatrix<Real>& ASquared, \
+          Real gamma, \
+          Real delta, \
+    const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& z, \
+          DistMultiVec<Real>& dSquared, \
+          DistMultiVec<Real>& diagJ ); \
+  template Int NormalKKTCG \
+  ( const SparseMatrix<Real>& A, \
+          Real delta, \
+    const Matrix<Real>& dSquared, \
+    const Matrix<Real>& diagJ, \
+    const Matrix<Real>& d, \
+          Matrix<Real>& dy, \
+          Real relTol, \
+          Int maxIts, \
+          bool progress ); \
+  template Int NormalKKTCG \
+  ( const DistSparseMatrix<Real>& A, \
+          Real delta, \
+    const DistMultiVec<Real>& dSquared, \
+    const DistMultiVec<Real>& diagJ, \
+    const DistMultiVec<Real>& d, \
+          DistMultiVec<Real>& dy, \
+          Real relTol, \
+          Int maxIts, \
+          bool progress );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
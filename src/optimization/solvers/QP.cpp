@@ -86,6 +86,46 @@ void QP
         LogicError("Unsupported solver");
 }
 
+template<typename Real>
+void QP
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        qp::direct::SparseKKTAnalysis<Real>& analysis,
+  const qp::direct::Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach == QP_MEHROTRA )
+        qp::direct::Mehrotra
+        ( Q, A, b, c, x, y, z, analysis, ctrl.mehrotraCtrl );
+    else
+        LogicError("Unsupported solver");
+}
+
+template<typename Real>
+void QP
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+        qp::direct::DistSparseKKTAnalysis<Real>& analysis,
+  const qp::direct::Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach == QP_MEHROTRA )
+        qp::direct::Mehrotra
+        ( Q, A, b, c, x, y, z, analysis, ctrl.mehrotraCtrl );
+    else
+        LogicError("Unsupported solver");
+}
+
 // Affine conic form
 // =================
 template<typename Real>
@@ -210,6 +250,26 @@ void QP
           DistMultiVec<Real>& z, \
     const qp::direct::Ctrl<Real>& ctrl ); \
   template void QP \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+          qp::direct::SparseKKTAnalysis<Real>& analysis, \
+    const qp::direct::Ctrl<Real>& ctrl ); \
+  template void QP \
+  ( const DistSparseMatrix<Real>& Q, \
+    const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& b, \
+    const DistMultiVec<Real>& c, \
+          DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z, \
+          qp::direct::DistSparseKKTAnalysis<Real>& analysis, \
+    const qp::direct::Ctrl<Real>& ctrl ); \
+  template void QP \
   ( const Matrix<Real>& Q, \
     const Matrix<Real>& A, \
     const Matrix<Real>& G, \
@@ -752,6 +752,60 @@ void Mehrotra
     }
 }
 
+// Discard the symbolic analyses unless they were computed for the same KKT
+// system and sparsity patterns of Q and A
+template<typename Real>
+void SyncAnalysis
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+        KKTSystem system,
+        SparseKKTAnalysis<Real>& analysis )
+{
+    EL_DEBUG_CSE
+    const bool samePatterns =
+      analysis.system == system &&
+      analysis.height == A.Height() && analysis.width == A.Width() &&
+      SamePattern( Q, analysis.QOffsets, analysis.QTargets ) &&
+      SamePattern( A, analysis.AOffsets, analysis.ATargets );
+    if( samePatterns )
+        return;
+
+    analysis.system = system;
+    analysis.height = A.Height();
+    analysis.width = A.Width();
+    SavePattern( Q, analysis.QOffsets, analysis.QTargets );
+    SavePattern( A, analysis.AOffsets, analysis.ATargets );
+    analysis.augmentedAnalyzed = false;
+    analysis.analyzed = false;
+}
+
+template<typename Real>
+void SyncAnalysis
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+        KKTSystem system,
+        DistSparseKKTAnalysis<Real>& analysis )
+{
+    EL_DEBUG_CSE
+    const bool sameLocalPatterns =
+      analysis.system == system &&
+      analysis.height == A.Height() && analysis.width == A.Width() &&
+      SameLocalPattern( Q, analysis.QOffsets, analysis.QTargets ) &&
+      SameLocalPattern( A, analysis.AOffsets, analysis.ATargets );
+    const int samePatterns =
+      mpi::AllReduce( int(sameLocalPatterns), mpi::MIN, A.Grid().Comm() );
+    if( samePatterns )
+        return;
+
+    analysis.system = system;
+    analysis.height = A.Height();
+    analysis.width = A.Width();
+    SaveLocalPattern( Q, analysis.QOffsets, analysis.QTargets );
+    SaveLocalPattern( A, analysis.AOffsets, analysis.ATargets );
+    analysis.augmentedAnalyzed = false;
+    analysis.analyzed = false;
+}
+
 template<typename Real>
 void Mehrotra
 ( const SparseMatrix<Real>& QPre,
@@ -761,9 +815,11 @@ void Mehrotra
         Matrix<Real>& x,
         Matrix<Real>& y,
         Matrix<Real>& z,
+        SparseKKTAnalysis<Real>& analysis,
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    SyncAnalysis( QPre, APre, ctrl.system, analysis );
 
     // Equilibrate the QP by diagonally scaling A
     auto Q = QPre;
@@ -812,28 +868,23 @@ void Mehrotra
         Output("|| c ||_2 = ",cNrm2);
     }
 
-    SparseLDLFactorization<Real> sparseLDLFact;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
     // TODO(poulson): Add permanent regularization and cache J metadata
-    if( ctrl.system == AUGMENTED_KKT )
-    {
-        Initialize
-        ( Q, A, b, c, x, y, z,
-          sparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
-          ctrl.solveCtrl );
-    }
-    else
-    {
-        SparseLDLFactorization<Real> augmentedSparseLDLFact;
-        Initialize
-        ( Q, A, b, c, x, y, z,
-          augmentedSparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
-          ctrl.solveCtrl );
-    }
+    Initialize
+    ( Q, A, b, c, x, y, z,
+      analysis.augmentedFact,
+      ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
+      ctrl.solveCtrl, analysis.augmentedAnalyzed );
+    if( !ctrl.primalInit || !ctrl.dualInit )
+        analysis.augmentedAnalyzed = true;
+    WarmStart( x, z, ctrl );
+    const bool augmented = ( ctrl.system == AUGMENTED_KKT );
+    SparseLDLFactorization<Real>& sparseLDLFact =
+      ( augmented ? analysis.augmentedFact : analysis.fact );
+    bool& analyzed =
+      ( augmented ? analysis.augmentedAnalyzed : analysis.analyzed );
 
     Matrix<Real> regTmp;
     if( ctrl.system == FULL_KKT )
@@ -982,13 +1033,12 @@ void Mehrotra
                 else
                     Ones( dInner, J.Height(), 1 );
 
-                if( numIts == 0 &&
-                    (ctrl.system != AUGMENTED_KKT ||
-                     (ctrl.primalInit && ctrl.dualInit) ) )
+                if( !analyzed )
                 {
                     const bool hermitian = true;
                     const BisectCtrl bisectCtrl;
                     sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                    analyzed = true;
                 }
                 else
                 {
@@ -1193,9 +1243,11 @@ void Mehrotra
         DistMultiVec<Real>& x,
         DistMultiVec<Real>& y,
         DistMultiVec<Real>& z,
+        DistSparseKKTAnalysis<Real>& analysis,
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    SyncAnalysis( QPre, APre, ctrl.system, analysis );
     const Grid& grid = APre.Grid();
     const int commRank = grid.Rank();
     Timer timer;
@@ -1258,32 +1310,27 @@ void Mehrotra
         }
     }
 
-    DistSparseLDLFactorization<Real> sparseLDLFact;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
     // TODO(poulson): Add permanent regularization and cache J metadata
     if( commRank == 0 && ctrl.time )
         timer.Start();
-    if( ctrl.system == AUGMENTED_KKT )
-    {
-        Initialize
-        ( Q, A, b, c, x, y, z,
-          sparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
-          ctrl.solveCtrl );
-    }
-    else
-    {
-        DistSparseLDLFactorization<Real> augmentedSparseLDLFact;
-        Initialize
-        ( Q, A, b, c, x, y, z,
-          augmentedSparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
-          ctrl.solveCtrl );
-    }
+    Initialize
+    ( Q, A, b, c, x, y, z,
+      analysis.augmentedFact,
+      ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
+      ctrl.solveCtrl, analysis.augmentedAnalyzed );
+    if( !ctrl.primalInit || !ctrl.dualInit )
+        analysis.augmentedAnalyzed = true;
+    WarmStart( x, z, ctrl );
     if( commRank == 0 && ctrl.time )
         Output("Init: ",timer.Stop()," secs");
+    const bool augmented = ( ctrl.system == AUGMENTED_KKT );
+    DistSparseLDLFactorization<Real>& sparseLDLFact =
+      ( augmented ? analysis.augmentedFact : analysis.fact );
+    bool& analyzed =
+      ( augmented ? analysis.augmentedAnalyzed : analysis.analyzed );
 
     DistMultiVec<Real> regTmp(grid);
     if( ctrl.system == FULL_KKT )
@@ -1455,15 +1502,14 @@ void Mehrotra
                 if( commRank == 0 && ctrl.time )
                     Output("Equilibration: ",timer.Stop()," secs");
 
-                if( numIts == 0 &&
-                    (ctrl.system != AUGMENTED_KKT ||
-                     (ctrl.primalInit && ctrl.dualInit)) )
+                if( !analyzed )
                 {
                     if( commRank == 0 && ctrl.time )
                         timer.Start();
                     const bool hermitian = true;
                     const BisectCtrl bisectCtrl;
                     sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                    analyzed = true;
                     if( commRank == 0 && ctrl.time )
                         Output("Analysis: ",timer.Stop()," secs");
                 }
@@ -1677,6 +1723,38 @@ void Mehrotra
     }
 }
 
+template<typename Real>
+void Mehrotra
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    SparseKKTAnalysis<Real> analysis;
+    Mehrotra( Q, A, b, c, x, y, z, analysis, ctrl );
+}
+
+template<typename Real>
+void Mehrotra
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistSparseKKTAnalysis<Real> analysis;
+    Mehrotra( Q, A, b, c, x, y, z, analysis, ctrl );
+}
+
 #define PROTO(Real) \
   template void Mehrotra \
   ( const Matrix<Real>& Q, \
@@ -1713,6 +1791,26 @@ void Mehrotra
           DistMultiVec<Real>& x, \
           DistMultiVec<Real>& y, \
           DistMultiVec<Real>& z, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+          SparseKKTAnalysis<Real>& analysis, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
+  ( const DistSparseMatrix<Real>& Q, \
+    const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& b, \
+    const DistMultiVec<Real>& c, \
+          DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z, \
+          DistSparseKKTAnalysis<Real>& analysis, \
     const MehrotraCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
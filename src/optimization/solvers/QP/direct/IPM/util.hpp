@@ -45,7 +45,8 @@ void Initialize
         Matrix<Real>& z,
         SparseLDLFactorization<Real>& sparseLDLFact,
   bool primalInit, bool dualInit, bool standardShift,
-  const RegSolveCtrl<Real>& solveCtrl );
+  const RegSolveCtrl<Real>& solveCtrl,
+  bool reuseAnalysis=false );
 template<typename Real>
 void Initialize
 ( const DistSparseMatrix<Real>& Q,
@@ -57,7 +58,61 @@ void Initialize
         DistMultiVec<Real>& z,
         DistSparseLDLFactorization<Real>& sparseLDLFact,
   bool primalInit, bool dualInit, bool standardShift,
-  const RegSolveCtrl<Real>& solveCtrl );
+  const RegSolveCtrl<Real>& solveCtrl,
+  bool reuseAnalysis=false );
+
+// Move the least-squares initial points x and z into the interior of the
+// positive orthant, either by shifting them along the vector of all ones or
+// by clipping them from below
+template<typename Real>
+void ShiftIntoInterior
+( Matrix<Real>& x, Matrix<Real>& z,
+  bool primalInit, bool dualInit, bool standardShift );
+template<typename Real>
+void ShiftIntoInterior
+( ElementalMatrix<Real>& x, ElementalMatrix<Real>& z,
+  bool primalInit, bool dualInit, bool standardShift );
+template<typename Real>
+void ShiftIntoInterior
+( DistMultiVec<Real>& x, DistMultiVec<Real>& z,
+  bool primalInit, bool dualInit, bool standardShift );
+
+// Symbolic analysis reuse
+// =======================
+// Whether the (local) sparsity pattern of A is the one saved in 'offsets' and
+// 'targets'. The distributed version does not communicate, so the results
+// over the processes must be combined before any decision is made.
+template<typename Real>
+bool SamePattern
+( const SparseMatrix<Real>& A,
+  const vector<Int>& offsets,
+  const vector<Int>& targets );
+template<typename Real>
+bool SameLocalPattern
+( const DistSparseMatrix<Real>& A,
+  const vector<Int>& offsets,
+  const vector<Int>& targets );
+
+template<typename Real>
+void SavePattern
+( const SparseMatrix<Real>& A,
+  vector<Int>& offsets,
+  vector<Int>& targets );
+template<typename Real>
+void SaveLocalPattern
+( const DistSparseMatrix<Real>& A,
+  vector<Int>& offsets,
+  vector<Int>& targets );
+
+// Move a user-provided (nearly complementary) initial point away from the
+// boundary of the positive orthant (see MehrotraCtrl::warmStartFloor)
+template<typename Real>
+void WarmStart
+( Matrix<Real>& x, Matrix<Real>& z, const MehrotraCtrl<Real>& ctrl );
+template<typename Real>
+void WarmStart
+( DistMultiVec<Real>& x, DistMultiVec<Real>& z,
+  const MehrotraCtrl<Real>& ctrl );
 
 // Full system
 // ===========
@@ -0,0 +1,145 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "../util.hpp"
+
+// These routines are shared by the sparse direct-form LP and QP IPMs, which
+// keep the symbolic analyses of their KKT systems across solves (see
+// lp::direct::SparseKKTAnalysis and qp::direct::SparseKKTAnalysis)
+
+namespace El {
+namespace qp {
+namespace direct {
+
+template<typename Real>
+bool SamePattern
+( const SparseMatrix<Real>& A,
+  const vector<Int>& offsets,
+  const vector<Int>& targets )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int numEntries = A.NumEntries();
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    const Int* targetBuf = A.LockedTargetBuffer();
+    return Int(offsets.size()) == m+1 &&
+           Int(targets.size()) == numEntries &&
+           std::equal( offsetBuf, offsetBuf+m+1, offsets.begin() ) &&
+           std::equal( targetBuf, targetBuf+numEntries, targets.begin() );
+}
+
+template<typename Real>
+bool SameLocalPattern
+( const DistSparseMatrix<Real>& A,
+  const vector<Int>& offsets,
+  const vector<Int>& targets )
+{
+    EL_DEBUG_CSE
+    const Int localHeight = A.LocalHeight();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    const Int* targetBuf = A.LockedTargetBuffer();
+    return Int(offsets.size()) == localHeight+1 &&
+           Int(targets.size()) == numLocalEntries &&
+           std::equal
+           ( offsetBuf, offsetBuf+localHeight+1, offsets.begin() ) &&
+           std::equal
+           ( targetBuf, targetBuf+numLocalEntries, targets.begin() );
+}
+
+template<typename Real>
+void SavePattern
+( const SparseMatrix<Real>& A,
+  vector<Int>& offsets,
+  vector<Int>& targets )
+{
+    EL_DEBUG_CSE
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    const Int* targetBuf = A.LockedTargetBuffer();
+    offsets.assign( offsetBuf, offsetBuf+A.Height()+1 );
+    targets.assign( targetBuf, targetBuf+A.NumEntries() );
+}
+
+template<typename Real>
+void SaveLocalPattern
+( const DistSparseMatrix<Real>& A,
+  vector<Int>& offsets,
+  vector<Int>& targets )
+{
+    EL_DEBUG_CSE
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    const Int* targetBuf = A.LockedTargetBuffer();
+    offsets.assign( offsetBuf, offsetBuf+A.LocalHeight()+1 );
+    targets.assign( targetBuf, targetBuf+A.NumLocalEntries() );
+}
+
+template<typename Real,class VectorType>
+void WarmStartHelper
+( VectorType& x, VectorType& z, const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( !ctrl.primalInit || !ctrl.dualInit || ctrl.warmStartFloor <= Real(0) )
+        return;
+    const Real xFloor = ctrl.warmStartFloor*Max(MaxNorm(x),Real(1));
+    const Real zFloor = ctrl.warmStartFloor*Max(MaxNorm(z),Real(1));
+    LowerClip( x, xFloor );
+    LowerClip( z, zFloor );
+}
+
+template<typename Real>
+void WarmStart
+( Matrix<Real>& x, Matrix<Real>& z, const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    WarmStartHelper( x, z, ctrl );
+}
+
+template<typename Real>
+void WarmStart
+( DistMultiVec<Real>& x, DistMultiVec<Real>& z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    WarmStartHelper( x, z, ctrl );
+}
+
+#define PROTO(Real) \
+  template bool SamePattern \
+  ( const SparseMatrix<Real>& A, \
+    const vector<Int>& offsets, \
+    const vector<Int>& targets ); \
+  template bool SameLocalPattern \
+  ( const DistSparseMatrix<Real>& A, \
+    const vector<Int>& offsets, \
+    const vector<Int>& targets ); \
+  template void SavePattern \
+  ( const SparseMatrix<Real>& A, \
+    vector<Int>& offsets, \
+    vector<Int>& targets ); \
+  template void SaveLocalPattern \
+  ( const DistSparseMatrix<Real>& A, \
+    vector<Int>& offsets, \
+    vector<Int>& targets ); \
+  template void WarmStart \
+  ( Matrix<Real>& x, Matrix<Real>& z, const MehrotraCtrl<Real>& ctrl ); \
+  template void WarmStart \
+  ( DistMultiVec<Real>& x, DistMultiVec<Real>& z, \
+    const MehrotraCtrl<Real>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace direct
+} // namespace qp
+} // namespace El
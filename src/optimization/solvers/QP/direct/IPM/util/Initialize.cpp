@@ -71,6 +71,76 @@ namespace direct {
 //     <https://github.com/cvxopt/cvxopt/blob/f3ca94fb997979a54b913f95b816132f7fd44820/src/python/coneprog.py>
 //
 
+// Step (3) above, which is shared by every initialization
+template<typename Real,class VectorType>
+void ShiftIntoInteriorHelper
+( VectorType& x, VectorType& z,
+  bool primalInit, bool dualInit, bool standardShift )
+{
+    EL_DEBUG_CSE
+    const Real epsilon = limits::Epsilon<Real>();
+    const Real xNorm = Nrm2( x );
+    const Real zNorm = Nrm2( z );
+    const Real gammaPrimal = Sqrt(epsilon)*Max(xNorm,Real(1));
+    const Real gammaDual   = Sqrt(epsilon)*Max(zNorm,Real(1));
+    if( standardShift )
+    {
+        // alpha_p := min { alpha : x + alpha*e >= 0 }
+        // -------------------------------------------
+        const auto xMinPair = VectorMinLoc( x );
+        const Real alphaPrimal = -xMinPair.value;
+        if( alphaPrimal >= Real(0) && primalInit )
+            RuntimeError("initialized x was non-positive");
+
+        // alpha_d := min { alpha : z + alpha*e >= 0 }
+        // -------------------------------------------
+        const auto zMinPair = VectorMinLoc( z );
+        const Real alphaDual = -zMinPair.value;
+        if( alphaDual >= Real(0) && dualInit )
+            RuntimeError("initialized z was non-positive");
+
+        if( alphaPrimal >= -gammaPrimal )
+            Shift( x, alphaPrimal+1 );
+        if( alphaDual >= -gammaDual )
+            Shift( z, alphaDual+1 );
+    }
+    else
+    {
+        LowerClip( x, gammaPrimal );
+        LowerClip( z, gammaDual   );
+    }
+}
+
+template<typename Real>
+void ShiftIntoInterior
+( Matrix<Real>& x, Matrix<Real>& z,
+  bool primalInit, bool dualInit, bool standardShift )
+{
+    EL_DEBUG_CSE
+    ShiftIntoInteriorHelper<Real>
+    ( x, z, primalInit, dualInit, standardShift );
+}
+
+template<typename Real>
+void ShiftIntoInterior
+( ElementalMatrix<Real>& x, ElementalMatrix<Real>& z,
+  bool primalInit, bool dualInit, bool standardShift )
+{
+    EL_DEBUG_CSE
+    ShiftIntoInteriorHelper<Real>
+    ( x, z, primalInit, dualInit, standardShift );
+}
+
+template<typename Real>
+void ShiftIntoInterior
+( DistMultiVec<Real>& x, DistMultiVec<Real>& z,
+  bool primalInit, bool dualInit, bool standardShift )
+{
+    EL_DEBUG_CSE
+    ShiftIntoInteriorHelper<Real>
+    ( x, z, primalInit, dualInit, standardShift );
+}
+
 template<typename Real>
 void Initialize
 ( const Matrix<Real>& Q,
@@ -145,37 +215,7 @@ void Initialize
         z *= -1;
     }
 
-    const Real epsilon = limits::Epsilon<Real>();
-    const Real xNorm = Nrm2( x );
-    const Real zNorm = Nrm2( z );
-    const Real gammaPrimal = Sqrt(epsilon)*Max(xNorm,Real(1));
-    const Real gammaDual   = Sqrt(epsilon)*Max(zNorm,Real(1));
-    if( standardShift )
-    {
-        // alpha_p := min { alpha : x + alpha*e >= 0 }
-        // -------------------------------------------
-        const auto xMinPair = VectorMinLoc( x );
-        const Real alphaPrimal = -xMinPair.value;
-        if( alphaPrimal >= Real(0) && primalInit )
-            RuntimeError("initialized x was non-positive");
-
-        // alpha_d := min { alpha : z + alpha*e >= 0 }
-        // -------------------------------------------
-        const auto zMinPair = VectorMinLoc( z );
-        const Real alphaDual = -zMinPair.value;
-        if( alphaDual >= Real(0) && dualInit )
-            RuntimeError("initialized z was non-positive");
-
-        if( alphaPrimal >= -gammaPrimal )
-            Shift( x, alphaPrimal+1 );
-        if( alphaDual >= -gammaDual )
-            Shift( z, alphaDual+1 );
-    }
-    else
-    {
-        LowerClip( x, gammaPrimal );
-        LowerClip( z, gammaDual   );
-    }
+    ShiftIntoInterior( x, z, primalInit, dualInit, standardShift );
 }
 
 template<typename Real>
@@ -253,37 +293,7 @@ void Initialize
         z *= -1;
     }
 
-    const Real epsilon = limits::Epsilon<Real>();
-    const Real xNorm = Nrm2( x );
-    const Real zNorm = Nrm2( z );
-    const Real gammaPrimal = Sqrt(epsilon)*Max(xNorm,Real(1));
-    const Real gammaDual   = Sqrt(epsilon)*Max(zNorm,Real(1));
-    if( standardShift )
-    {
-        // alpha_p := min { alpha : x + alpha*e >= 0 }
-        // -------------------------------------------
-        const auto xMinPair = VectorMinLoc( x );
-        const Real alphaPrimal = -xMinPair.value;
-        if( alphaPrimal >= Real(0) && primalInit )
-            RuntimeError("initialized x was non-positive");
-
-        // alpha_d := min { alpha : z + alpha*e >= 0 }
-        // -------------------------------------------
-        const auto zMinPair = VectorMinLoc( z );
-        const Real alphaDual = -zMinPair.value;
-        if( alphaDual >= Real(0) && dualInit )
-            RuntimeError("initialized z was non-positive");
-
-        if( alphaPrimal >= -gammaPrimal )
-            Shift( x, alphaPrimal+1 );
-        if( alphaDual >= -gammaDual )
-            Shift( z, alphaDual+1 );
-    }
-    else
-    {
-        LowerClip( x, gammaPrimal );
-        LowerClip( z, gammaDual   );
-    }
+    ShiftIntoInterior( x, z, primalInit, dualInit, standardShift );
 }
 
 template<typename Real>
@@ -297,7 +307,8 @@ void Initialize
         Matrix<Real>& z,
         SparseLDLFactorization<Real>& sparseLDLFact,
   bool primalInit, bool dualInit, bool standardShift,
-  const RegSolveCtrl<Real>& solveCtrl )
+  const RegSolveCtrl<Real>& solveCtrl,
+  bool reuseAnalysis )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -346,9 +357,16 @@ void Initialize
     }
     UpdateRealPartOfDiagonal( J, Real(1), reg );
 
-    const bool hermitian = true;
-    const BisectCtrl bisectCtrl;
-    sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+    if( reuseAnalysis )
+    {
+        sparseLDLFact.ChangeNonzeroValues( J );
+    }
+    else
+    {
+        const bool hermitian = true;
+        const BisectCtrl bisectCtrl;
+        sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+    }
     sparseLDLFact.Factor( LDL_2D );
 
     // Compute the proposed step from the KKT system
@@ -393,37 +411,7 @@ void Initialize
         z *= -1;
     }
 
-    const Real epsilon = limits::Epsilon<Real>();
-    const Real xNorm = Nrm2( x );
-    const Real zNorm = Nrm2( z );
-    const Real gammaPrimal = Sqrt(epsilon)*Max(xNorm,Real(1));
-    const Real gammaDual   = Sqrt(epsilon)*Max(zNorm,Real(1));
-    if( standardShift )
-    {
-        // alpha_p := min { alpha : x + alpha*e >= 0 }
-        // -------------------------------------------
-        const auto xMinPair = VectorMinLoc( x );
-        const Real alphaPrimal = -xMinPair.value;
-        if( alphaPrimal >= Real(0) && primalInit )
-            RuntimeError("initialized x was non-positive");
-
-        // alpha_d := min { alpha : z + alpha*e >= 0 }
-        // -------------------------------------------
-        const auto zMinPair = VectorMinLoc( z );
-        const Real alphaDual = -zMinPair.value;
-        if( alphaDual >= Real(0) && dualInit )
-            RuntimeError("initialized z was non-positive");
-
-        if( alphaPrimal >= -gammaPrimal )
-            Shift( x, alphaPrimal+1 );
-        if( alphaDual >= -gammaDual )
-            Shift( z, alphaDual+1 );
-    }
-    else
-    {
-        LowerClip( x, gammaPrimal );
-        LowerClip( z, gammaDual   );
-    }
+    ShiftIntoInterior( x, z, primalInit, dualInit, standardShift );
 }
 
 template<typename Real>
@@ -437,7 +425,8 @@ void Initialize
         DistMultiVec<Real>& z,
         DistSparseLDLFactorization<Real>& sparseLDLFact,
   bool primalInit, bool dualInit, bool standardShift,
-  const RegSolveCtrl<Real>& solveCtrl )
+  const RegSolveCtrl<Real>& solveCtrl,
+  bool reuseAnalysis )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -488,9 +477,16 @@ void Initialize
     }
     UpdateRealPartOfDiagonal( J, Real(1), reg );
 
-    const bool hermitian = true;
-    const BisectCtrl bisectCtrl;
-    sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+    if( reuseAnalysis )
+    {
+        sparseLDLFact.ChangeNonzeroValues( J );
+    }
+    else
+    {
+        const bool hermitian = true;
+        const BisectCtrl bisectCtrl;
+        sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+    }
     sparseLDLFact.Factor( LDL_2D );
 
     // Compute the proposed step from the KKT system
@@ -535,40 +531,19 @@ void Initialize
         z *= -1;
     }
 
-    const Real epsilon = limits::Epsilon<Real>();
-    const Real xNorm = Nrm2( x );
-    const Real zNorm = Nrm2( z );
-    const Real gammaPrimal = Sqrt(epsilon)*Max(xNorm,Real(1));
-    const Real gammaDual   = Sqrt(epsilon)*Max(zNorm,Real(1));
-    if( standardShift )
-    {
-        // alpha_p := min { alpha : x + alpha*e >= 0 }
-        // -------------------------------------------
-        const auto xMinPair = VectorMinLoc( x );
-        const Real alphaPrimal = -xMinPair.value;
-        if( alphaPrimal >= Real(0) && primalInit )
-            RuntimeError("initialized x was non-positive");
-
-        // alpha_d := min { alpha : z + alpha*e >= 0 }
-        // -------------------------------------------
-        const auto zMinPair = VectorMinLoc( z );
-        const Real alphaDual = -zMinPair.value;
-        if( alphaDual >= Real(0) && dualInit )
-            RuntimeError("initialized z was non-positive");
-
-        if( alphaPrimal >= -gammaPrimal )
-            Shift( x, alphaPrimal+1 );
-        if( alphaDual >= -gammaDual )
-            Shift( z, alphaDual+1 );
-    }
-    else
-    {
-        LowerClip( x, gammaPrimal );
-        LowerClip( z, gammaDual   );
-    }
+    ShiftIntoInterior( x, z, primalInit, dualInit, standardShift );
 }
 
 #define PROTO(Real) \
+  template void ShiftIntoInterior \
+  ( Matrix<Real>& x, Matrix<Real>& z, \
+    bool primalInit, bool dualInit, bool standardShift ); \
+  template void ShiftIntoInterior \
+  ( ElementalMatrix<Real>& x, ElementalMatrix<Real>& z, \
+    bool primalInit, bool dualInit, bool standardShift ); \
+  template void ShiftIntoInterior \
+  ( DistMultiVec<Real>& x, DistMultiVec<Real>& z, \
+    bool primalInit, bool dualInit, bool standardShift ); \
   template void Initialize \
   ( const Matrix<Real>& Q, \
     const Matrix<Real>& A, \
@@ -597,7 +572,8 @@ void Initialize
           Matrix<Real>& z, \
           SparseLDLFactorization<Real>& sparseLDLFact, \
     bool primalInit, bool dualInit, bool standardShift, \
-    const RegSolveCtrl<Real>& solveCtrl ); \
+    const RegSolveCtrl<Real>& solveCtrl, \
+    bool reuseAnalysis ); \
   template void Initialize \
   ( const DistSparseMatrix<Real>& Q, \
     const DistSparseMatrix<Real>& A, \
@@ -608,7 +584,8 @@ void Initialize
           DistMultiVec<Real>& z, \
           DistSparseLDLFactorization<Real>& sparseLDLFact, \
     bool primalInit, bool dualInit, bool standardShift, \
-    const RegSolveCtrl<Real>& solveCtrl );
+    const RegSolveCtrl<Real>& solveCtrl, \
+    bool reuseAnalysis );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -0,0 +1,117 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the packed, register-blocked Gemm used for the extended-precision
+// datatypes against the triple loop which it replaced
+template<typename T>
+void TestBlockedGemm
+( char transA, char transB, Int m, Int n, Int k, bool print )
+{
+    Output("Testing with ",TypeName<T>());
+    PushIndent();
+
+    const T alpha=3, beta=4;
+    Matrix<T> A, B, C;
+    if( transA == 'N' )
+        Uniform( A, m, k );
+    else
+        Uniform( A, k, m );
+    if( transB == 'N' )
+        Uniform( B, k, n );
+    else
+        Uniform( B, n, k );
+    Uniform( C, m, n );
+    auto CUnb( C );
+    if( print )
+    {
+        Print( A, "A" );
+        Print( B, "B" );
+        Print( C, "C" );
+    }
+
+    double gFlops = (2.*m*n*k)/1.e9;
+    if( IsComplex<T>::value )
+        gFlops *= 4;
+
+    Timer timer;
+    timer.Start();
+    blas::UnblockedGemm
+    ( transA, transB, BlasInt(m), BlasInt(n), BlasInt(k),
+      alpha, A.LockedBuffer(), BlasInt(A.LDim()),
+             B.LockedBuffer(), BlasInt(B.LDim()),
+      beta,  CUnb.Buffer(),    BlasInt(CUnb.LDim()) );
+    const double unbTime = timer.Stop();
+    Output("Unblocked: ",unbTime," seconds (",gFlops/unbTime," GFlop/s)");
+
+    timer.Start();
+    blas::BlockedGemm
+    ( transA, transB, BlasInt(m), BlasInt(n), BlasInt(k),
+      alpha, A.LockedBuffer(), BlasInt(A.LDim()),
+             B.LockedBuffer(), BlasInt(B.LDim()),
+      beta,  C.Buffer(),       BlasInt(C.LDim()) );
+    const double blockedTime = timer.Stop();
+    Output
+    ("Blocked:   ",blockedTime," seconds (",gFlops/blockedTime," GFlop/s)");
+    Output("Speedup: ",unbTime/blockedTime);
+    if( print )
+        Print( C, "C := alpha op(A) op(B) + beta C" );
+
+    const Base<T> CFrobNorm = FrobeniusNorm( CUnb );
+    CUnb -= C;
+    const Base<T> EFrobNorm = FrobeniusNorm( CUnb );
+    Output("|| E ||_F / || C ||_F = ",EFrobNorm/CFrobNorm);
+    if( EFrobNorm > Base<T>(10*k)*limits::Epsilon<Base<T>>()*CFrobNorm )
+        LogicError("Blocked and unblocked Gemm differed too much");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const char transA = Input("--transA","orientation of A: N/T/C",'N');
+        const char transB = Input("--transB","orientation of B: N/T/C",'N');
+        const Int m = Input("--m","height of result",200);
+        const Int n = Input("--n","width of result",200);
+        const Int k = Input("--k","inner dimension",200);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(comm) == 0 )
+        {
+#ifdef EL_HAVE_QD
+            TestBlockedGemm<DoubleDouble>( transA, transB, m, n, k, print );
+            TestBlockedGemm<Complex<DoubleDouble>>
+            ( transA, transB, m, n, k, print );
+            TestBlockedGemm<QuadDouble>( transA, transB, m, n, k, print );
+            TestBlockedGemm<Complex<QuadDouble>>
+            ( transA, transB, m, n, k, print );
+#endif
+#ifdef EL_HAVE_QUAD
+            TestBlockedGemm<Quad>( transA, transB, m, n, k, print );
+            TestBlockedGemm<Complex<Quad>>( transA, transB, m, n, k, print );
+#endif
+        }
+    }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
@@ -12,6 +12,8 @@
 #include <El.hpp>
 #include <random>
 #include <stdexcept>
+#include <cmath>
+#include <limits>
 
 using namespace El;
 
@@ -45,6 +47,197 @@ void TestMultiply(Int m, Int n=1)
         Output("Test passed");
 }
 
+// Multiply twice so that the second product uses the secondary format, and
+// check that it matches the CSR product, including which rows are NaN
+template<typename Real>
+void CompareWithCSR
+( const SparseMatrix<Real>& A, const Matrix<Real>& X, SparseMultFormat format )
+{
+    const Int m = A.Height();
+    const Int n = X.Width();
+    Matrix<Real> YCSR, Y;
+    Zeros( YCSR, m, n );
+    Zeros( Y, m, n );
+    A.multMeta.Clear();
+    Multiply( NORMAL, Real(1), A, X, Real(0), YCSR );
+    Multiply( NORMAL, Real(1), A, X, Real(0), Y );
+    if( A.multMeta.format != format )
+        LogicError("The expected secondary format was not chosen");
+
+    const Real tol = 10*limits::Epsilon<Real>();
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            const bool nanCSR = std::isnan( YCSR(i,j) );
+            if( std::isnan( Y(i,j) ) != nanCSR )
+                RuntimeError
+                ("Entry (",i,",",j,") was ",Y(i,j)," rather than ",
+                 YCSR(i,j));
+            const Real scale = Max(Abs(YCSR(i,j)),Real(1));
+            if( !nanCSR && Abs(Y(i,j)-YCSR(i,j)) > tol*scale )
+                RuntimeError
+                ("Entry (",i,",",j,") was ",Y(i,j)," rather than ",
+                 YCSR(i,j));
+        }
+    }
+}
+
+template<typename Real>
+void TestSecondaryFormats()
+{
+    EL_DEBUG_CSE
+    Output("Testing secondary formats with ",TypeName<Real>());
+    const Real nan = std::numeric_limits<Real>::quiet_NaN();
+
+    // 2x2 block tridiagonal with dense diagonal blocks and off-diagonal
+    // blocks missing their (1,1) entry, which BCSR pads with a zero. The
+    // height is not divisible by three or four so that the block size is two.
+    {
+        const Int numBlocks = 35;
+        const Int m = 2*numBlocks;
+        SparseMatrix<Real> A;
+        Zeros( A, m, m );
+        A.Reserve( 10*numBlocks );
+        for( Int b=0; b<numBlocks; ++b )
+        {
+            for( Int r=0; r<2; ++r )
+                for( Int c=0; c<2; ++c )
+                    A.QueueUpdate( 2*b+r, 2*b+c, SampleUniform<Real>(-1,1) );
+            for( Int bOff : { b-1, b+1 } )
+            {
+                if( bOff < 0 || bOff >= numBlocks )
+                    continue;
+                A.QueueUpdate( 2*b,   2*bOff,   SampleUniform<Real>(-1,1) );
+                A.QueueUpdate( 2*b,   2*bOff+1, SampleUniform<Real>(-1,1) );
+                A.QueueUpdate( 2*b+1, 2*bOff,   SampleUniform<Real>(-1,1) );
+            }
+        }
+        A.ProcessQueues();
+
+        Matrix<Real> X;
+        Uniform( X, m, 2 );
+        X(3,0) = nan;
+        CompareWithCSR( A, X, SPARSE_MULT_BCSR );
+    }
+
+    // Bidiagonal (with wraparound) plus an extra entry in every fifth row so
+    // that SELL pads one chunk, with its padding referring to column zero
+    {
+        const Int m = 64;
+        SparseMatrix<Real> A;
+        Zeros( A, m, m );
+        A.Reserve( 3*m );
+        for( Int i=0; i<m; ++i )
+        {
+            A.QueueUpdate( i, i, SampleUniform<Real>(-1,1) );
+            A.QueueUpdate( i, (i+1)%m, SampleUniform<Real>(-1,1) );
+            if( i % 5 == 0 )
+                A.QueueUpdate( i, (i+2)%m, SampleUniform<Real>(-1,1) );
+        }
+        A.ProcessQueues();
+
+        Matrix<Real> X;
+        Uniform( X, m, 2 );
+        X(0,1) = nan;
+        CompareWithCSR( A, X, SPARSE_MULT_SELL );
+    }
+    Output("Test passed");
+}
+
+template<typename Real>
+void CheckDifference
+( const Matrix<Real>& Y, const Matrix<Real>& YRef, const string& msg )
+{
+    Matrix<Real> E( Y );
+    E -= YRef;
+    const Real tol =
+      10*limits::Epsilon<Real>()*Max(FrobeniusNorm(YRef),Real(1));
+    if( FrobeniusNorm(E) > tol )
+        RuntimeError(msg," differed from the explicit transpose by ",
+                     FrobeniusNorm(E));
+}
+
+// Compare transposed products against normal products with the explicit
+// transpose. They are each repeated so that the cached compressed-column
+// mirrors are reused, and the sequential matrix is then modified so that a
+// stale mirror would be detected.
+template<typename Real>
+void TestTranspose( const Grid& grid, Int m, Int n, Int numRHS )
+{
+    EL_DEBUG_CSE
+    OutputFromRoot
+    (grid.Comm(),"Testing transposed products with ",TypeName<Real>());
+
+    SparseMatrix<Real> A, AT;
+    Zeros( A, m, n );
+    A.Reserve( 3*m );
+    for( Int i=0; i<m; ++i )
+    {
+        A.QueueUpdate( i, i%n, Real(i+1) );
+        A.QueueUpdate( i, (7*i+3)%n, Real(1)/(i+1) );
+        A.QueueUpdate( i, (13*i+5)%n, Real(-2) );
+    }
+    A.ProcessQueues();
+
+    Matrix<Real> X, Y, YRef;
+    Uniform( X, m, numRHS );
+    for( Int rep=0; rep<2; ++rep )
+    {
+        Transpose( A, AT );
+        Zeros( Y, n, numRHS );
+        Zeros( YRef, n, numRHS );
+        for( Int k=0; k<2; ++k )
+            Multiply( TRANSPOSE, Real(1), A, X, Real(k), Y );
+        Multiply( NORMAL, Real(2), AT, X, Real(0), YRef );
+        CheckDifference( Y, YRef, "A^T X" );
+
+        const Graph& G = A.LockedGraph();
+        const Graph& GT = AT.LockedGraph();
+        for( Int k=0; k<2; ++k )
+            Multiply( TRANSPOSE, Real(1), G, X, Real(0), Y );
+        Multiply( NORMAL, Real(1), GT, X, Real(0), YRef );
+        CheckDifference( Y, YRef, "G^T X" );
+
+        // Modify the sparsity pattern so that the mirrors must be rebuilt
+        A.Reserve( m );
+        for( Int i=0; i<m; ++i )
+            A.QueueUpdate( i, (i+n/2)%n, Real(3) );
+        A.ProcessQueues();
+    }
+
+    DistSparseMatrix<Real> ADist(grid), ATDist(grid);
+    ADist.Resize( m, n );
+    const Int localHeight = ADist.LocalHeight();
+    ADist.Reserve( 3*localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = ADist.GlobalRow(iLoc);
+        ADist.QueueLocalUpdate( iLoc, i%n, Real(i+1) );
+        ADist.QueueLocalUpdate( iLoc, (7*i+3)%n, Real(1)/(i+1) );
+        ADist.QueueLocalUpdate( iLoc, (13*i+5)%n, Real(-2) );
+    }
+    ADist.ProcessLocalQueues();
+    Transpose( ADist, ATDist );
+
+    DistMultiVec<Real> XDist(grid), YDist(grid), YRefDist(grid);
+    Uniform( XDist, m, numRHS );
+    Zeros( YDist, n, numRHS );
+    Zeros( YRefDist, n, numRHS );
+    for( Int k=0; k<2; ++k )
+        Multiply( TRANSPOSE, Real(1), ADist, XDist, Real(k), YDist );
+    Multiply( NORMAL, Real(2), ATDist, XDist, Real(0), YRefDist );
+    YDist -= YRefDist;
+    const Real errorDist = FrobeniusNorm( YDist );
+    const Real tol =
+      10*limits::Epsilon<Real>()*Max(FrobeniusNorm(YRefDist),Real(1));
+    if( errorDist > tol )
+        RuntimeError
+        ("Distributed A^T X differed from the explicit transpose by ",
+         errorDist);
+    OutputFromRoot(grid.Comm(),"Test passed");
+}
+
 void RunTests( Int m )
 {
     PushIndent();
@@ -81,6 +274,12 @@ int main( int argc, char* argv[] )
             Output("Testing with matrix height of ",m);
             RunTests(m);
         }
+        TestSecondaryFormats<float>();
+        TestSecondaryFormats<double>();
+
+        const Grid grid( mpi::COMM_WORLD );
+        TestTranspose<float>( grid, 300, 200, 3 );
+        TestTranspose<double>( grid, 300, 200, 3 );
     }
     catch( exception& e ) { ReportException(e); }
     return 0;
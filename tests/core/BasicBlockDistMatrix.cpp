@@ -25,9 +25,14 @@ main( int argc, char* argv[] )
         const Int nb = Input("--blockWidth","width of dist block",32);
         const bool print = Input("--print","print wrong matrices?",false);
         const bool fullTriangle = Input("--fullTriangle","full Schur?",true);
+        const bool redistPlans =
+          Input("--redistPlans","cache redistribution plans?",false);
         ProcessInput();
         PrintInputReport();
 
+        if( redistPlans )
+            EnableRedistPlans();
+
         if( gridHeight == 0 )
             gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
         const GridOrder order = colMajor ? COLUMN_MAJOR : ROW_MAJOR;
@@ -48,6 +53,15 @@ main( int argc, char* argv[] )
         A = AElem;
         if( print )
             Print( A, "A" );
+
+        // Redistribute back with the same pair of distributions (which
+        // reuses the plan, if one was cached)
+        DistMatrix<Complex<double>> AElemCopy( A );
+        AElemCopy -= AElem;
+        const double roundTripError = FrobeniusNorm( AElemCopy );
+        OutputFromRoot(comm,"|| A - AElem ||_F = ",roundTripError);
+        if( roundTripError != 0. )
+            LogicError("Redistribution round trip was not exact");
 #ifdef EL_HAVE_SCALAPACK
         // NOTE: There appears to be a bug in the parallel eigenvalue
         //       reordering in ScaLAPACK's P{S,D}HSEQR (within P{S,D}TRORD).
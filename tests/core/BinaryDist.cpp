@@ -0,0 +1,111 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <El/core/types.h>
+using namespace El;
+
+// Every file extension should map back to its format
+void TestExtensions()
+{
+    for( int j=1; j<FileFormat_MAX; ++j )
+    {
+        const FileFormat format = static_cast<FileFormat>(j);
+        if( FormatFromExtension(FileExtension(format)) != format )
+            LogicError
+            ("Extension ",FileExtension(format)," did not map to format ",j);
+    }
+    if( DetectFormat("checkpoint.dbin") != BINARY_DIST )
+        LogicError("A .dbin file was not detected as BINARY_DIST");
+    if( int(BINARY_DIST) != int(EL_BINARY_DIST) ||
+        int(XPM) != int(EL_XPM) ||
+        int(FileFormat_MAX) != int(EL_FileFormat_MAX) )
+        LogicError("The C and C++ file formats differ");
+}
+
+template<typename T>
+void CheckEqual( const ElementalMatrix<T>& A, const ElementalMatrix<T>& B )
+{
+    DistMatrix<T> E( B );
+    Axpy( T(-1), A, E );
+    const Base<T> diff = FrobeniusNorm( E );
+    if( diff != Base<T>(0) )
+        LogicError("The round trip differed by ",diff);
+}
+
+// Write A in one distribution and read it back into several others, both
+// in parallel and through the sequential path
+template<typename T,Dist U,Dist V>
+void TestRoundTrip
+( Int m, Int n, const Grid& grid, const string& basename )
+{
+    OutputFromRoot
+    (grid.Comm(),"Testing [",DistToString(U),",",DistToString(V),"] with ",
+     TypeName<T>());
+    DistMatrix<T,U,V> A(grid);
+    Uniform( A, m, n );
+    Write( A, basename, BINARY_DIST );
+    const string filename = basename + "." + FileExtension(BINARY_DIST);
+
+    DistMatrix<T> B(grid);
+    Read( B, filename );
+    CheckEqual( A, B );
+
+    DistMatrix<T,VC,STAR> C(grid);
+    Read( C, filename, BINARY_DIST );
+    CheckEqual( A, C );
+
+    DistMatrix<T,STAR,STAR> D(grid);
+    Read( D, filename, BINARY_DIST );
+    CheckEqual( A, D );
+
+    DistMatrix<T> BSeq(grid);
+    const bool sequential = true;
+    Read( BSeq, filename, BINARY_DIST, sequential );
+    CheckEqual( A, BSeq );
+
+    // Every process may read the whole file into a local matrix
+    Matrix<T> ALoc;
+    Read( ALoc, filename );
+    DistMatrix<T,STAR,STAR> ACopy( A );
+    ALoc -= ACopy.Matrix();
+    if( FrobeniusNorm(ALoc) != Base<T>(0) )
+        LogicError("The sequential read of the file differed");
+
+    mpi::Barrier( grid.Comm() );
+    if( grid.Rank() == 0 )
+        std::remove( filename.c_str() );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",37);
+        const Int n = Input("--n","width of matrix",23);
+        const string basename =
+          Input("--basename","basename of the scratch file",
+                string("BinaryDistTest"));
+        ProcessInput();
+        PrintInputReport();
+
+        TestExtensions();
+
+        const Grid grid( comm );
+        TestRoundTrip<double,MC,MR>( m, n, grid, basename );
+        TestRoundTrip<double,STAR,VR>( m, n, grid, basename );
+        TestRoundTrip<Complex<double>,MC,MR>( m, n, grid, basename );
+        TestRoundTrip<Complex<float>,MR,MC>( m, n, grid, basename );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
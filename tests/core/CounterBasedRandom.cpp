@@ -0,0 +1,144 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Known-answer tests from the Random123 distribution (kat_vectors), with the
+// 128-bit counter and 64-bit key unpacked into our (i,j,stream,seed) layout
+void TestPhilox()
+{
+    struct KAT
+    {
+        std::uint64_t i, j;
+        std::uint32_t stream;
+        std::uint64_t seed;
+        std::array<std::uint32_t,4> result;
+    };
+    const KAT kats[] =
+    {
+      {0ull, 0ull, 0u, 0ull,
+       {{0x6627e8d5u,0xe169c58du,0xbc57ac4cu,0x9b00dbd8u}}},
+      {0xffffffffffffull, 0xffffffffffffull, 0xffffffffu,
+       0xffffffffffffffffull,
+       {{0x408f276du,0x41c83b0eu,0xa20bc7c6u,0x6d5451fdu}}},
+      {0x7344243f6a88ull, 0x037085a308d3ull, 0x13198a2eu,
+       0x299f31d0a4093822ull,
+       {{0xd16cfe09u,0x94fdccebu,0x5001e420u,0x24126ea1u}}}
+    };
+    for( const auto& kat : kats )
+    {
+        const auto result = Philox4x32( kat.i, kat.j, kat.stream, kat.seed );
+        if( result != kat.result )
+            LogicError
+            ("Philox4x32-10 returned (",result[0],",",result[1],",",
+             result[2],",",result[3],") rather than (",kat.result[0],",",
+             kat.result[1],",",kat.result[2],",",kat.result[3],")");
+    }
+    OutputFromRoot(mpi::COMM_WORLD,"Philox4x32-10 known answers passed");
+}
+
+// Every distributed fill after a call to SetCounterBasedSeed should
+// reproduce the reference
+template<Dist U,Dist V>
+void TestGrid( const Grid& g, const Matrix<double>& ARef )
+{
+    const Int m = ARef.Height();
+    const Int n = ARef.Width();
+    DistMatrix<double,U,V> A(g);
+    Uniform( A, m, n );
+
+    double maxDiff = 0;
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            maxDiff =
+              Max(maxDiff,
+                  Abs(A.GetLocal(iLoc,jLoc)-
+                      ARef(A.GlobalRow(iLoc),A.GlobalCol(jLoc))));
+    maxDiff = mpi::AllReduce( maxDiff, mpi::MAX, g.ViewingComm() );
+    if( maxDiff != 0 )
+        LogicError
+        ("[",DistToString(U),",",DistToString(V),"] fill on a ",g.Height(),
+         " x ",g.Width()," grid differed from the reference by ",maxDiff);
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        const Int m = Input("--m","height of matrices",37);
+        const Int n = Input("--n","width of matrices",23);
+        const Int seed = Input("--seed","counter-based key",17);
+        ProcessInput();
+        PrintInputReport();
+
+        TestPhilox();
+        SetCounterBasedRandom( true );
+
+        // Every process holds a full copy of the reference
+        SetCounterBasedSeed( seed );
+        DistMatrix<double,STAR,STAR> ARef_STAR_STAR( m, n );
+        Uniform( ARef_STAR_STAR, m, n );
+        const Matrix<double> ARef = ARef_STAR_STAR.Matrix();
+
+        for( Int gridHeight=1; gridHeight<=commSize; ++gridHeight )
+        {
+            if( commSize % gridHeight != 0 )
+                continue;
+            const Grid g( comm, gridHeight );
+            SetCounterBasedSeed( seed );
+            TestGrid<MC,  MR  >( g, ARef );
+            SetCounterBasedSeed( seed );
+            TestGrid<MC,  STAR>( g, ARef );
+            SetCounterBasedSeed( seed );
+            TestGrid<STAR,MR  >( g, ARef );
+            SetCounterBasedSeed( seed );
+            TestGrid<VC,  STAR>( g, ARef );
+            SetCounterBasedSeed( seed );
+            TestGrid<STAR,VR  >( g, ARef );
+            SetCounterBasedSeed( seed );
+            TestGrid<STAR,STAR>( g, ARef );
+        }
+        OutputFromRoot(comm,"Counter-based fills were grid independent");
+
+        // A process-local fill on a subset of the processes must neither
+        // desynchronize nor perturb the distributed streams
+        const Grid g( comm );
+        SetCounterBasedSeed( seed );
+        if( commRank == 0 )
+        {
+            Matrix<double> X;
+            Uniform( X, m, n );
+        }
+        TestGrid<MC,STAR>( g, ARef );
+
+        // ...and process-local fills should differ between processes
+        Matrix<double> X, XRoot;
+        Uniform( X, m, n );
+        XRoot = X;
+        mpi::Broadcast( XRoot.Buffer(), m*n, 0, comm );
+        if( commRank != 0 )
+        {
+            XRoot -= X;
+            if( FrobeniusNorm(XRoot) == double(0) )
+                LogicError
+                ("Process ",commRank," drew the same local matrix as the root");
+        }
+        OutputFromRoot(comm,"Counter-based stream synchronization passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,96 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the pack/unpack and derived-datatype implementations of the
+// column and row AllGather redistributions for correctness and performance
+
+template<typename T,Dist U,Dist V>
+double TimeRedist
+( const DistMatrix<T>& A, DistMatrix<T,U,V>& B, Int numReps )
+{
+    mpi::Barrier( A.Grid().Comm() );
+    Timer timer;
+    timer.Start();
+    for( Int rep=0; rep<numReps; ++rep )
+        B = A;
+    mpi::Barrier( A.Grid().Comm() );
+    return timer.Stop() / numReps;
+}
+
+template<typename T,Dist U,Dist V>
+void CompareRedist
+( const DistMatrix<T>& A, Int numReps, const string& label )
+{
+    const Grid& grid = A.Grid();
+    DistMatrix<T,U,V> BPacked(grid), BDerived(grid);
+
+    DisableDerivedDatatypes();
+    const double packedTime = TimeRedist( A, BPacked, numReps );
+    EnableDerivedDatatypes();
+    const double derivedTime = TimeRedist( A, BDerived, numReps );
+    DisableDerivedDatatypes();
+
+    Axpy( T(-1), BPacked, BDerived );
+    const Base<T> error = FrobeniusNorm( BDerived );
+    OutputFromRoot
+    (grid.Comm(),label,": packed=",packedTime,"s, derived=",derivedTime,
+     "s, || BPacked - BDerived ||_F = ",error);
+    if( error != Base<T>(0) )
+        LogicError("Derived-datatype redistribution was incorrect");
+}
+
+template<typename T>
+void TestRedists( const Grid& grid, Int m, Int n, Int numReps )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+    DistMatrix<T> A(grid);
+    Uniform( A, m, n );
+    CompareRedist<T,MC,STAR>( A, numReps, "[MC,MR] -> [MC,* ]" );
+    CompareRedist<T,STAR,MR>( A, numReps, "[MC,MR] -> [* ,MR]" );
+
+    // Also test a redistribution with a nonzero alignment
+    auto ASub = A( IR(1,m), IR(1,n) );
+    CompareRedist<T,MC,STAR>( ASub, numReps, "[MC,MR] -> [MC,* ] (offset)" );
+    CompareRedist<T,STAR,MR>( ASub, numReps, "[MC,MR] -> [* ,MR] (offset)" );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const Int m = Input("--height","height of matrix",2000);
+        const Int n = Input("--width","width of matrix",2000);
+        const Int numReps = Input("--numReps","number of repetitions",10);
+        ProcessInput();
+        PrintInputReport();
+
+        if( m < 2 || n < 2 )
+            LogicError("The matrix must be at least 2 x 2");
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const Grid grid( comm, gridHeight );
+
+        TestRedists<float>( grid, m, n, numReps );
+        TestRedists<Complex<float>>( grid, m, n, numReps );
+        TestRedists<double>( grid, m, n, numReps );
+        TestRedists<Complex<double>>( grid, m, n, numReps );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
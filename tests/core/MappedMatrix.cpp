@@ -0,0 +1,123 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckEqual
+( const Matrix<T>& A, const Matrix<T>& AExpected, const string& label )
+{
+    Matrix<T> E( A );
+    E -= AExpected;
+    const Base<T> diff = FrobeniusNorm( E );
+    if( diff != Base<T>(0) )
+        LogicError(label," differed by ",diff);
+}
+
+template<typename T>
+Matrix<T> ReadFlat( const string& filename, Int m, Int n )
+{
+    Matrix<T> A( m, n );
+    Read( A, filename, BINARY_FLAT );
+    return A;
+}
+
+// Map an existing file, modify it through a writable view, and check that
+// the modifications reach the file
+template<typename T>
+void TestRoundTrip( Int m, Int n, const string& basename )
+{
+    Output("Testing with ",TypeName<T>());
+    PushIndent();
+    Matrix<T> A;
+    Uniform( A, m, n );
+    Write( A, basename, BINARY_FLAT );
+    const string filename = basename + "." + FileExtension(BINARY_FLAT);
+
+    {
+        const MappedMatrix<T> mapped( filename, m, n );
+        CheckEqual( mapped.LockedMatrix(), A, "Read-only mapping" );
+    }
+    {
+        MappedMatrix<T> mapped( filename, m, n );
+        bool threw = false;
+        try { mapped.Matrix(); }
+        catch( std::exception& ) { threw = true; }
+        if( !threw )
+            LogicError("A read-only mapping provided a mutable view");
+    }
+
+    {
+        MappedMatrix<T> mapped( filename, m, n, true );
+        auto& AMapped = mapped.Matrix();
+        CheckEqual( AMapped, A, "Writable mapping" );
+        AMapped *= T(2);
+        AMapped(m-1,0) = T(3);
+        AMapped(0,n-1) = T(-5);
+        mapped.Flush();
+        CheckEqual
+        ( ReadFlat<T>( filename, m, n ), AMapped, "File after Flush" );
+        AMapped(m/2,n/2) = T(7);
+    }
+    A *= T(2);
+    A(m-1,0) = T(3);
+    A(0,n-1) = T(-5);
+    A(m/2,n/2) = T(7);
+    CheckEqual( ReadFlat<T>( filename, m, n ), A, "File after unmapping" );
+    {
+        const MappedMatrix<T> mapped( filename, m, n );
+        CheckEqual( mapped.LockedMatrix(), A, "Remapped file" );
+    }
+
+    // The size of the file must match the requested dimensions
+    bool threw = false;
+    try { MappedMatrix<T> mapped( filename, m+1, n ); }
+    catch( std::exception& ) { threw = true; }
+    if( !threw )
+        LogicError("Mapping a file of the wrong size succeeded");
+    std::remove( filename.c_str() );
+
+    // A writable mapping creates a missing file
+    {
+        MappedMatrix<T> mapped( filename, m, n, true );
+        Matrix<T> Z;
+        Zeros( Z, m, n );
+        CheckEqual( mapped.Matrix(), Z, "New mapping" );
+        mapped.Matrix() = A;
+    }
+    CheckEqual( ReadFlat<T>( filename, m, n ), A, "Created file" );
+    std::remove( filename.c_str() );
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",17);
+        const Int n = Input("--n","width of matrix",9);
+        const string basename =
+          Input("--basename","basename of the scratch file",
+                string("MappedMatrixTest"));
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank() == 0 )
+        {
+            TestRoundTrip<float>( m, n, basename );
+            TestRoundTrip<double>( m, n, basename );
+            TestRoundTrip<Complex<double>>( m, n, basename );
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
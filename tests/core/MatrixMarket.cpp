@@ -0,0 +1,178 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The test build points this at the data directory of the source tree
+#ifndef EL_TEST_DATA_DIR
+# define EL_TEST_DATA_DIR "../data"
+#endif
+
+// The contents of the fixtures in data/io
+Matrix<double> GeneralFixture()
+{
+    Matrix<double> A;
+    Zeros( A, 6, 5 );
+    A(0,0) = 1.25;
+    A(1,0) = -3.75;
+    A(5,0) = 2.;
+    A(2,1) = 4.5;
+    A(0,2) = -0.625;
+    A(3,2) = 7.;
+    A(4,3) = -8.125;
+    A(1,4) = 9.;
+    A(5,4) = -10.5;
+    A(2,3) = 11.;
+    return A;
+}
+
+Matrix<double> SymmetricFixture()
+{
+    Matrix<double> A;
+    Zeros( A, 5, 5 );
+    A(0,0) = 4.;
+    A(1,0) = A(0,1) = -1.5;
+    A(1,1) = 5.;
+    A(3,1) = A(1,3) = 2.25;
+    A(2,2) = 6.;
+    A(4,2) = A(2,4) = -0.75;
+    A(3,3) = 7.;
+    A(4,4) = 8.;
+    return A;
+}
+
+Matrix<double> ArrayFixture()
+{
+    Matrix<double> A;
+    Zeros( A, 4, 3 );
+    for( Int j=0; j<3; ++j )
+        for( Int i=0; i<4; ++i )
+        {
+            const Int k = i + j*4 + 1;
+            A(i,j) = ( k % 2 == 1 ? k : -k );
+        }
+    return A;
+}
+
+void CheckEqual
+( const Matrix<double>& A, const Matrix<double>& AExpected,
+  const string& label )
+{
+    if( A.Height() != AExpected.Height() || A.Width() != AExpected.Width() )
+        LogicError
+        (label," was ",A.Height()," x ",A.Width()," rather than ",
+         AExpected.Height()," x ",AExpected.Width());
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( A(i,j) != AExpected(i,j) )
+                LogicError
+                (label," had ",A(i,j)," rather than ",AExpected(i,j),
+                 " in entry (",i,",",j,")");
+}
+
+void CheckEqual
+( const AbstractDistMatrix<double>& A, const Matrix<double>& AExpected,
+  const string& label )
+{
+    DistMatrix<double,STAR,STAR> AFull( A );
+    CheckEqual( AFull.Matrix(), AExpected, label );
+}
+
+void CheckEqual
+( const DistSparseMatrix<double>& A, const Matrix<double>& AExpected,
+  const string& label )
+{
+    DistMatrix<double> ADense( A.Grid() );
+    Copy( A, ADense );
+    CheckEqual( ADense, AExpected, label );
+}
+
+// Read each fixture with a team of 'teamSize' processes, so that the data
+// sections are split into that many byte ranges. For teams of two to eight
+// processes, each range of general.mtx begins in the middle of a line, so
+// that the entries which straddle the boundaries are exercised.
+void TestTeam( int teamSize, const string& dataDir )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    OutputFromRoot(comm,"Testing teams of ",teamSize," processes");
+    const string general = dataDir + "/general.mtx";
+    const string symmetric = dataDir + "/symmetric.mtx";
+    const string array = dataDir + "/array.mtx";
+    const auto AGeneral = GeneralFixture();
+    const auto ASymmetric = SymmetricFixture();
+    const auto AArray = ArrayFixture();
+
+    const bool inTeam = ( commRank < teamSize );
+    mpi::Comm teamComm;
+    mpi::Split( comm, inTeam ? 0 : 1, commRank, teamComm );
+    if( inTeam )
+    {
+        const Grid grid( teamComm );
+
+        DistMatrix<double> A(grid);
+        Read( A, general );
+        CheckEqual( A, AGeneral, "General [MC,MR] read" );
+        Read( A, symmetric );
+        CheckEqual( A, ASymmetric, "Symmetric [MC,MR] read" );
+        Read( A, array );
+        CheckEqual( A, AArray, "Array [MC,MR] read" );
+
+        DistMatrix<double,VC,STAR> B(grid);
+        Read( B, general );
+        CheckEqual( B, AGeneral, "General [VC,STAR] read" );
+        Read( B, symmetric );
+        CheckEqual( B, ASymmetric, "Symmetric [VC,STAR] read" );
+        Read( B, array );
+        CheckEqual( B, AArray, "Array [VC,STAR] read" );
+
+        DistSparseMatrix<double> C(grid);
+        Read( C, general );
+        CheckEqual( C, AGeneral, "General sparse read" );
+        Read( C, symmetric );
+        CheckEqual( C, ASymmetric, "Symmetric sparse read" );
+    }
+    mpi::Free( teamComm );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const string dataDir =
+          Input
+          ("--dataDir","directory of the fixtures",
+           string(EL_TEST_DATA_DIR)+"/io");
+        ProcessInput();
+        PrintInputReport();
+
+        // The sequential readers provide a reference for the fixtures
+        Matrix<double> A;
+        Read( A, dataDir+"/general.mtx" );
+        CheckEqual( A, GeneralFixture(), "General sequential read" );
+        Read( A, dataDir+"/symmetric.mtx" );
+        CheckEqual( A, SymmetricFixture(), "Symmetric sequential read" );
+        Read( A, dataDir+"/array.mtx" );
+        CheckEqual( A, ArrayFixture(), "Array sequential read" );
+
+        for( int teamSize=1; teamSize<=mpi::Size(comm); ++teamSize )
+            TestTeam( teamSize, dataDir );
+    }
+    catch( std::exception& e )
+    {
+        // A missing or misread fixture must fail the test
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
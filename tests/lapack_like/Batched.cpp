@@ -0,0 +1,465 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Each batch is stored as a single column-major matrix whose k'th block of
+// 'width' columns is the k'th member
+template<typename Field>
+batched::BatchView<Field> BatchOf( Matrix<Field>& A, Int width )
+{ return batched::BatchView<Field>( A.Buffer(), A.LDim(), width*A.LDim() ); }
+
+template<typename Field>
+Matrix<Field> Member( const Matrix<Field>& A, Int k, Int width )
+{
+    Matrix<Field> Ak;
+    Ak = A( ALL, IR(k*width,(k+1)*width) );
+    return Ak;
+}
+
+// Overwrite the triangle opposite to 'uplo' of each square member with NaN so
+// that any access to it would be detected
+template<typename Field>
+void PoisonOppositeTriangle( UpperOrLower uplo, Matrix<Field>& A, Int n )
+{
+    const Field nan( std::numeric_limits<Base<Field>>::quiet_NaN() );
+    const Int batchSize = A.Width() / n;
+    for( Int k=0; k<batchSize; ++k )
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<n; ++i )
+                if( (uplo == LOWER && i < j) || (uplo == UPPER && i > j) )
+                    A(i,k*n+j) = nan;
+}
+
+template<typename Field>
+void CheckOppositeTriangle
+( UpperOrLower uplo, const Matrix<Field>& A, Int n, const string& label )
+{
+    const Int batchSize = A.Width() / n;
+    for( Int k=0; k<batchSize; ++k )
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<n; ++i )
+                if( ((uplo == LOWER && i < j) || (uplo == UPPER && i > j)) &&
+                    A(i,k*n+j) == A(i,k*n+j) )
+                    LogicError
+                    (label," overwrote entry (",i,",",j,") of member ",k,
+                     ", which should not have been accessed");
+}
+
+template<typename Real>
+void CheckTolerance( Real value, Real tol, const string& label )
+{
+    Output(label,": ",value);
+    // Also catch NaNs
+    if( !(value <= tol) )
+        LogicError(label," was unacceptably large");
+}
+
+template<typename Field>
+Base<Field> MaxResidual
+( Orientation orientation,
+  const Matrix<Field>& AOrig,
+  const Matrix<Field>& X,
+  const Matrix<Field>& BOrig,
+  Int n,
+  Int numRHS,
+  Int batchSize )
+{
+    typedef Base<Field> Real;
+    const Int m = AOrig.Height();
+    Real maxResid = 0;
+    for( Int k=0; k<batchSize; ++k )
+    {
+        const Int BHeight = ( orientation == NORMAL ? m : n );
+        const Int XHeight = ( orientation == NORMAL ? n : m );
+        auto A = AOrig( ALL, IR(k*n,(k+1)*n) );
+        auto B = BOrig( IR(0,BHeight), IR(k*numRHS,(k+1)*numRHS) );
+        auto Xk = X( IR(0,XHeight), IR(k*numRHS,(k+1)*numRHS) );
+        Matrix<Field> R( B );
+        Gemm( orientation, NORMAL, Field(1), A, Xk, Field(-1), R );
+        Real scale = OneNorm(A)*OneNorm(Xk) + OneNorm(B);
+        if( orientation == NORMAL && m > n )
+        {
+            // Least-squares solutions satisfy A^H (A X - B) = 0
+            Matrix<Field> S;
+            Zeros( S, n, numRHS );
+            Gemm( ADJOINT, NORMAL, Field(1), A, R, Field(0), S );
+            R = S;
+            scale *= OneNorm(A);
+        }
+        const Real relResid = InfinityNorm(R) / scale;
+        maxResid = Max( maxResid, relResid );
+    }
+    return maxResid;
+}
+
+// The maximum over the members of || X[k] - XRef[k] ||_F / || XRef[k] ||_F
+template<typename Field>
+Base<Field> MaxRelativeDifference
+( const Matrix<Field>& X, const Matrix<Field>& XRef, Int width )
+{
+    typedef Base<Field> Real;
+    const Int batchSize = X.Width() / width;
+    Real maxDiff = 0;
+    for( Int k=0; k<batchSize; ++k )
+    {
+        auto XRefk = Member( XRef, k, width );
+        auto E = Member( X, k, width );
+        E -= XRefk;
+        maxDiff =
+          Max( maxDiff, FrobeniusNorm(E)/Max(FrobeniusNorm(XRefk),Real(1)) );
+    }
+    return maxDiff;
+}
+
+template<typename Field>
+void TestGemm( Int m, Int n, Int numSum, Int batchSize )
+{
+    typedef Base<Field> Real;
+    const Real tol = 10*numSum*limits::Epsilon<Real>();
+    const Field alpha( 2 ), beta( -1 );
+    for( const Orientation orientA : {NORMAL,TRANSPOSE,ADJOINT} )
+    {
+        for( const Orientation orientB : {NORMAL,ADJOINT} )
+        {
+            const Int AHeight = ( orientA == NORMAL ? m : numSum );
+            const Int AWidth = ( orientA == NORMAL ? numSum : m );
+            const Int BHeight = ( orientB == NORMAL ? numSum : n );
+            const Int BWidth = ( orientB == NORMAL ? n : numSum );
+            Matrix<Field> A, B, C, CRef;
+            Uniform( A, AHeight, AWidth*batchSize );
+            Uniform( B, BHeight, BWidth*batchSize );
+            Uniform( C, m, n*batchSize );
+            CRef = C;
+            batched::Gemm
+            ( orientA, orientB, m, n, numSum,
+              alpha, BatchOf(A,AWidth), BatchOf(B,BWidth),
+              beta, BatchOf(C,n), batchSize );
+            for( Int k=0; k<batchSize; ++k )
+            {
+                auto Ak = A( ALL, IR(k*AWidth,(k+1)*AWidth) );
+                auto Bk = B( ALL, IR(k*BWidth,(k+1)*BWidth) );
+                auto CRefk = CRef( ALL, IR(k*n,(k+1)*n) );
+                Gemm( orientA, orientB, alpha, Ak, Bk, beta, CRefk );
+            }
+            CheckTolerance
+            ( MaxRelativeDifference( C, CRef, n ), tol,
+              BuildString
+              ("Gemm",OrientationToChar(orientA),OrientationToChar(orientB),
+               " difference") );
+        }
+    }
+}
+
+template<typename Field>
+void TestTrsm( Int m, Int n, Int batchSize )
+{
+    typedef Base<Field> Real;
+    const Real tol = 100*Max(m,n)*limits::Epsilon<Real>();
+    const Field alpha( 3 );
+    for( const LeftOrRight side : {LEFT,RIGHT} )
+    {
+        for( const UpperOrLower uplo : {LOWER,UPPER} )
+        {
+            for( const Orientation orientation : {NORMAL,TRANSPOSE,ADJOINT} )
+            {
+                const Int order = ( side == LEFT ? m : n );
+                // Keep the triangles well-conditioned
+                Matrix<Field> A, B, BRef;
+                Uniform( A, order, order*batchSize );
+                for( Int k=0; k<batchSize; ++k )
+                    for( Int j=0; j<order; ++j )
+                        A(j,k*order+j) += Field(order);
+                Uniform( B, m, n*batchSize );
+                BRef = B;
+                for( Int k=0; k<batchSize; ++k )
+                {
+                    auto Ak = Member( A, k, order );
+                    auto BRefk = BRef( ALL, IR(k*n,(k+1)*n) );
+                    Trsm( side, uplo, orientation, NON_UNIT, alpha, Ak, BRefk );
+                }
+
+                PoisonOppositeTriangle( uplo, A, order );
+                batched::Trsm
+                ( side, uplo, orientation, NON_UNIT, m, n,
+                  alpha, BatchOf(A,order), BatchOf(B,n), batchSize );
+                CheckTolerance
+                ( MaxRelativeDifference( B, BRef, n ), tol,
+                  BuildString
+                  ("Trsm",LeftOrRightToChar(side),UpperOrLowerToChar(uplo),
+                   OrientationToChar(orientation)," difference") );
+            }
+        }
+    }
+}
+
+template<typename Field>
+void TestLU( Int n, Int numRHS, Int batchSize, bool compare )
+{
+    typedef Base<Field> Real;
+    const Real tol = 100*n*limits::Epsilon<Real>();
+    Timer timer;
+
+    Matrix<Field> AOrig, A, BOrig, B;
+    Uniform( AOrig, n, n*batchSize );
+    Uniform( BOrig, n, numRHS*batchSize );
+    A = AOrig;
+    Matrix<Int> p;
+    Zeros( p, n, batchSize );
+    timer.Start();
+    batched::LU( n, n, BatchOf(A,n), BatchOf(p,1), batchSize );
+    Output("Batched LU: ",timer.Stop()," secs");
+    for( const Orientation orientation : {NORMAL,TRANSPOSE,ADJOINT} )
+    {
+        B = BOrig;
+        batched::lu::SolveAfter
+        ( orientation, n, numRHS, BatchOf(A,n), BatchOf(p,1),
+          BatchOf(B,numRHS), batchSize );
+        CheckTolerance
+        ( MaxResidual( orientation, AOrig, B, BOrig, n, numRHS, batchSize ),
+          tol,
+          BuildString
+          ("LU ",OrientationToChar(orientation),
+           " solve max relative residual") );
+    }
+    if( compare )
+    {
+        A = AOrig;
+        B = BOrig;
+        Permutation P;
+        timer.Start();
+        for( Int k=0; k<batchSize; ++k )
+        {
+            auto Ak = A( ALL, IR(k*n,(k+1)*n) );
+            auto Bk = B( IR(0,n), IR(k*numRHS,(k+1)*numRHS) );
+            LU( Ak, P );
+            lu::SolveAfter( NORMAL, Ak, P, Bk );
+        }
+        Output("Looped LU and solve: ",timer.Stop()," secs");
+    }
+}
+
+// The upper-triangular factorizations are computed on members which are
+// individually allocated and addressed through an array of pointers
+template<typename Field>
+void TestCholesky( Int n, Int numRHS, Int batchSize, bool compare )
+{
+    typedef Base<Field> Real;
+    const Real tol = 100*n*limits::Epsilon<Real>();
+    Timer timer;
+
+    Matrix<Field> AOrig, A, BOrig, B;
+    Uniform( BOrig, n, numRHS*batchSize );
+    Zeros( AOrig, n, n*batchSize );
+    for( Int k=0; k<batchSize; ++k )
+    {
+        Matrix<Field> AHPD;
+        HermitianUniformSpectrum( AHPD, n, Real(1), Real(10) );
+        auto Ak = AOrig( ALL, IR(k*n,(k+1)*n) );
+        Ak = AHPD;
+    }
+
+    for( const UpperOrLower uplo : {LOWER,UPPER} )
+    {
+        A = AOrig;
+        PoisonOppositeTriangle( uplo, A, n );
+        vector<Matrix<Field>> members( batchSize );
+        vector<Field*> pointers( batchSize );
+        for( Int k=0; k<batchSize; ++k )
+        {
+            members[k] = Member( A, k, n );
+            pointers[k] = members[k].Buffer();
+        }
+        const batched::BatchView<Field> AView( pointers.data(), n );
+
+        timer.Start();
+        batched::Cholesky( uplo, n, AView, batchSize );
+        Output
+        ("Batched Cholesky(",UpperOrLowerToChar(uplo),"): ",timer.Stop(),
+         " secs");
+        for( Int k=0; k<batchSize; ++k )
+        {
+            auto Ak = A( ALL, IR(k*n,(k+1)*n) );
+            Ak = members[k];
+        }
+        CheckOppositeTriangle( uplo, A, n, "Batched Cholesky" );
+
+        for( const Orientation orientation : {NORMAL,TRANSPOSE} )
+        {
+            B = BOrig;
+            batched::cholesky::SolveAfter
+            ( uplo, orientation, n, numRHS, AView, BatchOf(B,numRHS),
+              batchSize );
+            CheckTolerance
+            ( MaxResidual
+              ( orientation, AOrig, B, BOrig, n, numRHS, batchSize ), tol,
+              BuildString
+              ("Cholesky(",UpperOrLowerToChar(uplo),") ",
+               OrientationToChar(orientation),
+               " solve max relative residual") );
+        }
+    }
+    if( compare )
+    {
+        A = AOrig;
+        B = BOrig;
+        timer.Start();
+        for( Int k=0; k<batchSize; ++k )
+        {
+            auto Ak = A( ALL, IR(k*n,(k+1)*n) );
+            auto Bk = B( IR(0,n), IR(k*numRHS,(k+1)*numRHS) );
+            Cholesky( LOWER, Ak );
+            cholesky::SolveAfter( LOWER, NORMAL, Ak, Bk );
+        }
+        Output("Looped Cholesky and solve: ",timer.Stop()," secs");
+    }
+}
+
+template<typename Field>
+void TestQR( Int m, Int n, Int numRHS, Int batchSize )
+{
+    typedef Base<Field> Real;
+    const Real tol = 100*Max(m,n)*limits::Epsilon<Real>();
+    Timer timer;
+
+    Matrix<Field> AOrig, A, BOrig, B;
+    Uniform( AOrig, m, n*batchSize );
+    Uniform( BOrig, m, numRHS*batchSize );
+    Matrix<Field> householderScalars;
+    Zeros( householderScalars, n, batchSize );
+    for( const Orientation orientation : {NORMAL,ADJOINT} )
+    {
+        A = AOrig;
+        B = BOrig;
+        timer.Start();
+        batched::QR
+        ( m, n, BatchOf(A,n), BatchOf(householderScalars,1), batchSize );
+        batched::qr::SolveAfter
+        ( orientation, m, n, numRHS, BatchOf(A,n),
+          BatchOf(householderScalars,1), BatchOf(B,numRHS), batchSize );
+        Output
+        ("Batched QR and ",orientation==NORMAL?"least-squares":"min-norm",
+         " solve: ",timer.Stop()," secs");
+        CheckTolerance
+        ( MaxResidual( orientation, AOrig, B, BOrig, n, numRHS, batchSize ),
+          tol, "QR max relative residual" );
+    }
+}
+
+// A member which cannot be factored should be reported through the usual
+// exception, but only after the remaining members were factored
+template<typename Field>
+void TestFailures( Int n, Int batchSize )
+{
+    typedef Base<Field> Real;
+    const Real tol = 100*n*limits::Epsilon<Real>();
+    const Int badMember = batchSize / 2;
+
+    Matrix<Field> AOrig, A;
+    Zeros( AOrig, n, n*batchSize );
+    for( Int k=0; k<batchSize; ++k )
+    {
+        auto Ak = AOrig( ALL, IR(k*n,(k+1)*n) );
+        if( k == badMember )
+            Identity( Ak, n, n );
+        else
+            HermitianUniformSpectrum( Ak, n, Real(1), Real(10) );
+    }
+    AOrig(n-1,badMember*n+n-1) = Field(-1);
+
+    A = AOrig;
+    bool threw = false;
+    try { batched::Cholesky( LOWER, n, BatchOf(A,n), batchSize ); }
+    catch( NonHPDMatrixException& e )
+    {
+        Output("Caught expected exception: ",e.what());
+        threw = true;
+    }
+    if( !threw )
+        LogicError("Batched Cholesky did not report the non-HPD member");
+    const Int lastMember = batchSize-1;
+    if( lastMember != badMember )
+    {
+        auto ALast = Member( A, lastMember, n );
+        auto ARef = Member( AOrig, lastMember, n );
+        Cholesky( LOWER, ARef );
+        MakeTrapezoidal( LOWER, ALast );
+        MakeTrapezoidal( LOWER, ARef );
+        ALast -= ARef;
+        CheckTolerance
+        ( FrobeniusNorm(ALast)/FrobeniusNorm(ARef), tol,
+          "Cholesky difference after the non-HPD member" );
+    }
+
+    // Zero a column of the bad member so that it is exactly singular
+    A = AOrig;
+    for( Int i=0; i<n; ++i )
+        A(i,badMember*n) = Field(0);
+    Matrix<Int> p;
+    Zeros( p, n, batchSize );
+    threw = false;
+    try { batched::LU( n, n, BatchOf(A,n), BatchOf(p,1), batchSize ); }
+    catch( SingularMatrixException& e )
+    {
+        Output("Caught expected exception: ",e.what());
+        threw = true;
+    }
+    if( !threw )
+        LogicError("Batched LU did not report the singular member");
+}
+
+template<typename Field>
+void TestBatched
+( Int m,
+  Int n,
+  Int numRHS,
+  Int batchSize,
+  bool compare )
+{
+    Output("Testing with ",TypeName<Field>());
+    PushIndent();
+    TestGemm<Field>( m, n, numRHS+1, batchSize );
+    TestTrsm<Field>( n, numRHS, batchSize );
+    TestLU<Field>( n, numRHS, batchSize, compare );
+    TestCholesky<Field>( n, numRHS, batchSize, compare );
+    TestQR<Field>( m, n, numRHS, batchSize );
+    TestFailures<Field>( n, batchSize );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of least-squares matrices",24);
+        const Int n = Input("--n","order of square matrices",16);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",2);
+        const Int batchSize = Input("--batchSize","number of matrices",1000);
+        const bool compare =
+          Input("--compare","time a loop over the Matrix routines?",true);
+        ProcessInput();
+        PrintInputReport();
+        if( m < n )
+            LogicError("Least-squares matrices must have m >= n");
+
+        if( mpi::Rank() == 0 )
+        {
+            TestBatched<float>( m, n, numRHS, batchSize, compare );
+            TestBatched<Complex<float>>( m, n, numRHS, batchSize, compare );
+            TestBatched<double>( m, n, numRHS, batchSize, compare );
+            TestBatched<Complex<double>>( m, n, numRHS, batchSize, compare );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
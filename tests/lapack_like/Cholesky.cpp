@@ -201,6 +201,7 @@ main( int argc, char* argv[] )
         const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
         const Int m = Input("--m","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int lookAhead = Input("--lookAhead","look-ahead depth",0);
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
         const bool pivot = Input("--pivot","use pivoting?",false);
         const bool correctness = Input
@@ -229,6 +230,7 @@ main( int argc, char* argv[] )
         const Grid g( comm, gridHeight, order );
         const UpperOrLower uplo = CharToUpperOrLower( uploChar );
         SetBlocksize( nb );
+        SetLookAheadDepth( lookAhead );
 
         ComplainIfDebug();
 
@@ -317,7 +319,11 @@ main( int argc, char* argv[] )
           print, printDiag, correctness, scalapack );
 #endif
     }
-    catch( exception& e ) { ReportException(e); }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
 
     return 0;
 }
@@ -224,6 +224,7 @@ void TestSuite
     ctrl.tridiagEigCtrl.alg = ctrlDbl.tridiagEigCtrl.alg;
     ctrl.tridiagEigCtrl.subset = subset;
     ctrl.tridiagEigCtrl.progress = ctrlDbl.tridiagEigCtrl.progress;
+    ctrl.tridiagEigCtrl.mrrrCtrl = ctrlDbl.tridiagEigCtrl.mrrrCtrl;
 
     if( sequential && g.Rank() == 0 )
     {
@@ -287,9 +288,19 @@ main( int argc, char* argv[] )
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
         const bool avoidTrmv =
           Input("--avoidTrmv","avoid Trmv based Symv",true);
+        const bool twoStage =
+          Input("--twoStage","two-stage tridiagonalization?",false);
+        const Int bandwidth =
+          Input("--bandwidth","two-stage bandwidth (0: blocksize)",0);
         const bool useScaLAPACK =
           Input("--useScaLAPACK","test ScaLAPACK?",false);
         const Int algInt = Input("--algInt","0: QR, 1: D&C, 2: MRRR",1);
+        const Int mrrrThreads =
+          Input("--mrrrThreads","MRRR threads per process (0: default)",0);
+        const bool balanceClusters =
+          Input("--balanceClusters","balance MRRR clusters?",false);
+        const bool testBalancedMRRR =
+          Input("--testBalancedMRRR","also test balanced MRRR?",true);
         const bool sequential =
           Input("--sequential","test sequential?",true);
         const bool distributed =
@@ -340,10 +351,14 @@ main( int argc, char* argv[] )
         ctrl.useScaLAPACK = useScaLAPACK;
         ctrl.tridiagCtrl.symvCtrl.bsize = nbLocal;
         ctrl.tridiagCtrl.symvCtrl.avoidTrmvBasedLocalSymv = avoidTrmv;
+        ctrl.tridiagCtrl.twoStage = twoStage;
+        ctrl.tridiagCtrl.bandwidth = bandwidth;
         ctrl.tridiagEigCtrl.sort = sort;
         ctrl.tridiagEigCtrl.alg = alg;
         ctrl.tridiagEigCtrl.subset = subset;
         ctrl.tridiagEigCtrl.progress = progress;
+        ctrl.tridiagEigCtrl.mrrrCtrl.numThreads = mrrrThreads;
+        ctrl.tridiagEigCtrl.mrrrCtrl.balanceClusters = balanceClusters;
 
         if( testReal )
         {
@@ -408,8 +423,29 @@ main( int argc, char* argv[] )
               sequential, distributed, correctness, print, g, ctrl );
 #endif
          }
+
+        // Balancing the clusters of MRRR across the processes only takes
+        // effect in the distributed eigensolver, and only when there are
+        // clusters, which Wilkinson matrices provide in abundance
+        if( testBalancedMRRR && distributed )
+        {
+            OutputFromRoot(g.Comm(),"MRRR with balanced clusters:");
+            auto mrrrCtrl = ctrl;
+            mrrrCtrl.tridiagEigCtrl.alg = HERM_TRIDIAG_EIG_MRRR;
+            mrrrCtrl.tridiagEigCtrl.mrrrCtrl.balanceClusters = true;
+            TestSuite<double>
+            ( m, uplo, onlyEigvals, true,
+              false, distributed, correctness, print, g, mrrrCtrl );
+            TestSuite<Complex<double>>
+            ( m, uplo, onlyEigvals, true,
+              false, distributed, correctness, print, g, mrrrCtrl );
+        }
+    }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
     }
-    catch( exception& e ) { ReportException(e); }
 
     return 0;
 }
@@ -14,6 +14,7 @@ void TestCorrectness
 ( UpperOrLower uplo,
   const Matrix<Field>& A,
   const Matrix<Field>& householderScalars,
+  const herm_tridiag::BulgeReflectors<Field>& bulgeReflectors,
         Matrix<Field>& AOrig,
   bool print,
   bool display )
@@ -43,8 +44,10 @@ void TestCorrectness
         Display( B, "Tridiagonal" );
 
     // Reverse the accumulated Householder transforms, ignoring symmetry
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, B );
-    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, householderScalars, B );
+    herm_tridiag::ApplyQ
+    ( LEFT, uplo, NORMAL, A, householderScalars, bulgeReflectors, B );
+    herm_tridiag::ApplyQ
+    ( RIGHT, uplo, ADJOINT, A, householderScalars, bulgeReflectors, B );
     if( print )
         Print( B, "Rotated tridiagonal" );
     if( display )
@@ -64,13 +67,16 @@ void TestCorrectness
 
     // Compute || I - Q Q^H ||
     MakeIdentity( B );
-    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, householderScalars, B );
+    herm_tridiag::ApplyQ
+    ( RIGHT, uplo, ADJOINT, A, householderScalars, bulgeReflectors, B );
     Matrix<Field> QHAdj;
     Adjoint( B, QHAdj );
     MakeIdentity( B );
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, B );
+    herm_tridiag::ApplyQ
+    ( LEFT, uplo, NORMAL, A, householderScalars, bulgeReflectors, B );
     QHAdj -= B;
-    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, householderScalars, B );
+    herm_tridiag::ApplyQ
+    ( RIGHT, uplo, ADJOINT, A, householderScalars, bulgeReflectors, B );
     ShiftDiagonal( B, Field(-1) );
     const Real infOrthogError = InfinityNorm( B );
     const Real relOrthogError = infOrthogError / (eps*m);
@@ -90,6 +96,7 @@ void TestCorrectness
 ( UpperOrLower uplo,
   const DistMatrix<Field>& A,
   const DistMatrix<Field,STAR,STAR>& householderScalars,
+  const herm_tridiag::BulgeReflectors<Field>& bulgeReflectors,
         DistMatrix<Field>& AOrig,
   bool print,
   bool display )
@@ -121,8 +128,10 @@ void TestCorrectness
         Display( B, "Tridiagonal" );
 
     // Reverse the accumulated Householder transforms, ignoring symmetry
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, B );
-    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, householderScalars, B );
+    herm_tridiag::ApplyQ
+    ( LEFT, uplo, NORMAL, A, householderScalars, bulgeReflectors, B );
+    herm_tridiag::ApplyQ
+    ( RIGHT, uplo, ADJOINT, A, householderScalars, bulgeReflectors, B );
     if( print )
         Print( B, "Rotated tridiagonal" );
     if( display )
@@ -143,13 +152,16 @@ void TestCorrectness
 
     // Compute || I - Q Q^H ||
     MakeIdentity( B );
-    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, householderScalars, B );
+    herm_tridiag::ApplyQ
+    ( RIGHT, uplo, ADJOINT, A, householderScalars, bulgeReflectors, B );
     DistMatrix<Field> QHAdj( grid );
     Adjoint( B, QHAdj );
     MakeIdentity( B );
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, B );
+    herm_tridiag::ApplyQ
+    ( LEFT, uplo, NORMAL, A, householderScalars, bulgeReflectors, B );
     QHAdj -= B;
-    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, householderScalars, B );
+    herm_tridiag::ApplyQ
+    ( RIGHT, uplo, ADJOINT, A, householderScalars, bulgeReflectors, B );
     ShiftDiagonal( B, Field(-1) );
     const Real infOrthogError = InfinityNorm( B );
     const Real relOrthogError = infOrthogError / (eps*m);
@@ -169,17 +181,19 @@ void InnerTestHermitianTridiag
 ( UpperOrLower uplo,
         Matrix<Field>& A,
         Matrix<Field>& householderScalars,
+  const HermitianTridiagCtrl<Field>& ctrl,
   bool correctness,
   bool print,
   bool display )
 {
     Matrix<Field> AOrig( A ), ACopy( A );
+    herm_tridiag::BulgeReflectors<Field> bulgeReflectors;
     const Int m = A.Height();
     Timer timer;
 
     Output("Starting tridiagonalization...");
     timer.Start();
-    HermitianTridiag( uplo, A, householderScalars );
+    HermitianTridiag( uplo, A, householderScalars, bulgeReflectors, ctrl );
     const double runTime = timer.Stop();
     const double realGFlops = 16./3.*Pow(double(m),3.)/(1.e9*runTime);
     const double gFlops = IsComplex<Field>::value ? 4*realGFlops : realGFlops;
@@ -197,7 +211,9 @@ void InnerTestHermitianTridiag
         ( householderScalars, "householderScalars after HermitianTridiag" );
     }
     if( correctness )
-        TestCorrectness( uplo, A, householderScalars, AOrig, print, display );
+        TestCorrectness
+        ( uplo, A, householderScalars, bulgeReflectors, AOrig,
+          print, display );
     A = ACopy;
 }
 
@@ -212,6 +228,7 @@ void InnerTestHermitianTridiag
   bool display )
 {
     DistMatrix<Field> AOrig( A ), ACopy( A );
+    herm_tridiag::BulgeReflectors<Field> bulgeReflectors;
     const Int m = A.Height();
     const Grid& grid = A.Grid();
     Timer timer;
@@ -219,7 +236,7 @@ void InnerTestHermitianTridiag
     OutputFromRoot(grid.Comm(),"Starting tridiagonalization...");
     mpi::Barrier( grid.Comm() );
     timer.Start();
-    HermitianTridiag( uplo, A, householderScalars, ctrl );
+    HermitianTridiag( uplo, A, householderScalars, bulgeReflectors, ctrl );
     mpi::Barrier( grid.Comm() );
     const double runTime = timer.Stop();
     const double realGFlops = 16./3.*Pow(double(m),3.)/(1.e9*runTime);
@@ -238,7 +255,9 @@ void InnerTestHermitianTridiag
         ( householderScalars, "householderScalars after HermitianTridiag" );
     }
     if( correctness )
-        TestCorrectness( uplo, A, householderScalars, AOrig, print, display );
+        TestCorrectness
+        ( uplo, A, householderScalars, bulgeReflectors, AOrig,
+          print, display );
     A = ACopy;
 }
 
@@ -246,6 +265,7 @@ template<typename Field>
 void TestHermitianTridiag
 ( UpperOrLower uplo,
   Int m,
+  Int bandwidth,
   bool correctness,
   bool print,
   bool display )
@@ -263,9 +283,16 @@ void TestHermitianTridiag
     if( display )
         Display( A, "A" );
 
+    HermitianTridiagCtrl<Field> ctrl;
     Output("Sequential algorithm:");
     InnerTestHermitianTridiag
-    ( uplo, A, householderScalars, correctness, print, display );
+    ( uplo, A, householderScalars, ctrl, correctness, print, display );
+
+    Output("Sequential two-stage algorithm:");
+    ctrl.twoStage = true;
+    ctrl.bandwidth = bandwidth;
+    InnerTestHermitianTridiag
+    ( uplo, A, householderScalars, ctrl, correctness, print, display );
 
     PopIndent();
 }
@@ -277,6 +304,7 @@ void TestHermitianTridiag
   Int m,
   Int nbLocal,
   bool avoidTrmv,
+  Int bandwidth,
   bool correctness,
   bool print,
   bool display )
@@ -314,6 +342,12 @@ void TestHermitianTridiag
     ctrl.order = COLUMN_MAJOR;
     InnerTestHermitianTridiag
     ( uplo, A, householderScalars, ctrl, correctness, print, display );
+
+    OutputFromRoot(grid.Comm(),"Two-stage algorithm:");
+    ctrl.twoStage = true;
+    ctrl.bandwidth = bandwidth;
+    InnerTestHermitianTridiag
+    ( uplo, A, householderScalars, ctrl, correctness, print, display );
     PopIndent();
 }
 
@@ -333,6 +367,8 @@ main( int argc, char* argv[] )
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
         const bool avoidTrmv =
           Input("--avoidTrmv","avoid Trmv local Symv",true);
+        const Int bandwidth =
+          Input("--bandwidth","bandwidth for two-stage reduction",0);
         const bool sequential = Input("--sequential","test sequential?",true);
         const bool correctness =
           Input("--correctness","test correctness?",true);
@@ -364,95 +400,106 @@ main( int argc, char* argv[] )
         {
             if( testReal )
                 TestHermitianTridiag<float>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             if( testCpx )
                 TestHermitianTridiag<Complex<float>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
 
             if( testReal )
                 TestHermitianTridiag<double>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             if( testCpx )
                 TestHermitianTridiag<Complex<double>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
 
 #ifdef EL_HAVE_QD
             if( testReal )
             {
                 TestHermitianTridiag<DoubleDouble>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
                 TestHermitianTridiag<QuadDouble>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             }
             if( testCpx )
             {
                 TestHermitianTridiag<Complex<DoubleDouble>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
                 TestHermitianTridiag<Complex<QuadDouble>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             }
 #endif
 
 #ifdef EL_HAVE_QUAD
             if( testReal )
                 TestHermitianTridiag<Quad>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             if( testCpx )
                 TestHermitianTridiag<Complex<Quad>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
 #endif
 
 #ifdef EL_HAVE_MPC
             if( testReal )
                 TestHermitianTridiag<BigFloat>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
 #endif
         }
 
         if( testReal )
             TestHermitianTridiag<float>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth, correctness, print,
+              display );
         if( testCpx )
             TestHermitianTridiag<Complex<float>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth, correctness, print,
+              display );
 
         if( testReal )
             TestHermitianTridiag<double>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth, correctness, print,
+              display );
         if( testCpx )
             TestHermitianTridiag<Complex<double>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth, correctness, print,
+              display );
 
 #ifdef EL_HAVE_QD
         if( testReal )
         {
             TestHermitianTridiag<DoubleDouble>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth, correctness, print,
+              display );
             TestHermitianTridiag<QuadDouble>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth, correctness, print,
+              display );
         }
         if( testCpx )
         {
             TestHermitianTridiag<Complex<DoubleDouble>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth, correctness, print,
+              display );
             TestHermitianTridiag<Complex<QuadDouble>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth, correctness, print,
+              display );
         }
 #endif
 
 #ifdef EL_HAVE_QUAD
         if( testReal )
             TestHermitianTridiag<Quad>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth, correctness, print,
+              display );
         if( testCpx )
             TestHermitianTridiag<Complex<Quad>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth, correctness, print,
+              display );
 #endif
 
 #ifdef EL_HAVE_MPC
         if( testReal )
             TestHermitianTridiag<BigFloat>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth, correctness, print,
+              display );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
@@ -135,6 +135,12 @@ void TestLU
         LU( A, P );
     else if( pivoting == 2 )
         LU( A, P, Q );
+    else if( pivoting == 3 )
+    {
+        LUCtrl ctrl;
+        ctrl.pivotType = LU_TOURNAMENT;
+        LU( A, P, ctrl );
+    }
     const double runTime = timer.Stop();
     const double realGFlops = 2./3.*Pow(double(m),3.)/(1.e9*runTime);
     const double gFlops = IsComplex<Field>::value ? 4*realGFlops : realGFlops;
@@ -170,7 +176,11 @@ void TestLU
         }
     }
     if( correctness )
-        TestCorrectness( AOrig, A, P, Q, pivoting, print );
+    {
+        // Tournament pivoting produces a partially-pivoted factorization
+        const Int correctnessPivoting = ( pivoting == 3 ? 1 : pivoting );
+        TestCorrectness( AOrig, A, P, Q, correctnessPivoting, print );
+    }
     PopIndent();
 }
 
@@ -208,6 +218,12 @@ void TestLU
         LU( A, P );
     else if( pivoting == 2 )
         LU( A, P, Q );
+    else if( pivoting == 3 )
+    {
+        LUCtrl ctrl;
+        ctrl.pivotType = LU_TOURNAMENT;
+        LU( A, P, ctrl );
+    }
     mpi::Barrier( grid.Comm() );
     const double runTime = timer.Stop();
     const double realGFlops = 2./3.*Pow(double(m),3.)/(1.e9*runTime);
@@ -244,7 +260,11 @@ void TestLU
         }
     }
     if( correctness )
-        TestCorrectness( AOrig, A, P, Q, pivoting, print );
+    {
+        // Tournament pivoting produces a partially-pivoted factorization
+        const Int correctnessPivoting = ( pivoting == 3 ? 1 : pivoting );
+        TestCorrectness( AOrig, A, P, Q, correctnessPivoting, print );
+    }
     PopIndent();
 }
 
@@ -260,7 +280,9 @@ main( int argc, char* argv[] )
         const bool colMajor = Input("--colMajor","column-major ordering?",true);
         const Int m = Input("--height","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
-        const Int pivot = Input("--pivot","0: none, 1: partial, 2: full",1);
+        const Int lookAhead = Input("--lookAhead","look-ahead depth",0);
+        const Int pivot =
+          Input("--pivot","0: none, 1: partial, 2: full, 3: tournament",1);
         const bool forceGrowth = Input
             ("--forceGrowth","force element growth?",false);
         const bool sequential = Input("--sequential","test sequential?",true);
@@ -272,7 +294,7 @@ main( int argc, char* argv[] )
 #endif
         ProcessInput();
         PrintInputReport();
-        if( pivot < 0 || pivot > 2 )
+        if( pivot < 0 || pivot > 3 )
             LogicError("Invalid pivot value");
 
 #ifdef EL_HAVE_MPC
@@ -284,6 +306,7 @@ main( int argc, char* argv[] )
         const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
         const Grid grid( comm, gridHeight, order );
         SetBlocksize( nb );
+        SetLookAheadDepth( lookAhead );
         ComplainIfDebug();
         if( pivot == 0 )
             OutputFromRoot(grid.Comm(),"Testing LU with no pivoting");
@@ -291,6 +314,8 @@ main( int argc, char* argv[] )
             OutputFromRoot(grid.Comm(),"Testing LU with partial pivoting");
         else if( pivot == 2 )
             OutputFromRoot(grid.Comm(),"Testing LU with full pivoting");
+        else if( pivot == 3 )
+            OutputFromRoot(grid.Comm(),"Testing LU with tournament pivoting");
 
         if( sequential && mpi::Rank() == 0 )
         {
@@ -367,7 +392,11 @@ main( int argc, char* argv[] )
         ( grid, m, pivot, correctness, forceGrowth, print );
 #endif
     }
-    catch( exception& e ) { ReportException(e); }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
 
     return 0;
 }
@@ -28,6 +28,12 @@ int main( int argc, char* argv[] )
             ("--numSeqSeps",
              "number of separators to try per sequential partition",1);
         const Int cutoff = Input("--cutoff","cutoff for nested dissection",128);
+        const bool relaxSupernodes =
+          Input("--relaxSupernodes","amalgamate small fronts?",false);
+        const Int relaxedSize =
+          Input("--relaxedSize","max size of unconditional merges",32);
+        const double fillTolerance =
+          Input("--fillTolerance","max fraction of explicit zeros",0.1);
         const bool print = Input("--print","print graph?",false);
         const bool display = Input("--display","display graph?",false);
         ProcessInput();
@@ -37,6 +43,10 @@ int main( int argc, char* argv[] )
         ctrl.numSeqSeps = numSeqSeps;
         ctrl.numDistSeps = numDistSeps;
         ctrl.cutoff = cutoff;
+        ctrl.relaxSupernodes = relaxSupernodes;
+        ctrl.relaxedSize = relaxedSize;
+        ctrl.fillTolerance = fillTolerance;
+        ctrl.progress = true;
 
         const Int numVertices = n*n*n;
         const Grid grid( comm );
@@ -0,0 +1,169 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+Int NumFronts( const ldl::NodeInfo& info )
+{
+    Int numFronts = 1;
+    for( const auto& child : info.children )
+        numFronts += NumFronts( *child );
+    return numFronts;
+}
+
+// The relaxed supernodes are only formed within the sequential subtree
+// beneath the bottom distributed node
+Int NumSequentialFronts( const ldl::DistNodeInfo& info )
+{
+    if( info.child.get() != nullptr )
+        return NumSequentialFronts( *info.child );
+    return NumFronts( *info.duplicate );
+}
+
+template<typename Field>
+void CheckResidual
+( Base<Field> residNorm, Base<Field> rhsNorm, mpi::Comm comm,
+  const string& label )
+{
+    typedef Base<Field> Real;
+    const Real relResid = residNorm / rhsNorm;
+    OutputFromRoot(comm,label,": || B - A X ||_F / || B ||_F = ",relResid);
+    if( relResid > Pow(limits::Epsilon<Real>(),Real(0.5)) )
+        LogicError(label," had a relative residual of ",relResid);
+}
+
+// Solve against a sequential sparse matrix with and without relaxed
+// supernodes, which must reduce the number of fronts without spoiling the
+// solution
+template<typename Field>
+void TestSequential
+( Int n1, Int n2, Int n3, Int numRHS, BisectCtrl ctrl, mpi::Comm comm )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot(comm,"Testing sequential solve with ",TypeName<Field>());
+    PushIndent();
+
+    SparseMatrix<Field> A;
+    Laplacian( A, n1, n2, n3 );
+    A *= -Field(1);
+    Matrix<Field> B;
+    Uniform( B, A.Height(), numRHS );
+    const Real BNorm = FrobeniusNorm( B );
+
+    const bool hermitian = true;
+    ctrl.relaxSupernodes = false;
+    SparseLDLFactorization<Field> strictFact;
+    strictFact.Initialize( A, hermitian, ctrl );
+    const Int numStrictFronts = NumFronts( strictFact.NodeInfo() );
+
+    ctrl.relaxSupernodes = true;
+    SparseLDLFactorization<Field> relaxedFact;
+    relaxedFact.Initialize( A, hermitian, ctrl );
+    const Int numRelaxedFronts = NumFronts( relaxedFact.NodeInfo() );
+    OutputFromRoot
+    (comm,"Relaxation reduced the fronts from ",numStrictFronts," to ",
+     numRelaxedFronts);
+    if( numRelaxedFronts >= numStrictFronts )
+        LogicError("Relaxed supernodes did not merge any fronts");
+
+    relaxedFact.Factor();
+    auto X( B );
+    relaxedFact.Solve( X );
+    Multiply( NORMAL, Field(-1), A, X, Field(1), B );
+    CheckResidual<Field>
+    ( FrobeniusNorm(B), BNorm, comm, "Relaxed sequential solve" );
+    PopIndent();
+}
+
+template<typename Field>
+void TestDistributed
+( Int n1, Int n2, Int n3, Int numRHS, BisectCtrl ctrl, const Grid& grid )
+{
+    typedef Base<Field> Real;
+    mpi::Comm comm = grid.Comm();
+    OutputFromRoot(comm,"Testing distributed solve with ",TypeName<Field>());
+    PushIndent();
+
+    DistSparseMatrix<Field> A(grid);
+    Laplacian( A, n1, n2, n3 );
+    A *= -Field(1);
+    DistMultiVec<Field> B(grid);
+    Uniform( B, A.Height(), numRHS );
+    const Real BNorm = FrobeniusNorm( B );
+
+    const bool hermitian = true;
+    ctrl.relaxSupernodes = false;
+    DistSparseLDLFactorization<Field> strictFact;
+    strictFact.Initialize( A, hermitian, ctrl );
+    const Int numStrictFronts =
+      mpi::AllReduce( NumSequentialFronts(strictFact.NodeInfo()), comm );
+
+    ctrl.relaxSupernodes = true;
+    DistSparseLDLFactorization<Field> relaxedFact;
+    relaxedFact.Initialize( A, hermitian, ctrl );
+    const Int numRelaxedFronts =
+      mpi::AllReduce( NumSequentialFronts(relaxedFact.NodeInfo()), comm );
+    OutputFromRoot
+    (comm,"Relaxation reduced the sequential fronts from ",numStrictFronts,
+     " to ",numRelaxedFronts);
+    if( numRelaxedFronts >= numStrictFronts )
+        LogicError("Relaxed supernodes did not merge any fronts");
+
+    relaxedFact.Factor( LDL_2D );
+    auto X( B );
+    relaxedFact.Solve( X );
+    Multiply( NORMAL, Field(-1), A, X, Field(1), B );
+    CheckResidual<Field>
+    ( FrobeniusNorm(B), BNorm, comm, "Relaxed distributed solve" );
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",12);
+        const Int n2 = Input("--n2","second grid dimension",10);
+        const Int n3 = Input("--n3","third grid dimension",8);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+        const Int cutoff = Input("--cutoff","cutoff for nested dissection",16);
+        const Int relaxedSize =
+          Input("--relaxedSize","max size of unconditional merges",32);
+        const double fillTolerance =
+          Input("--fillTolerance","max fraction of explicit zeros",0.1);
+        ProcessInput();
+        PrintInputReport();
+
+        // A small cutoff yields many small fronts for the relaxation to merge
+        BisectCtrl ctrl;
+        ctrl.cutoff = cutoff;
+        ctrl.relaxedSize = relaxedSize;
+        ctrl.fillTolerance = fillTolerance;
+        ctrl.progress = true;
+        const Grid grid( comm );
+
+        if( mpi::Rank(comm) == 0 )
+        {
+            TestSequential<float>( n1, n2, n3, numRHS, ctrl, mpi::COMM_SELF );
+            TestSequential<double>( n1, n2, n3, numRHS, ctrl, mpi::COMM_SELF );
+        }
+        TestDistributed<float>( n1, n2, n3, numRHS, ctrl, grid );
+        TestDistributed<double>( n1, n2, n3, numRHS, ctrl, grid );
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,121 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Factor A and solve against B with the given number of OpenMP threads
+template<typename Field>
+Matrix<Field> FactorAndSolve
+( const SparseMatrix<Field>& A,
+  const Matrix<Field>& B,
+  int numThreads,
+  const BisectCtrl& ctrl )
+{
+#ifdef EL_HYBRID
+    const int maxThreads = omp_get_max_threads();
+    omp_set_num_threads( numThreads );
+#endif
+    const int numBlasThreads = blas::GetNumThreads();
+
+    SparseLDLFactorization<Field> sparseLDLFact;
+    const bool hermitian = true;
+    sparseLDLFact.Initialize( A, hermitian, ctrl );
+    Timer timer;
+    timer.Start();
+    sparseLDLFact.Factor();
+    Output("Factorization with ",numThreads," threads: ",timer.Stop()," secs");
+    if( blas::GetNumThreads() != numBlasThreads )
+        LogicError
+        ("The factorization left ",blas::GetNumThreads(),
+         " BLAS threads rather than ",numBlasThreads);
+
+    Matrix<Field> X( B );
+    sparseLDLFact.Solve( X );
+#ifdef EL_HYBRID
+    omp_set_num_threads( maxThreads );
+#endif
+    return X;
+}
+
+template<typename Field>
+void TestThreaded
+( Int n1, Int n2, Int n3, Int numRHS, int numThreads, const BisectCtrl& ctrl )
+{
+    typedef Base<Field> Real;
+    Output("Testing with ",TypeName<Field>());
+    PushIndent();
+
+    SparseMatrix<Field> A;
+    Laplacian( A, n1, n2, n3 );
+    A *= -1;
+    const Int n = A.Height();
+    Matrix<Field> B;
+    Uniform( B, n, numRHS );
+
+    const Matrix<Field> XSeq = FactorAndSolve( A, B, 1, ctrl );
+    const Matrix<Field> X = FactorAndSolve( A, B, numThreads, ctrl );
+
+    const Real eps = limits::Epsilon<Real>();
+    const Real BFrob = FrobeniusNorm( B );
+    for( const Matrix<Field>* Y : {&XSeq,&X} )
+    {
+        Matrix<Field> R( B );
+        Multiply( NORMAL, Field(-1), A, *Y, Field(1), R );
+        const Real relResid = FrobeniusNorm( R ) / BFrob;
+        Output("|| B - A X ||_F / || B ||_F = ",relResid);
+        if( !(relResid <= Sqrt(eps)) )
+            LogicError("Relative residual was unacceptably large");
+    }
+
+    // The threaded factorization only reorders independent computations
+    Matrix<Field> E( X );
+    E -= XSeq;
+    const Real relDiff = FrobeniusNorm( E ) / FrobeniusNorm( XSeq );
+    Output("|| X - XSeq ||_F / || XSeq ||_F = ",relDiff);
+    if( !(relDiff <= Sqrt(eps)) )
+        LogicError("The threaded and sequential solutions differed");
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",20);
+        const Int n2 = Input("--n2","second grid dimension",20);
+        const Int n3 = Input("--n3","third grid dimension",20);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+#ifdef EL_HYBRID
+        const int defaultThreads = omp_get_max_threads();
+#else
+        const int defaultThreads = 1;
+#endif
+        const int numThreads =
+          Input("--numThreads","number of threads",defaultThreads);
+        const Int cutoff = Input("--cutoff","cutoff for nested dissection",64);
+        ProcessInput();
+        PrintInputReport();
+
+        BisectCtrl ctrl;
+        ctrl.cutoff = cutoff;
+
+        if( mpi::Rank() == 0 )
+        {
+            TestThreaded<float>( n1, n2, n3, numRHS, numThreads, ctrl );
+            TestThreaded<double>( n1, n2, n3, numRHS, numThreads, ctrl );
+            TestThreaded<Complex<double>>
+            ( n1, n2, n3, numRHS, numThreads, ctrl );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,190 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Sweep the algorithmic blocksizes of LU, Cholesky, and QR for each datatype,
+// for both sequential matrices and the given process grid, over a range of
+// problem sizes. The resulting tuning file can be loaded by setting the
+// environment variable EL_BLOCKSIZE_TUNING_FILE.
+
+// Sequential routines are keyed by a 0 x 0 grid, so that their entries are
+// not overwritten by those of distributed routines on a 1 x 1 grid
+template<typename Field>
+std::array<Int,3> TuneSequential
+( Int n, const vector<Int>& candidates, Int numReps )
+{
+    const string typeName = TypeName<Field>();
+    Matrix<Field> AOrig, A;
+    Matrix<Field> householderScalars;
+    Matrix<Base<Field>> signature;
+    Permutation P;
+
+    Uniform( AOrig, n, n );
+    const Int bsizeLU = TuneBlocksize
+    ( "LU", typeName, n, 0, 0, candidates,
+      [&]() { A = AOrig; LU( A, P ); }, mpi::COMM_SELF, numReps );
+    const Int bsizeQR = TuneBlocksize
+    ( "QR", typeName, n, 0, 0, candidates,
+      [&]() { A = AOrig; QR( A, householderScalars, signature ); },
+      mpi::COMM_SELF, numReps );
+
+    HermitianUniformSpectrum( AOrig, n, 1, 10 );
+    const Int bsizeChol = TuneBlocksize
+    ( "Cholesky", typeName, n, 0, 0, candidates,
+      [&]() { A = AOrig; Cholesky( LOWER, A ); }, mpi::COMM_SELF, numReps );
+
+    Output
+    (typeName," n=",n,": LU=",bsizeLU,", QR=",bsizeQR,
+     ", Cholesky=",bsizeChol);
+    return std::array<Int,3>{{bsizeLU,bsizeQR,bsizeChol}};
+}
+
+// Throw if the recorded sequential blocksizes differ from those returned
+// by the sequential sweep
+template<typename Field>
+void CheckSequential( Int n, const std::array<Int,3>& bsizes )
+{
+    const string typeName = TypeName<Field>();
+    const bool usedTuned = TunedBlocksizesEnabled();
+    EnableTunedBlocksizes();
+    const std::array<Int,3> recorded{{
+      Blocksize("LU",typeName,n),
+      Blocksize("QR",typeName,n),
+      Blocksize("Cholesky",typeName,n) }};
+    if( !usedTuned )
+        DisableTunedBlocksizes();
+    if( recorded != bsizes )
+        LogicError
+        ("The sequential blocksizes for ",typeName," n=",n," were "
+         "overwritten by the distributed tuning");
+}
+
+template<typename Field>
+void TuneDistributed
+( const Grid& grid, Int n, const vector<Int>& candidates, Int numReps )
+{
+    const string typeName = TypeName<Field>();
+    const Int gridHeight = grid.Height();
+    const Int gridWidth = grid.Width();
+    DistMatrix<Field> AOrig(grid), A(grid);
+    DistMatrix<Field,MD,STAR> householderScalars(grid);
+    DistMatrix<Base<Field>,MD,STAR> signature(grid);
+    DistPermutation P(grid);
+
+    Uniform( AOrig, n, n );
+    const Int bsizeLU = TuneBlocksize
+    ( "LU", typeName, n, gridHeight, gridWidth, candidates,
+      [&]() { A = AOrig; LU( A, P ); }, grid.Comm(), numReps );
+    const Int bsizeQR = TuneBlocksize
+    ( "QR", typeName, n, gridHeight, gridWidth, candidates,
+      [&]() { A = AOrig; QR( A, householderScalars, signature ); },
+      grid.Comm(), numReps );
+
+    HermitianUniformSpectrum( AOrig, n, 1, 10 );
+    const Int bsizeChol = TuneBlocksize
+    ( "Cholesky", typeName, n, gridHeight, gridWidth, candidates,
+      [&]() { A = AOrig; Cholesky( LOWER, A ); }, grid.Comm(), numReps );
+
+    OutputFromRoot
+    (grid.Comm(),typeName," n=",n," on a ",gridHeight," x ",gridWidth,
+     " grid: LU=",bsizeLU,", QR=",bsizeQR,", Cholesky=",bsizeChol);
+}
+
+template<typename Field>
+void Tune
+( const Grid& grid,
+  Int minSize,
+  Int maxSize,
+  const vector<Int>& candidates,
+  Int numReps,
+  bool sequential,
+  bool distributed )
+{
+    OutputFromRoot(grid.Comm(),"Tuning with ",TypeName<Field>());
+    PushIndent();
+    for( Int n=minSize; n<=maxSize; n*=2 )
+    {
+        std::array<Int,3> bsizes;
+        if( sequential && grid.Rank() == 0 )
+            bsizes = TuneSequential<Field>( n, candidates, numReps );
+        if( distributed )
+            TuneDistributed<Field>( grid, n, candidates, numReps );
+        if( sequential && grid.Rank() == 0 )
+            CheckSequential<Field>( n, bsizes );
+    }
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const Int minSize = Input("--minSize","smallest problem size",256);
+        const Int maxSize = Input("--maxSize","largest problem size",2048);
+        const Int minBlocksize = Input("--minNB","smallest blocksize",16);
+        const Int maxBlocksize = Input("--maxNB","largest blocksize",256);
+        const Int numReps = Input("--numReps","repetitions per blocksize",2);
+        const bool sequential = Input("--sequential","tune sequential?",true);
+        const bool distributed =
+          Input("--distributed","tune distributed?",true);
+        const string filename =
+          Input("--filename","tuning file",string("blocksizes.txt"));
+        ProcessInput();
+        PrintInputReport();
+
+        if( minSize < 1 || minBlocksize < 1 )
+            LogicError("Sizes must be positive");
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const Grid grid( comm, gridHeight );
+
+        // Sweep geometrically spaced blocksizes, as the timings are rather
+        // flat near the optimum
+        vector<Int> candidates;
+        for( Int nb=minBlocksize; nb<=maxBlocksize; nb*=2 )
+        {
+            candidates.push_back( nb );
+            if( 3*nb/2 <= maxBlocksize )
+                candidates.push_back( 3*nb/2 );
+        }
+
+        Tune<float>
+        ( grid, minSize, maxSize, candidates, numReps,
+          sequential, distributed );
+        Tune<Complex<float>>
+        ( grid, minSize, maxSize, candidates, numReps,
+          sequential, distributed );
+        Tune<double>
+        ( grid, minSize, maxSize, candidates, numReps,
+          sequential, distributed );
+        Tune<Complex<double>>
+        ( grid, minSize, maxSize, candidates, numReps,
+          sequential, distributed );
+
+        // Only the root process tuned the sequential routines
+        if( mpi::Rank(comm) == 0 )
+        {
+            SaveBlocksizeTuning( filename );
+            Output("Wrote ",filename);
+        }
+    }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
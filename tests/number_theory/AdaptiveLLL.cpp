@@ -0,0 +1,127 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Throw if the upper-triangular factor R of a basis is not (delta,eta)
+// LLL-reduced, up to the relative tolerance 'tol'
+template<typename Real>
+void CheckLLLReduced( const Matrix<Real>& R, Real delta, Real eta, Real tol )
+{
+    const Int n = Min(R.Height(),R.Width());
+    for( Int j=1; j<n; ++j )
+    {
+        for( Int i=0; i<j; ++i )
+            if( Abs(R(i,j)) > (eta+tol)*Abs(R(i,i)) )
+                LogicError
+                ("Column ",j," was not size reduced against column ",i);
+        const Real lhs = delta*R(j-1,j-1)*R(j-1,j-1);
+        const Real rhs = R(j-1,j)*R(j-1,j) + R(j,j)*R(j,j);
+        if( lhs > (1+tol)*rhs )
+            LogicError("The Lovasz condition failed for column ",j);
+    }
+}
+
+// Reduce an exact basis with the adaptive-precision LLL, check that the
+// certified R is LLL-reduced, and check that B = BOrig U holds exactly
+template<typename Z,typename Real>
+void ReduceAndCheck( const Matrix<Z>& BOrig, const LLLCtrl<Real>& ctrl )
+{
+    auto B( BOrig );
+    Matrix<Z> U;
+    Matrix<Real> R;
+    Timer timer;
+    timer.Start();
+    const auto info = AdaptiveLLL( B, U, R, ctrl );
+    Output
+    ("Adaptive LLL with ",TypeName<Z>()," basis and ",TypeName<Real>(),
+     " certification: ",timer.Stop()," seconds, ",info.numSwaps,
+     " swaps, root Hermite factor ",lll::RootHermiteFactor(R));
+
+    const Real tol = Sqrt(limits::Epsilon<Real>());
+    CheckLLLReduced( R, ctrl.delta, ctrl.eta, tol );
+
+    // The basis is only modified by integer column operations, so the
+    // transformation must be reproduced without any rounding
+    Matrix<Z> E( B );
+    Gemm( NORMAL, NORMAL, Z(-1), BOrig, U, Z(1), E );
+    for( Int j=0; j<E.Width(); ++j )
+        for( Int i=0; i<E.Height(); ++i )
+            if( E(i,j) != Z(0) )
+                LogicError("B - BOrig U was nonzero in entry (",i,",",j,")");
+}
+
+// Reduce a double-precision integer basis, whose entries are exact, and
+// certify the result in the precision 'Real'. When 'Real' has a longer
+// mantissa than double, the reduction itself is performed by cheaper
+// double-precision passes.
+template<typename Real>
+void TestDoubleBasis( Int n, double radius, bool progress, bool time )
+{
+    LLLCtrl<Real> ctrl;
+    ctrl.progress = progress;
+    ctrl.time = time;
+    Matrix<double> BOrig;
+    KnapsackTypeBasis( BOrig, n, radius );
+    ReduceAndCheck( BOrig, ctrl );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n = Input("--n","problem size",40);
+        const double radius = Input("--radius","double sampling radius",1.e6);
+#ifdef EL_HAVE_MPC
+        const Int radiusBits =
+          Input("--radiusBits","bits of the exact sampling radius",200);
+        const Int prec = Input("--prec","bits of the certifying BigFloat",512);
+#endif
+        const bool progress = Input("--progress","print progress?",false);
+        const bool time = Input("--time","time the passes?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        // Integers of magnitude at most 2^53 are exact in double precision
+        TestDoubleBasis<double>( n, radius, progress, time );
+#if defined(EL_HAVE_QD)
+        TestDoubleBasis<DoubleDouble>( n, radius, progress, time );
+        TestDoubleBasis<QuadDouble>( n, radius, progress, time );
+#elif defined(EL_HAVE_QUAD)
+        TestDoubleBasis<Quad>( n, radius, progress, time );
+#endif
+
+#ifdef EL_HAVE_MPC
+        // A BigInt basis whose entries are too large for any of the fixed
+        // precision passes to be attempted on the original basis, so that
+        // the first pass is performed in a reduced BigFloat precision
+        mpfr::SetPrecision( prec );
+        mpfr::SetMinIntBits( radiusBits+Int(64) );
+        BigInt bigRadius(1);
+        for( Int bit=0; bit<radiusBits; ++bit )
+            bigRadius *= 2;
+        Matrix<BigInt> BOrig;
+        KnapsackTypeBasis( BOrig, n, bigRadius );
+
+        LLLCtrl<BigFloat> ctrl;
+        ctrl.progress = progress;
+        ctrl.time = time;
+        ReduceAndCheck( BOrig, ctrl );
+#endif
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
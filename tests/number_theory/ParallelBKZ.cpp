@@ -0,0 +1,144 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Throw unless the upper-triangular factor R of a basis is BKZ-reduced with
+// the given blocksize. BKZ only inserts a vector into a block if it is
+// shorter than sqrt(delta) times the leading projected norm, so the leading
+// projected norm of each block may exceed the shortest vector of the
+// projected block by (at most) the factor 1/sqrt(delta).
+template<typename Real>
+void CheckBKZReduced
+( const Matrix<Real>& R, Int blocksize, Real delta, Real tol )
+{
+    const Int minDim = Min(R.Height(),R.Width());
+    Int rank = 0;
+    while( rank < minDim && Abs(R(rank,rank)) > Real(0) )
+        ++rank;
+
+    EnumCtrl<Real> enumCtrl;
+    enumCtrl.enumType = FULL_ENUM;
+    enumCtrl.disablePrecDrop = true;
+    for( Int j=0; j<rank-1; ++j )
+    {
+        // The projected block is spanned by the columns of its own
+        // upper-triangular factor
+        const Range<Int> ind( j, Min(j+blocksize,rank) );
+        auto RBlock = R( ind, ind );
+        Matrix<Real> v;
+        const Real shortest =
+          ShortestVectorEnumeration( RBlock, RBlock, v, enumCtrl );
+        if( Sqrt(delta)*Abs(R(j,j)) > (1+tol)*shortest )
+            LogicError
+            ("Block ",j," has leading projected norm ",Abs(R(j,j)),
+             " but contains a vector of norm ",shortest);
+    }
+}
+
+// Reduce a copy of BOrig, check that B = BOrig U holds exactly, and return
+// the root Hermite factor of the result
+template<typename Real>
+Real ReduceAndCheck
+( const Matrix<Real>& BOrig, const BKZCtrl<Real>& ctrl, bool checkBKZ,
+  const string& label )
+{
+    auto B( BOrig );
+    Matrix<Real> U, R;
+    Timer timer;
+    timer.Start();
+    const auto info = BKZ( B, U, R, ctrl );
+    const Real rootHermite = lll::RootHermiteFactor( R );
+    Output
+    (label,": ",timer.Stop()," seconds, ",info.numEnums," enumerations, ",
+     "root Hermite factor ",rootHermite);
+
+    // The basis is only modified by integer column operations on integers
+    // which are exactly representable, so the transformation must be
+    // reproduced without any rounding
+    Matrix<Real> E( B );
+    Gemm( NORMAL, NORMAL, Real(-1), BOrig, U, Real(1), E );
+    if( MaxNorm(E) != Real(0) )
+        LogicError(label," did not maintain B = BOrig U");
+
+    const Real tol = Sqrt(limits::Epsilon<Real>());
+    if( checkBKZ )
+        CheckBKZReduced( R, ctrl.blocksize, ctrl.lllCtrl.delta, tol );
+
+    if( ctrl.parallelTours )
+    {
+        const Int numTours = info.tourTimes.size();
+        if( numTours == 0 ||
+            Int(info.tourRootHermiteFactors.size()) != numTours )
+            LogicError
+            (label," recorded ",numTours," tour times and ",
+             info.tourRootHermiteFactors.size()," root Hermite factors");
+        if( Abs(info.tourRootHermiteFactors.back()-rootHermite) >
+            tol*rootHermite )
+            LogicError
+            (label," recorded a final root Hermite factor of ",
+             info.tourRootHermiteFactors.back()," rather than ",rootHermite);
+    }
+    return rootHermite;
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        typedef double Real;
+
+        const Int n = Input("--n","problem size",30);
+        const Real radius = Input("--radius","sampling radius",Real(1.e6));
+        const Int blocksize = Input("--blocksize","BKZ blocksize",10);
+        const Real maxRatio =
+          Input
+          ("--maxRatio","max ratio of parallel to sequential root Hermite",
+           Real(1.01));
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        Matrix<Real> BOrig;
+        KnapsackTypeBasis( BOrig, n, radius );
+
+        BKZCtrl<Real> ctrl;
+        ctrl.blocksize = blocksize;
+        ctrl.progress = progress;
+        ctrl.enumCtrl.enumType = FULL_ENUM;
+        const Real seqRootHermite =
+          ReduceAndCheck( BOrig, ctrl, true, "Sequential BKZ" );
+
+        // Shifting the blocks of successive tours by a single column means
+        // that a full cycle of unchanged tours enumerates a block starting at
+        // every column, so that the result is BKZ-reduced
+        ctrl.parallelTours = true;
+        ctrl.tourStagger = 1;
+        ReduceAndCheck( BOrig, ctrl, true, "Parallel BKZ with unit stagger" );
+
+        // The default stagger only revisits every other half-block, but the
+        // quality should remain comparable to that of the sequential tours
+        ctrl.tourStagger = 0;
+        const Real parRootHermite =
+          ReduceAndCheck( BOrig, ctrl, false, "Parallel BKZ" );
+        if( parRootHermite > maxRatio*seqRootHermite )
+            LogicError
+            ("Parallel BKZ had a root Hermite factor of ",parRootHermite,
+             ", while sequential BKZ had ",seqRootHermite);
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
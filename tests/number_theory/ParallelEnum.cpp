@@ -0,0 +1,149 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Check that 'v' agrees over the processes of 'comm' and that B v has norm
+// 'norm' (to within 'tol')
+template<typename Real>
+void CheckVector
+( const Matrix<Real>& B, const Matrix<Real>& v, Real norm, Real tol,
+  mpi::Comm comm, const string& label )
+{
+    Matrix<Real> vRoot( v );
+    Broadcast( vRoot, comm, 0 );
+    vRoot -= v;
+    if( mpi::AllReduce( MaxNorm(vRoot), mpi::MAX, comm ) != Real(0) )
+        LogicError(label," returned different coordinates on each process");
+
+    Matrix<Real> b;
+    Gemv( NORMAL, Real(1), B, v, b );
+    const Real bNorm = FrobeniusNorm( b );
+    if( Abs(bNorm-norm) > tol )
+        LogicError
+        (label," returned the norm ",norm," with a vector of norm ",bNorm);
+}
+
+// Full enumeration should find a vector of the same norm as the sequential
+// algorithm, both for an automatically chosen split depth and for each
+// explicit depth
+template<typename Real>
+Real TestFull
+( const Matrix<Real>& B,
+  const Matrix<Real>& R,
+  EnumCtrl<Real> ctrl,
+  mpi::Comm comm )
+{
+    const Int n = B.Width();
+    ctrl.enumType = FULL_ENUM;
+    Matrix<Real> v;
+    ctrl.parallel = false;
+    const Real seqNorm = ShortestVectorEnumeration( B, R, v, ctrl );
+    OutputFromRoot(comm,"Sequential FULL_ENUM: || b ||_2 = ",seqNorm);
+
+    ctrl.parallel = true;
+    const Real tol = Sqrt(limits::Epsilon<Real>())*seqNorm;
+    for( Int splitDepth=0; splitDepth<n; ++splitDepth )
+    {
+        ctrl.splitDepth = splitDepth;
+        const Real parNorm = ShortestVectorEnumeration( B, R, v, ctrl );
+        OutputFromRoot
+        (comm,"Parallel FULL_ENUM with splitDepth=",splitDepth,
+         ": || b ||_2 = ",parNorm);
+        if( Abs(parNorm-seqNorm) > tol )
+            LogicError
+            ("Parallel enumeration returned ",parNorm," rather than ",
+             seqNorm);
+        CheckVector( B, v, parNorm, tol, comm, "Parallel FULL_ENUM" );
+    }
+    return seqNorm;
+}
+
+// Pruned enumeration with several randomized trials. Every trial after the
+// first enumerates a randomly transformed basis, which must be the same on
+// every process for the subtrees to cover a single tree and for the
+// coordinates to be mapped back to the original basis consistently.
+template<typename Real>
+void TestPruned
+( const Matrix<Real>& B,
+  const Matrix<Real>& R,
+        Real normUpperBound,
+        Int numTrials,
+  EnumCtrl<Real> ctrl,
+  mpi::Comm comm )
+{
+    ctrl.enumType = GNR_ENUM;
+    ctrl.numTrials = numTrials;
+    ctrl.parallel = true;
+    ctrl.splitDepth = 0;
+    Matrix<Real> v;
+    const Real norm = ShortVectorEnumeration( B, R, normUpperBound, v, ctrl );
+    OutputFromRoot
+    (comm,"Parallel GNR_ENUM with ",numTrials," trials: || b ||_2 = ",norm);
+    if( mpi::AllReduce( norm, mpi::MAX, comm ) !=
+        mpi::AllReduce( norm, mpi::MIN, comm ) )
+        LogicError("GNR_ENUM returned different norms on each process");
+    if( norm < normUpperBound )
+    {
+        const Real tol = Sqrt(limits::Epsilon<Real>())*norm;
+        CheckVector( B, v, norm, tol, comm, "Parallel GNR_ENUM" );
+    }
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        typedef double Real;
+
+        const Int n = Input("--n","problem size",20);
+        const Real radius = Input("--radius","sampling radius",Real(1.e6));
+        const Int subtreesPerWorker =
+          Input("--subtreesPerWorker","subtrees per worker",16);
+        const Int syncInterval =
+          Input("--syncInterval","nodes between radius syncs",64);
+        const Int numTrials =
+          Input("--numTrials","number of pruned enumeration trials",8);
+        const Real boundRatio =
+          Input("--boundRatio","pruned bound relative to shortest",Real(1.01));
+        ProcessInput();
+        PrintInputReport();
+
+        // Every process must enumerate the same lattice
+        Matrix<Real> B;
+        if( mpi::Rank(comm) == 0 )
+            KnapsackTypeBasis( B, n, radius );
+        else
+            Zeros( B, n+1, n );
+        Broadcast( B, comm, 0 );
+
+        Matrix<Real> R;
+        LLL( B, R );
+
+        EnumCtrl<Real> ctrl;
+        // Keep the enumerations in the same precision so that the norms can
+        // be compared to a tight tolerance
+        ctrl.disablePrecDrop = true;
+        ctrl.subtreesPerWorker = subtreesPerWorker;
+        ctrl.syncInterval = syncInterval;
+        ctrl.comm = comm;
+        const Real shortestNorm = TestFull( B, R, ctrl, comm );
+        TestPruned( B, R, boundRatio*shortestNorm, numTrials, ctrl, comm );
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,97 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Throw if the upper-triangular factor R of a basis is not (delta,eta)
+// LLL-reduced, up to the relative tolerance 'tol'
+template<typename Real>
+void CheckLLLReduced( const Matrix<Real>& R, Real delta, Real eta, Real tol )
+{
+    const Int n = Min(R.Height(),R.Width());
+    for( Int j=1; j<n; ++j )
+    {
+        for( Int i=0; i<j; ++i )
+            if( Abs(R(i,j)) > (eta+tol)*Abs(R(i,i)) )
+                LogicError
+                ("Column ",j," was not size reduced against column ",i);
+        const Real lhs = delta*R(j-1,j-1)*R(j-1,j-1);
+        const Real rhs = R(j-1,j)*R(j-1,j) + R(j,j)*R(j,j);
+        if( lhs > (1+tol)*rhs )
+            LogicError("The Lovasz condition failed for column ",j);
+    }
+}
+
+// Reduce a copy of BOrig, check that the result is LLL-reduced and that
+// B = BOrig U holds exactly, and return the number of segmented sweeps
+template<typename Real>
+Int ReduceAndCheck
+( const Matrix<Real>& BOrig, const LLLCtrl<Real>& ctrl, const string& label )
+{
+    auto B( BOrig );
+    Matrix<Real> U, R;
+    Timer timer;
+    timer.Start();
+    const auto info = LLL( B, U, R, ctrl );
+    Output
+    (label,": ",timer.Stop()," seconds, ",info.numSwaps," swaps, ",
+     info.numSweeps," sweeps, root Hermite factor ",
+     lll::RootHermiteFactor(R));
+
+    const Real tol = Sqrt(limits::Epsilon<Real>());
+    CheckLLLReduced( R, ctrl.delta, ctrl.eta, tol );
+
+    // The basis is only modified by integer column operations on integers
+    // which are exactly representable, so the transformation must be
+    // reproduced without any rounding
+    Matrix<Real> E( B );
+    Gemm( NORMAL, NORMAL, Real(-1), BOrig, U, Real(1), E );
+    if( MaxNorm(E) != Real(0) )
+        LogicError(label," did not maintain B = BOrig U");
+    return info.numSweeps;
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        typedef double Real;
+
+        const Int n = Input("--n","problem size",60);
+        const Real radius = Input("--radius","sampling radius",Real(1.e6));
+        const Int segmentSize = Input("--segmentSize","segment size",16);
+        const bool progress = Input("--progress","print progress?",false);
+        const bool time = Input("--time","time the sweeps?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        Matrix<Real> BOrig;
+        KnapsackTypeBasis( BOrig, n, radius );
+
+        LLLCtrl<Real> ctrl;
+        ctrl.progress = progress;
+        ctrl.time = time;
+        ReduceAndCheck( BOrig, ctrl, "Unsegmented LLL" );
+
+        ctrl.segmented = true;
+        ctrl.segmentSize = segmentSize;
+        const Int numSweeps = ReduceAndCheck( BOrig, ctrl, "Segmented LLL" );
+        if( segmentSize < n && numSweeps == 0 )
+            LogicError("The segmented reduction was not used");
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_TESTS_OPTIMIZATION_FEASIBLELP_HPP
+#define EL_TESTS_OPTIMIZATION_FEASIBLELP_HPP
+
+// Random sparse constraints, A = [I, R], whose sparsity pattern only depends
+// upon the dimensions, along with data for which the primal and dual
+// problems are both feasible
+
+namespace El {
+
+template<typename Real>
+void ConstraintMatrix( SparseMatrix<Real>& A, Int m, Int n, Int numNonzeros )
+{
+    Zeros( A, m, n );
+    A.Reserve( m*(numNonzeros+1) );
+    for( Int i=0; i<m; ++i )
+    {
+        A.QueueUpdate( i, i, Real(1) );
+        for( Int k=0; k<numNonzeros; ++k )
+            A.QueueUpdate
+            ( i, m+(7*i+13*k)%(n-m), SampleUniform<Real>(-1,1) );
+    }
+    A.ProcessQueues();
+}
+
+template<typename Real>
+void ConstraintMatrix
+( DistSparseMatrix<Real>& A, Int m, Int n, Int numNonzeros )
+{
+    A.Resize( m, n );
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( localHeight*(numNonzeros+1) );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        A.QueueLocalUpdate( iLoc, i, Real(1) );
+        for( Int k=0; k<numNonzeros; ++k )
+            A.QueueLocalUpdate
+            ( iLoc, m+(7*i+13*k)%(n-m), SampleUniform<Real>(-1,1) );
+    }
+    A.ProcessLocalQueues();
+}
+
+// Choose 'b' and 'c' so that x, z > 0 and y satisfy A x = b and
+// A^T y - z + c = 0
+template<typename Real>
+void FeasibleData
+( const SparseMatrix<Real>& A, Matrix<Real>& b, Matrix<Real>& c )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Matrix<Real> xFeas, yFeas, zFeas;
+    Uniform( xFeas, n, 1, Real(1), Real(Real(1)/2) );
+    Uniform( yFeas, m, 1 );
+    Uniform( zFeas, n, 1, Real(1), Real(Real(1)/2) );
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, xFeas, Real(0), b );
+    c = zFeas;
+    Multiply( TRANSPOSE, Real(-1), A, yFeas, Real(1), c );
+}
+
+template<typename Real>
+void FeasibleData
+( const DistSparseMatrix<Real>& A,
+        DistMultiVec<Real>& b,
+        DistMultiVec<Real>& c )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Grid& grid = A.Grid();
+    DistMultiVec<Real> xFeas(grid), yFeas(grid), zFeas(grid);
+    Uniform( xFeas, n, 1, Real(1), Real(Real(1)/2) );
+    Uniform( yFeas, m, 1 );
+    Uniform( zFeas, n, 1, Real(1), Real(Real(1)/2) );
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, xFeas, Real(0), b );
+    c = zFeas;
+    Multiply( TRANSPOSE, Real(-1), A, yFeas, Real(1), c );
+}
+
+} // namespace El
+
+#endif // ifndef EL_TESTS_OPTIMIZATION_FEASIBLELP_HPP
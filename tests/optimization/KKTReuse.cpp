@@ -0,0 +1,222 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+#include "./FeasibleLP.hpp"
+
+template<typename Real>
+void CheckObjectives
+( const Grid& grid, const string& label, Real reusedObj, Real freshObj )
+{
+    const Real relGap =
+      Abs(reusedObj-freshObj) / Max( Abs(freshObj), Real(1) );
+    OutputFromRoot
+    (grid.Comm(),label,": reused objective ",reusedObj,", fresh objective ",
+     freshObj);
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.25));
+    if( relGap > tol )
+        LogicError(label," with a reused analysis was inaccurate");
+}
+
+// The sequential and distributed tests only differ in their setup
+template<typename Real>
+void Align( DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>&, const Grid& )
+{ }
+template<typename Real>
+void Align( DirectLPSolution<Matrix<Real>>&, const Grid& )
+{ }
+template<typename Real>
+void Align
+( DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+  const Grid& grid )
+{ ForceSimpleAlignments( problem, grid ); }
+template<typename Real>
+void Align( DirectLPSolution<DistMultiVec<Real>>& solution, const Grid& grid )
+{ ForceSimpleAlignments( solution, grid ); }
+
+string SystemName( KKTSystem system )
+{
+    return system==AUGMENTED_KKT ? "augmented" :
+           system==FULL_KKT ? "full" : "normal";
+}
+
+// Solve an LP, then drive a second solve with new data of the same sparsity
+// pattern (and a third, warm-started, solve) through the saved analysis.
+// Since a warm start skips the initialization, which is the only use of the
+// augmented system when the iterations use the full or normal system, the
+// flags of the analysis then also show that the initialization was skipped
+// and that changing the pattern of A discards the saved analyses.
+template<typename Real,class MatrixType,class VectorType,class AnalysisType>
+void TestLP
+( Int m, Int n, Int numNonzeros, KKTSystem system, const Grid& grid,
+  bool print, const string& distName )
+{
+    OutputFromRoot
+    (grid.Comm(),"Testing ",distName," LP with ",SystemName(system),
+     " KKT systems");
+    DirectLPProblem<MatrixType,VectorType> problem;
+    Align( problem, grid );
+    ConstraintMatrix( problem.A, m, n, numNonzeros );
+    FeasibleData( problem.A, problem.b, problem.c );
+
+    lp::direct::Ctrl<Real> ctrl(true);
+    ctrl.mehrotraCtrl.system = system;
+    ctrl.mehrotraCtrl.print = print;
+    auto checkAnalyzed = [&]( const AnalysisType& analysis, const string& msg )
+      {
+          if( !analysis.augmentedAnalyzed ||
+              (system != AUGMENTED_KKT && !analysis.analyzed) )
+              LogicError("The LP analysis was ",msg);
+      };
+
+    AnalysisType analysis;
+    DirectLPSolution<VectorType> solution;
+    Align( solution, grid );
+    LP( problem, solution, analysis, ctrl );
+    checkAnalyzed( analysis, "not saved" );
+
+    // Perturb the values but not the pattern of A, as well as b and c
+    ConstraintMatrix( problem.A, m, n, numNonzeros );
+    FeasibleData( problem.A, problem.b, problem.c );
+    LP( problem, solution, analysis, ctrl );
+    checkAnalyzed( analysis, "discarded" );
+    const Real reusedObj = Dot( problem.c, solution.x );
+
+    DirectLPSolution<VectorType> freshSolution;
+    Align( freshSolution, grid );
+    LP( problem, freshSolution, ctrl );
+    const Real freshObj = Dot( problem.c, freshSolution.x );
+    CheckObjectives( grid, "LP", reusedObj, freshObj );
+
+    // Warm start from the previous solution, which is nearly complementary
+    // and must therefore be pulled away from the boundary
+    ctrl.mehrotraCtrl.primalInit = true;
+    ctrl.mehrotraCtrl.dualInit = true;
+    ctrl.mehrotraCtrl.warmStartFloor = Real(1)/Real(1000);
+    auto warmSolution( solution );
+    LP( problem, warmSolution, analysis, ctrl );
+    checkAnalyzed( analysis, "discarded by a warm start" );
+    CheckObjectives
+    ( grid, "Warm-started LP", Dot(problem.c,warmSolution.x), freshObj );
+    if( system == AUGMENTED_KKT )
+        return;
+
+    AnalysisType warmAnalysis;
+    warmSolution = solution;
+    LP( problem, warmSolution, warmAnalysis, ctrl );
+    if( warmAnalysis.augmentedAnalyzed || !warmAnalysis.analyzed )
+        LogicError("A warm-started LP did not skip the initialization");
+
+    // Add a nonzero to each row of A
+    ConstraintMatrix( problem.A, m, n, numNonzeros+1 );
+    FeasibleData( problem.A, problem.b, problem.c );
+    LP( problem, solution, analysis, ctrl );
+    if( analysis.augmentedAnalyzed || !analysis.analyzed )
+        LogicError("Changing the pattern of A did not discard the analysis");
+    LP( problem, freshSolution, ctrl );
+    CheckObjectives
+    ( grid, "LP with a new pattern", Dot(problem.c,solution.x),
+      Dot(problem.c,freshSolution.x) );
+}
+
+// Likewise for a QP with a diagonal, positive-definite Q
+template<typename Real>
+void TestQP
+( Int m, Int n, Int numNonzeros, KKTSystem system, const Grid& grid,
+  bool print )
+{
+    OutputFromRoot
+    (grid.Comm(),"Testing QP with ",SystemName(system)," KKT systems");
+    DistSparseMatrix<Real> Q(grid), A(grid);
+    DistMultiVec<Real> b(grid), c(grid);
+    Zeros( Q, n, n );
+    Q.Reserve( Q.LocalHeight() );
+    for( Int iLoc=0; iLoc<Q.LocalHeight(); ++iLoc )
+        Q.QueueLocalUpdate( iLoc, Q.GlobalRow(iLoc), SampleUniform<Real>(1,2) );
+    Q.ProcessLocalQueues();
+    ConstraintMatrix( A, m, n, numNonzeros );
+    FeasibleData( A, b, c );
+
+    qp::direct::Ctrl<Real> ctrl;
+    ctrl.mehrotraCtrl.system = system;
+    ctrl.mehrotraCtrl.print = print;
+
+    qp::direct::DistSparseKKTAnalysis<Real> analysis;
+    DistMultiVec<Real> x(grid), y(grid), z(grid);
+    QP( Q, A, b, c, x, y, z, analysis, ctrl );
+    if( !analysis.augmentedAnalyzed ||
+        (system != AUGMENTED_KKT && !analysis.analyzed) )
+        LogicError("The QP analysis was not saved");
+
+    ConstraintMatrix( A, m, n, numNonzeros );
+    FeasibleData( A, b, c );
+    QP( Q, A, b, c, x, y, z, analysis, ctrl );
+    if( !analysis.augmentedAnalyzed ||
+        (system != AUGMENTED_KKT && !analysis.analyzed) )
+        LogicError("The QP analysis was discarded");
+
+    // Compare the objectives, (1/2) x^T Q x + c^T x
+    auto objective = [&]( const DistMultiVec<Real>& xSol )
+      {
+          DistMultiVec<Real> Qx(grid);
+          Zeros( Qx, n, 1 );
+          Multiply( NORMAL, Real(1), Q, xSol, Real(0), Qx );
+          return Dot(xSol,Qx)/2 + Dot(c,xSol);
+      };
+    DistMultiVec<Real> xFresh(grid), yFresh(grid), zFresh(grid);
+    QP( Q, A, b, c, xFresh, yFresh, zFresh, ctrl );
+    const Real freshObj = objective( xFresh );
+    CheckObjectives( grid, "QP", objective(x), freshObj );
+
+    ctrl.mehrotraCtrl.primalInit = true;
+    ctrl.mehrotraCtrl.dualInit = true;
+    ctrl.mehrotraCtrl.warmStartFloor = Real(1)/Real(1000);
+    QP( Q, A, b, c, x, y, z, analysis, ctrl );
+    CheckObjectives( grid, "Warm-started QP", objective(x), freshObj );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of the constraints",100);
+        const Int n = Input("--n","width of the constraints",300);
+        const Int numNonzeros =
+          Input("--numNonzeros","off-identity nonzeros per row",4);
+        const bool print = Input("--print","print IPM progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        for( auto system : { AUGMENTED_KKT, FULL_KKT, NORMAL_KKT } )
+        {
+            TestLP
+            <double,SparseMatrix<double>,Matrix<double>,
+             lp::direct::SparseKKTAnalysis<double>>
+            ( m, n, numNonzeros, system, grid, print, "sequential" );
+            TestLP
+            <double,DistSparseMatrix<double>,DistMultiVec<double>,
+             lp::direct::DistSparseKKTAnalysis<double>>
+            ( m, n, numNonzeros, system, grid, print, "distributed" );
+        }
+        TestQP<double>( m, n, numNonzeros, AUGMENTED_KKT, grid, print );
+        TestQP<double>( m, n, numNonzeros, FULL_KKT, grid, print );
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,151 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+#include "./FeasibleLP.hpp"
+
+// Solve a 1D Laplacian system with CG, first from a zero initial guess and
+// then from a perturbation of the solution, which should not require more
+// iterations
+template<typename Real>
+void TestCG( Int n, const Grid& grid, bool progress )
+{
+    const Real eps = limits::Epsilon<Real>();
+    const Real relTol = Sqrt(eps);
+    const Int maxIts = 10*n;
+
+    DistSparseMatrix<Real> A(grid);
+    Laplacian( A, n );
+    auto applyA =
+      [&]( Real alpha, const DistMultiVec<Real>& x,
+           Real beta,        DistMultiVec<Real>& y )
+      { Multiply( NORMAL, alpha, A, x, beta, y ); };
+    auto precond = []( DistMultiVec<Real>& ) { };
+
+    DistMultiVec<Real> xTrue(grid), b(grid);
+    Uniform( xTrue, n, 1 );
+    Zeros( b, n, 1 );
+    Multiply( NORMAL, Real(1), A, xTrue, Real(0), b );
+    const Real bNorm = FrobeniusNorm( b );
+
+    DistMultiVec<Real> x(b);
+    const Int zeroIts = CG( applyA, precond, x, relTol, maxIts, progress );
+    DistMultiVec<Real> r(b);
+    Multiply( NORMAL, Real(-1), A, x, Real(1), r );
+    Real relResid = FrobeniusNorm( r ) / bNorm;
+    OutputFromRoot
+    (grid.Comm(),"CG from zero: ",zeroIts," its, relative residual ",
+     relResid);
+    if( relResid > 10*relTol )
+        LogicError("CG from a zero initial guess did not converge");
+
+    DistMultiVec<Real> perturb(grid);
+    Uniform( perturb, n, 1, Real(0), Real(1e-3) );
+    x = xTrue;
+    x += perturb;
+    const Int guessIts =
+      CG( applyA, precond, b, x, relTol, maxIts, progress );
+    r = b;
+    Multiply( NORMAL, Real(-1), A, x, Real(1), r );
+    relResid = FrobeniusNorm( r ) / bNorm;
+    OutputFromRoot
+    (grid.Comm(),"CG from a guess: ",guessIts," its, relative residual ",
+     relResid);
+    if( relResid > 10*relTol )
+        LogicError("CG from an initial guess did not converge");
+    if( guessIts > zeroIts )
+        LogicError("The initial guess increased the number of CG iterations");
+
+    // Reaching the iteration limit should yield the best iterate so far
+    // rather than an exception
+    const Int fewIts = Max(zeroIts/4,Int(1));
+    Zeros( x, n, 1 );
+    const Int limitedIts =
+      CG( applyA, precond, b, x, relTol, fewIts, progress );
+    r = b;
+    Multiply( NORMAL, Real(-1), A, x, Real(1), r );
+    relResid = FrobeniusNorm( r ) / bNorm;
+    OutputFromRoot
+    (grid.Comm(),"CG limited to ",fewIts," its: relative residual ",relResid);
+    if( limitedIts != fewIts || relResid >= Real(1) )
+        LogicError("CG did not return an improved iterate at its limit");
+}
+
+// Generate a feasible and bounded LP, A x = b, x >= 0, with A = [I, R] for a
+// sparse random R, and check that the Krylov normal-KKT solves reach the same
+// objective as the default sparse-direct solves
+template<typename Real>
+void TestKrylovLP( Int m, Int n, Int numNonzeros, const Grid& grid, bool print )
+{
+    DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>> problem;
+    ForceSimpleAlignments( problem, grid );
+    ConstraintMatrix( problem.A, m, n, numNonzeros );
+    FeasibleData( problem.A, problem.b, problem.c );
+
+    lp::direct::Ctrl<Real> ctrl(true);
+    ctrl.mehrotraCtrl.print = print;
+
+    DirectLPSolution<DistMultiVec<Real>> solution;
+    ForceSimpleAlignments( solution, grid );
+    LP( problem, solution, ctrl );
+    const Real directObj = Dot( problem.c, solution.x );
+
+    ctrl.mehrotraCtrl.system = NORMAL_KKT;
+    ctrl.mehrotraCtrl.krylovKKT = true;
+    DirectLPSolution<DistMultiVec<Real>> krylovSolution;
+    ForceSimpleAlignments( krylovSolution, grid );
+    LP( problem, krylovSolution, ctrl );
+    const Real krylovObj = Dot( problem.c, krylovSolution.x );
+
+    DistMultiVec<Real> r(problem.b);
+    Multiply
+    ( NORMAL, Real(-1), problem.A, krylovSolution.x, Real(1), r );
+    const Real primalResid =
+      FrobeniusNorm( r ) / Max( FrobeniusNorm(problem.b), Real(1) );
+    const Real relGap =
+      Abs(krylovObj-directObj) / Max( Abs(directObj), Real(1) );
+    OutputFromRoot
+    (grid.Comm(),"Direct objective: ",directObj,", Krylov objective: ",
+     krylovObj,", || A x - b ||_2 / max(|| b ||_2,1) = ",primalResid);
+
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.25));
+    if( relGap > tol || primalResid > tol )
+        LogicError("The Krylov LP solution was inaccurate");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","size of the Laplacian",200);
+        const Int mLP = Input("--mLP","height of the LP constraints",100);
+        const Int nLP = Input("--nLP","width of the LP constraints",300);
+        const Int numNonzeros =
+          Input("--numNonzeros","off-identity nonzeros per row",4);
+        const bool progress = Input("--progress","print CG progress?",false);
+        const bool print = Input("--print","print IPM progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestCG<double>( n, grid, progress );
+        TestKrylovLP<double>( mLP, nLP, numNonzeros, grid, print );
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}